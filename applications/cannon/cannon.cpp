@@ -5,13 +5,27 @@
  * Simulates a 3-Dimensional object with an initial velocity
  * in a world with gravity and wind.
  *
+ * Usage: Cannon [particles] [frames]
+ *
+ * With no arguments a single projectile is fired and its trajectory is
+ * written to trajectory.ppm.  Given a particle count, that many
+ * projectiles are fired at once with slightly different velocities and
+ * lifetimes, simulated for frames frames (default 200) with a
+ * ParticleSystem, and drawn to particles.ppm; the simulation and drawing
+ * rates are reported in particles per second.
+ *
  * Bryant Pong
  * 9/10/18
  */
 
 #include "Tuple.h"
 #include "Canvas.h"
+#include "ParticleSystem.h"
+#include "Random.h"
+#include "TileScheduler.h"
 
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 
 /*
@@ -55,7 +69,53 @@ Tuple World2Image(const Tuple &worldCoordinate, const int imgHeight) {
   return Point(worldCoordinate.X(), imgHeight - worldCoordinate.Y(), worldCoordinate.Z());
 }
 
-int main(void) {
+/*
+ * Fires particles projectiles from start at once and simulates them with a
+ * ParticleSystem, drawing every particle on every frame.
+ */
+int FireParticles(const Tuple &start, const Tuple &velocity, const Tuple &gravity,
+                  const Tuple &wind, const size_t particles, const int frames) {
+  ParticleSystem system(gravity, wind);
+
+  // Four fixed steps per frame (one frame is one Tick() of the original)
+  system.SetFixedTimestep(0.25f);
+
+  // Spread the launch speed and angle a little, and end each particle's
+  // life somewhere between 50 and 250 ticks
+  Pcg32 rng(1);
+  for (size_t i = 0; i < particles; ++i) {
+    const Tuple JITTER = Vector(rng.NextFloat() - 0.5f, rng.NextFloat() - 0.5f, 0) * 2;
+    system.Emit(start, velocity + JITTER, 50 + 200 * rng.NextFloat());
+  }
+
+  Canvas canvas(900, 550);
+  TileScheduler scheduler;
+  double tickSeconds = 0, drawSeconds = 0;
+  size_t ticked = 0, drawn = 0;
+  for (int frame = 0; frame < frames && system.Size() > 0; ++frame) {
+    const size_t COUNT = system.Size();
+    const std::chrono::steady_clock::time_point START = std::chrono::steady_clock::now();
+    system.Update(1, scheduler);
+    const std::chrono::steady_clock::time_point TICKED = std::chrono::steady_clock::now();
+    system.Rasterize(canvas, Color(1, 0, 0));
+    const std::chrono::steady_clock::time_point DRAWN = std::chrono::steady_clock::now();
+
+    tickSeconds += std::chrono::duration<double>(TICKED - START).count();
+    drawSeconds += std::chrono::duration<double>(DRAWN - TICKED).count();
+    ticked += COUNT;
+    drawn  += system.Size();
+  }
+
+  std::cout << system.Size() << " of " << particles << " particles still alive" << std::endl;
+  std::cout << "Simulated " << ticked / tickSeconds / 1e6 << " million particles/s on "
+            << scheduler.NumThreads() << " threads" << std::endl;
+  std::cout << "Drew " << drawn / drawSeconds / 1e6 << " million particles/s" << std::endl;
+
+  canvas.WriteToPPM("particles.ppm");
+  return 0;
+}
+
+int main(int argc, char **argv) {
   // Initialize the projectile's initial position and velocity
   const Tuple START     = Point(0, 1, 0);
   const Tuple VELOCITY  = Normalize(Vector(1, 1.8, 0)) * 11.25;
@@ -70,6 +130,16 @@ int main(void) {
   const Tuple WIND    = Vector(-0.01, 0, 0);
   World world         = {GRAVITY, WIND};
 
+  if (argc > 1) {
+    const int PARTICLES = atoi(argv[1]);
+    const int FRAMES    = (argc > 2) ? atoi(argv[2]) : 200;
+    if (PARTICLES <= 0 || FRAMES <= 0) {
+      std::cerr << "Usage: " << argv[0] << " [particles] [frames]" << std::endl;
+      return 1;
+    }
+    return FireParticles(START, VELOCITY, GRAVITY, WIND, PARTICLES, FRAMES);
+  }
+
   // Canvas to draw on
   Canvas canvas(900, 550);
 
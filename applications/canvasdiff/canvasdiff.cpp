@@ -0,0 +1,58 @@
+/*
+ * canvasdiff.cpp
+ *
+ * Compares two PPM images, e.g. a render from an optimized build against a
+ * reference render, and optionally writes a heatmap of the differences.
+ * Exits with status 1 if the largest difference exceeds the tolerance, so
+ * it can be used in scripts.
+ *
+ * Usage: CanvasDiff <reference.ppm> <test.ppm> [heatmap.ppm] [tolerance]
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Canvas.h"
+#include "CanvasDiff.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s <reference.ppm> <test.ppm> [heatmap.ppm] [tolerance]\n", argv[0]);
+    return 2;
+  }
+  const std::string HEATMAP = (argc > 3) ? argv[3] : "";
+  const float TOLERANCE     = (argc > 4) ? static_cast<float>(atof(argv[4])) : 0.0f;
+
+  Canvas reference(1, 1), test(1, 1);
+  if (!reference.ReadFromPPM(argv[1])) {
+    fprintf(stderr, "Failed to read %s\n", argv[1]);
+    return 2;
+  }
+  if (!test.ReadFromPPM(argv[2])) {
+    fprintf(stderr, "Failed to read %s\n", argv[2]);
+    return 2;
+  }
+
+  Canvas heatmap(reference.GetWidth(), reference.GetHeight());
+  CanvasDiffStats stats;
+  if (!CompareCanvases(reference, test, stats, HEATMAP.empty() ? NULL : &heatmap)) {
+    fprintf(stderr, "Image sizes differ: %dx%d vs %dx%d\n", reference.GetWidth(),
+            reference.GetHeight(), test.GetWidth(), test.GetHeight());
+    return 1;
+  }
+
+  printf("Max error:      %.6f at (%d, %d)\n", stats.maxError, stats.worstX, stats.worstY);
+  printf("Mean error:     %.6f\n", stats.meanError);
+  printf("RMSE:           %.6f\n", stats.rmse);
+  printf("PSNR:           %.2f dB\n", stats.psnr);
+  printf("Visible pixels: %lld of %d\n", stats.visiblePixels,
+         reference.GetWidth() * reference.GetHeight());
+
+  if (!HEATMAP.empty()) {
+    heatmap.WriteToPPM(HEATMAP.c_str());
+  }
+  return (stats.maxError <= TOLERANCE) ? 0 : 1;
+}
@@ -7,7 +7,8 @@
  * Bryant Pong
  * 9/23/18
  */
-#include "Transformations.h"
+#include "TransformBuilder.h"
+#include "TupleArrays.h"
 #include "Color.h"
 #include "Canvas.h"
 
@@ -24,8 +25,15 @@ int main(void) {
 
   Canvas canvas(CANVAS_WIDTH, CANVAS_HEIGHT);
 
-  // Initial right-most point; we'll be rotating this around the canvas center
+  /*
+   * One point per hour, each starting at the initial right-most point.
+   * We'll rotate every point around the canvas center by its own hour.
+   */
   const Tuple p = Point(CENTER_X + 100, CENTER_Y, 0);
+  TupleArrays hours;
+  for (int hour = 0; hour < 12; ++hour) {
+    hours.Add(p);
+  }
 
   // Color of the hour points
   Color color(1.0, 1.0, 1.0);
@@ -43,13 +51,19 @@ int main(void) {
    * 1) Translate the point w.r.t. the origin
    * 2) Rotate the point around the origin
    * 3) Translate the point back to the original rotation point
+   *
+   * Every hour's point is rotated once from the original point p.
    */
+  for (int hour = 0; hour < 12; ++hour) {
+    const AffineTransform ROTATE = TransformBuilder().Translate(-CENTER_X, -CENTER_Y, 0)
+                                                     .RotZ(hour * ROTATE_BY)
+                                                     .Translate(CENTER_X, CENTER_Y, 0)
+                                                     .Forward();
+    TransformPoints(ROTATE, &hours.x[hour], &hours.y[hour], &hours.z[hour], 1);
+  }
 
-  for(float rot = 0; rot < (2*M_PI); rot += ROTATE_BY) {
-    const Matrix TRANSLATE_WRT_ORIGIN = Translation(-CENTER_X, -CENTER_Y, 0);
-    const Matrix TRANSLATE_BACK = Translation(CENTER_X, CENTER_Y, 0);
-    const Tuple rotated = TRANSLATE_BACK * RotZ(rot) * TRANSLATE_WRT_ORIGIN * p;
-    canvas.WritePixel(rotated.X(), rotated.Y(), color);
+  for (size_t i = 0; i < hours.Size(); ++i) {
+    canvas.WritePixel(hours.x[i], hours.y[i], color);
   }
 
   // Write the clock face image
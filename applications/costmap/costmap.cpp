@@ -0,0 +1,66 @@
+/*
+ * costmap.cpp
+ *
+ * Renders a scene with per-pixel cost counters and writes the frame along
+ * with a heatmap of each counter:
+ *
+ *   costmap.ppm             The rendered frame
+ *   costmap_rays.ppm        Rays cast per pixel
+ *   costmap_intersects.ppm  Ray-object intersection tests per pixel
+ *   costmap_shades.ppm      Lighting evaluations per pixel
+ *   costmap_cycles.ppm      CPU cycles per pixel
+ *
+ * Usage: CostMap [scene] [width] [height]
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Scenes.h"
+#include "Camera.h"
+#include "Canvas.h"
+#include "CostHeatmap.h"
+#include "TileScheduler.h"
+#include "RenderStats.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv) {
+  const std::string NAME = (argc > 1) ? argv[1] : "glassspheres";
+  const int WIDTH        = (argc > 2) ? atoi(argv[2]) : 400;
+  const int HEIGHT       = (argc > 3) ? atoi(argv[3]) : 200;
+
+  Scene scene;
+  {
+    RenderStatsPhase phase("setup");
+    if (!BuildScene(NAME, scene)) {
+      fprintf(stderr, "Unknown scene: %s\n", NAME.c_str());
+      return 1;
+    }
+  }
+  const Camera CAMERA = SceneCamera(scene, WIDTH, HEIGHT);
+
+  Canvas canvas(CAMERA.HSize(), CAMERA.VSize());
+  TileScheduler scheduler;
+  std::vector<PixelCounters> counters;
+  PixelCounters total;
+  {
+    RenderStatsPhase phase("render");
+    total = RenderWithCounters(CAMERA, scene.world, canvas, scheduler, counters);
+  }
+
+  const double PIXELS = static_cast<double>(WIDTH) * HEIGHT;
+  printf("Per pixel: %.2f rays, %.2f intersects, %.2f shades, %.0f cycles\n",
+         total.rays / PIXELS, total.intersects / PIXELS, total.shades / PIXELS,
+         total.cycles / PIXELS);
+
+  {
+    RenderStatsPhase phase("output");
+    canvas.WriteToPPM("costmap.ppm");
+    WriteCounterHeatmaps(counters, WIDTH, HEIGHT, "costmap");
+  }
+  ReportRenderStats();
+  return 0;
+}
@@ -0,0 +1,56 @@
+/*
+ * glassspheres.cpp
+ *
+ * Renders a glass sphere and a mirrored sphere resting on a floor to
+ * exercise recursive reflection and refraction.  A timeline of the render
+ * is written to glassspheres_trace.json (open it in chrome://tracing or
+ * ui.perfetto.dev).
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Scenes.h"
+#include "Camera.h"
+#include "Canvas.h"
+#include "AntiAliasing.h"
+#include "TileScheduler.h"
+#include "FrameTrace.h"
+#include "RenderStats.h"
+
+#include <cstdio>
+
+int main(void) {
+  SetTraceThreadName("main");
+  StartFrameTrace();
+
+  Scene scene;
+  {
+    RenderStatsPhase phase("setup");
+    BuildScene("glassspheres", scene);
+  }
+  const Camera CAMERA = SceneCamera(scene, 400, 200);
+
+  // Render with adaptive anti-aliasing
+  Canvas canvas(CAMERA.HSize(), CAMERA.VSize());
+  TileScheduler scheduler;
+  AntiAliasStats stats;
+  {
+    RenderStatsPhase phase("render");
+    stats = RenderAdaptive(CAMERA, scene.world, canvas, AntiAliasOptions(), scheduler);
+  }
+  printf("Average samples per pixel: %.2f (%lld of %lld pixels refined)\n",
+         stats.AverageSamplesPerPixel(), stats.refinedPixels, stats.pixels);
+
+  // Write canvas to file
+  {
+    RenderStatsPhase phase("output");
+    canvas.WriteToPPM("glassspheres.ppm");
+  }
+
+  StopFrameTrace();
+  if (!WriteChromeTrace("glassspheres_trace.json")) {
+    fprintf(stderr, "Failed to write glassspheres_trace.json\n");
+  }
+  ReportRenderStats();
+  return 0;
+}
@@ -0,0 +1,151 @@
+/*
+ * kernelbench.cpp
+ *
+ * Times every render kernel at each instruction set level this CPU
+ * supports, and reports which level GetRenderKernels() picked.  Pose
+ * blending is also reported per frame of 100,000 animated objects.
+ *
+ * Usage: KernelBench [level]
+ *
+ * where level (sse2, sse4.2, avx2, or avx512) limits the run to one level.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "kernels/Kernels.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * @brief  Best of several runs of fn, in nanoseconds per element.
+ */
+template <typename Function>
+double NanosecondsPerElement(const Function &fn, const size_t count) {
+  double best = 1e30;
+  for (int run = 0; run < 5; ++run) {
+    const std::chrono::steady_clock::time_point START = std::chrono::steady_clock::now();
+    fn();
+    const double SECONDS = std::chrono::duration<double>(std::chrono::steady_clock::now() - START).count();
+    best = (SECONDS < best) ? SECONDS : best;
+  }
+  return best * 1e9 / count;
+}
+
+int main(int argc, char **argv) {
+  const CpuLevel DETECTED = DetectCpuLevel();
+  CpuLevel first = CPU_SSE2, last = DETECTED;
+  if (argc > 1) {
+    if (!ParseCpuLevel(argv[1], first) || first > DETECTED) {
+      fprintf(stderr, "Unsupported level: %s\n", argv[1]);
+      return 1;
+    }
+    last = first;
+  }
+
+  printf("CPU supports %s; using %s\n", CpuLevelName(DETECTED),
+         CpuLevelName(GetRenderKernels().level));
+
+  // Random points, unit directions, and colors somewhat outside 0-1
+  const size_t COUNT = 1 << 18;
+  std::vector<float> points(4 * COUNT), directions(4 * COUNT), normals(4 * COUNT);
+  for (size_t i = 0; i < COUNT; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      points[4 * i + c]     = 4.0f * rand() / RAND_MAX - 2.0f;
+      directions[4 * i + c] = 2.0f * rand() / RAND_MAX - 1.0f;
+    }
+    points[4 * i + 3] = 1;
+    const float X = directions[4 * i], Y = directions[4 * i + 1], Z = directions[4 * i + 2];
+    const float LENGTH = sqrtf(X * X + Y * Y + Z * Z) + 1e-6f;
+    for (int c = 0; c < 3; ++c) {
+      normals[4 * i + c] = directions[4 * i + c] / LENGTH;
+    }
+  }
+
+  const float MATRIX[16] = {0.8f, -0.6f, 0, 1,  0.6f, 0.8f, 0, 2,  0, 0, 1, 3,  0, 0, 0, 1};
+  const KernelMaterial MATERIAL = {{1, 0.2f, 1}, 0.1f, 0.9f, 0.9f, 200};
+  const KernelLight LIGHT = {{-10, 10, -10}, {1, 1, 1}};
+
+  std::vector<float> out(4 * COUNT), t0(COUNT), t1(COUNT);
+  std::vector<uint8_t> rgb(3 * COUNT);
+
+  // Random unit rotations, translations, and scales to blend between
+  std::vector<float> poseData[2][10];
+  KernelPoses poses[2];
+  for (int k = 0; k < 2; ++k) {
+    for (int c = 0; c < 10; ++c) {
+      poseData[k][c].resize(COUNT);
+      for (size_t i = 0; i < COUNT; ++i) {
+        poseData[k][c][i] = 2.0f * rand() / RAND_MAX - 1.0f;
+      }
+    }
+    for (size_t i = 0; i < COUNT; ++i) {
+      float length = 0;
+      for (int c = 0; c < 4; ++c) {
+        length += poseData[k][c][i] * poseData[k][c][i];
+      }
+      for (int c = 0; c < 4; ++c) {
+        poseData[k][c][i] /= sqrtf(length) + 1e-6f;
+      }
+    }
+    poses[k].qw = poseData[k][0].data();
+    poses[k].qx = poseData[k][1].data();
+    poses[k].qy = poseData[k][2].data();
+    poses[k].qz = poseData[k][3].data();
+    poses[k].tx = poseData[k][4].data();
+    poses[k].ty = poseData[k][5].data();
+    poses[k].tz = poseData[k][6].data();
+    poses[k].sx = poseData[k][7].data();
+    poses[k].sy = poseData[k][8].data();
+    poses[k].sz = poseData[k][9].data();
+  }
+  std::vector<float> blend(COUNT, 0.3f), affine(12 * COUNT);
+
+  // The points again, as x, y, and z arrays
+  std::vector<float> xs(COUNT), ys(COUNT), zs(COUNT);
+  for (size_t i = 0; i < COUNT; ++i) {
+    xs[i] = points[4 * i];
+    ys[i] = points[4 * i + 1];
+    zs[i] = points[4 * i + 2];
+  }
+
+  // Particle velocities and lifetimes long enough to outlast the benchmark
+  const float GRAVITY[3] = {-0.01f, -0.1f, 0};
+  std::vector<float> vxs(COUNT, 1), vys(COUNT, 2), vzs(COUNT, 0), life(COUNT, 1e30f);
+
+  printf("%-8s %12s %12s %12s %12s %12s %12s %12s   (ns per element)\n",
+         "level", "transform", "soa", "intersect", "shade", "quantize", "poses", "particles");
+  for (int l = first; l <= last; ++l) {
+    const RenderKernels &K = KernelsForLevel(static_cast<CpuLevel>(l));
+    const double TRANSFORM = NanosecondsPerElement([&] {
+      K.transformTuples(MATRIX, points.data(), out.data(), COUNT);
+    }, COUNT);
+    const double SOA = NanosecondsPerElement([&] {
+      K.transformSoA(MATRIX, 1, xs.data(), ys.data(), zs.data(), COUNT);
+    }, COUNT);
+    const double INTERSECT = NanosecondsPerElement([&] {
+      K.intersectUnitSphere(points.data(), directions.data(), COUNT, t0.data(), t1.data());
+    }, COUNT);
+    const double SHADE = NanosecondsPerElement([&] {
+      K.shadePhong(MATERIAL, LIGHT, points.data(), directions.data(), normals.data(), NULL,
+                   COUNT, out.data());
+    }, COUNT);
+    const double QUANTIZE = NanosecondsPerElement([&] {
+      K.quantizePixels(points.data(), COUNT, rgb.data());
+    }, COUNT);
+    const double POSES = NanosecondsPerElement([&] {
+      K.blendPoses(poses[0], poses[1], blend.data(), COUNT, affine.data());
+    }, COUNT);
+    const double PARTICLES = NanosecondsPerElement([&] {
+      K.tickParticles(GRAVITY, 0.25f, 4, xs.data(), ys.data(), zs.data(), vxs.data(), vys.data(),
+                      vzs.data(), life.data(), COUNT);
+    }, COUNT);
+    printf("%-8s %12.3f %12.3f %12.3f %12.3f %12.3f %12.3f %12.3f   (%.3f ms per 100k poses)\n",
+           CpuLevelName(K.level), TRANSFORM, SOA, INTERSECT, SHADE, QUANTIZE, POSES, PARTICLES,
+           POSES * 0.1);
+  }
+  return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * pathtracer.cpp
+ *
+ * Renders a scene with the progressive Monte Carlo path tracer.  A high
+ * sample count reference image is rendered first; the image is then refined
+ * pass by pass, printing the throughput (samples/sec) and convergence
+ * (RMSE versus the reference) after each pass.  The result is tone mapped
+ * to pathtracer.png and written with its full dynamic range as
+ * pathtracer.exr.  If a trace file is given, a timeline of the run is
+ * written to it as Chrome trace JSON.
+ *
+ * Usage: PathTracer [width] [height] [passes] [reference spp] [trace.json]
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "Transformations.h"
+#include "World.h"
+#include "Camera.h"
+#include "Canvas.h"
+#include "PathTracer.h"
+#include "ExrImage.h"
+#include "ToneMap.h"
+#include "PngImage.h"
+#include "TileScheduler.h"
+#include "FrameTrace.h"
+#include "RenderStats.h"
+
+#include <cmath> // M_PI
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char **argv) {
+  const int WIDTH         = (argc > 1) ? atoi(argv[1]) : 160;
+  const int HEIGHT        = (argc > 2) ? atoi(argv[2]) : 80;
+  const int PASSES        = (argc > 3) ? atoi(argv[3]) : 8;
+  const int REFERENCE_SPP = (argc > 4) ? atoi(argv[4]) : 64;
+  const char *TRACE_FILE  = (argc > 5) ? argv[5] : NULL;
+
+  if (TRACE_FILE) {
+    SetTraceThreadName("main");
+    StartFrameTrace();
+  }
+
+  World world;
+
+  // Point lights fall off with distance^2, so they need to be bright
+  world.AddLight(PointLight(Point(-4, 8, -6), Color(250, 250, 250)));
+
+  // The floor is a very flat sphere
+  Sphere floor;
+  floor.SetTransform(Scaling(10, 0.01, 10));
+  Material floorMat;
+  floorMat.SetColor(Color(0.9, 0.8, 0.7));
+  floor.SetMaterial(floorMat);
+  world.AddObject(floor);
+
+  // Glass sphere
+  Sphere glass;
+  glass.SetTransform(Translation(-0.5, 1, 0.5));
+  Material glassMat;
+  glassMat.SetReflective(1.0);
+  glassMat.SetTransparency(1.0);
+  glassMat.SetRefractiveIndex(1.5);
+  glass.SetMaterial(glassMat);
+  world.AddObject(glass);
+
+  // Red diffuse sphere, bleeding color onto the floor
+  Sphere red;
+  red.SetTransform(Translation(1.5, 0.5, -0.5) * Scaling(0.5, 0.5, 0.5));
+  Material redMat;
+  redMat.SetColor(Color(0.9, 0.1, 0.1));
+  red.SetMaterial(redMat);
+  world.AddObject(red);
+
+  // Partially mirrored sphere in the back
+  Sphere mirror;
+  mirror.SetTransform(Translation(-2, 0.6, 2.5) * Scaling(0.6, 0.6, 0.6));
+  Material mirrorMat;
+  mirrorMat.SetColor(Color(0.2, 0.4, 0.9));
+  mirrorMat.SetReflective(0.5);
+  mirror.SetMaterial(mirrorMat);
+  world.AddObject(mirror);
+
+  Camera camera(WIDTH, HEIGHT, M_PI/3);
+  camera.SetTransform(ViewTransform(Point(0, 1.5, -5), Point(0, 1, 0), Vector(0, 1, 0)));
+
+  // Render the reference image with an independent seed
+  PathTracerOptions refOptions;
+  refOptions.samplesPerPass = REFERENCE_SPP;
+  refOptions.seed = 12345;
+  PathTracer reference(world, camera, refOptions);
+  RenderPassStats refStats;
+  {
+    RenderStatsPhase phase("reference");
+    refStats = reference.RenderPass();
+  }
+  printf("Reference: %d spp in %.2f s (%.0f samples/sec, %d threads)\n",
+         refStats.samplesPerPixel, refStats.seconds,
+         refStats.SamplesPerSecond(), reference.NumThreads());
+
+  // Progressively refine the image one sample per pixel at a time
+  PathTracerOptions options;
+  PathTracer tracer(world, camera, options);
+  {
+    RenderStatsPhase phase("render");
+    for (int pass = 0; pass < PASSES; ++pass) {
+      const RenderPassStats PASS = tracer.RenderPass();
+      const float ERROR = RMSE(tracer.Buffer(), reference.Buffer());
+      printf("Pass %2d: %4d spp  %10.0f samples/sec  RMSE %.5f\n",
+             pass + 1, tracer.Buffer().Samples(), PASS.SamplesPerSecond(), ERROR);
+    }
+  }
+
+  const RenderPassStats &TOTAL = tracer.TotalStats();
+  printf("Total: %lld samples in %.2f s (%.0f samples/sec)\n",
+         TOTAL.samples, TOTAL.seconds, TOTAL.SamplesPerSecond());
+
+  {
+    RenderStatsPhase phase("output");
+    Canvas canvas(WIDTH, HEIGHT);
+    tracer.Buffer().ResolveTo(canvas);
+
+    // The lights are bright enough to blow out a plain clamp, so tone map
+    TileScheduler scheduler;
+    DisplayImage image;
+    ToneMap(canvas, ToneMapOptions(), scheduler, image);
+    if (!WritePng(image, "pathtracer.png", PngOptions(), scheduler)) {
+      fprintf(stderr, "Failed to write pathtracer.png\n");
+      return 1;
+    }
+
+    // Half float EXR keeps the values above 1.0 that the PNG compresses
+    if (!WriteExr(canvas, "pathtracer.exr", ExrOptions(), scheduler)) {
+      fprintf(stderr, "Failed to write pathtracer.exr\n");
+      return 1;
+    }
+  }
+
+  if (TRACE_FILE) {
+    StopFrameTrace();
+    if (!WriteChromeTrace(TRACE_FILE)) {
+      fprintf(stderr, "Failed to write %s\n", TRACE_FILE);
+      return 1;
+    }
+  }
+  ReportRenderStats();
+  return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * preview.cpp
+ *
+ * Renders a scene progressively within a time budget, printing each pass as
+ * it finishes, and writes whatever was finished to preview.ppm.
+ *
+ * Usage: Preview [budget in ms] [scene] [width] [height]
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Scenes.h"
+#include "Camera.h"
+#include "Canvas.h"
+#include "ProgressiveRenderer.h"
+#include "TileScheduler.h"
+#include "RenderStats.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+int main(int argc, char **argv) {
+  const int BUDGET_MS      = (argc > 1) ? atoi(argv[1]) : 200;
+  const std::string NAME   = (argc > 2) ? argv[2] : "glassspheres";
+  const int WIDTH          = (argc > 3) ? atoi(argv[3]) : 400;
+  const int HEIGHT         = (argc > 4) ? atoi(argv[4]) : 200;
+
+  Scene scene;
+  {
+    RenderStatsPhase phase("setup");
+    if (!BuildScene(NAME, scene)) {
+      fprintf(stderr, "Unknown scene: %s\n", NAME.c_str());
+      return 1;
+    }
+  }
+  const Camera CAMERA = SceneCamera(scene, WIDTH, HEIGHT);
+
+  TileScheduler scheduler;
+  ProgressiveRenderer renderer(scene.world, CAMERA, scheduler);
+  ProgressiveResult result;
+  {
+    RenderStatsPhase phase("render");
+    result = renderer.Render(BUDGET_MS / 1000.0, [](const ProgressiveUpdate &update) {
+      printf("Pass %d: block %d, %d spp, %s at %.1f ms\n", update.pass, update.blockSize,
+             update.samplesPerPixel, update.complete ? "complete" : "interrupted",
+             update.elapsedSeconds * 1000.0);
+    });
+  }
+
+  printf("%d passes in %.1f ms (%s)\n", result.passesCompleted, result.seconds * 1000.0,
+         result.finished ? "finished" : "out of time");
+
+  // Write canvas to file
+  {
+    RenderStatsPhase phase("output");
+    Canvas canvas(WIDTH, HEIGHT);
+    renderer.Snapshot(canvas);
+    canvas.WriteToPPM("preview.ppm");
+  }
+  ReportRenderStats();
+  return 0;
+}
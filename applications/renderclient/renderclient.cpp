@@ -0,0 +1,55 @@
+/*
+ * renderclient.cpp
+ *
+ * Sends a render job to a running RenderDaemon and writes the result.
+ *
+ * Usage: RenderClient <socket path> <scene> <width> <height> [output.ppm]
+ *        RenderClient <socket path> --shutdown
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Canvas.h"
+#include "RenderClient.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+int main(int argc, char **argv) {
+  if (argc == 3 && std::string(argv[2]) == "--shutdown") {
+    return RequestShutdown(argv[1]) ? 0 : 1;
+  }
+
+  if (argc < 5) {
+    fprintf(stderr, "Usage: %s <socket> <scene> <width> <height> [output.ppm]\n", argv[0]);
+    fprintf(stderr, "       %s <socket> --shutdown\n", argv[0]);
+    return 1;
+  }
+
+  RenderJob job;
+  job.scene  = argv[2];
+  job.width  = atoi(argv[3]);
+  job.height = atoi(argv[4]);
+  const std::string OUTPUT = (argc > 5) ? argv[5] : "render.ppm";
+
+  Canvas canvas(job.width, job.height);
+  int tiles = 0;
+  std::string error;
+
+  const std::chrono::steady_clock::time_point START = std::chrono::steady_clock::now();
+  const bool SUCCESS = RequestRender(argv[1], job, canvas, error,
+                                     [&tiles](const Tile &) { ++tiles; });
+  const double SECONDS = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - START).count();
+
+  if (!SUCCESS) {
+    fprintf(stderr, "Render failed: %s\n", error.c_str());
+    return 1;
+  }
+
+  printf("Received %d tiles in %.1f ms\n", tiles, SECONDS * 1000.0);
+  canvas.WriteToPPM(OUTPUT.c_str());
+  return 0;
+}
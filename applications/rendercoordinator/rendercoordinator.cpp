@@ -0,0 +1,78 @@
+/*
+ * rendercoordinator.cpp
+ *
+ * Renders a frame on RenderWorker processes.  Start the coordinator, then
+ * start any number of workers (on this or other hosts) pointing at it:
+ *
+ *   RenderCoordinator 5555 glassspheres 800 400 &
+ *   RenderWorker localhost 5555 &
+ *   RenderWorker localhost 5555 &
+ *
+ * Usage: RenderCoordinator <port> <scene> <width> <height> [output.ppm] [bind address]
+ *
+ * The coordinator only listens on 127.0.0.1 unless given a bind address
+ * (e.g. 0.0.0.0 for workers on other hosts).  If RENDER_JOB_TOKEN is set,
+ * only workers started with the same RENDER_JOB_TOKEN are accepted; it must
+ * be set to listen on anything but loopback.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Canvas.h"
+#include "DistributedRender.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+int main(int argc, char **argv) {
+  if (argc < 5) {
+    fprintf(stderr, "Usage: %s <port> <scene> <width> <height> [output.ppm] [bind address]\n",
+            argv[0]);
+    return 1;
+  }
+
+  RenderJob job;
+  job.scene  = argv[2];
+  job.width  = atoi(argv[3]);
+  job.height = atoi(argv[4]);
+  const std::string OUTPUT = (argc > 5) ? argv[5] : "distributed.ppm";
+  const std::string BIND_ADDRESS = (argc > 6) ? argv[6] : "127.0.0.1";
+  const char *TOKEN = getenv("RENDER_JOB_TOKEN");
+
+  // The same limits the workers apply, before the canvas is allocated
+  std::string error;
+  if (!ValidateJob(job, error)) {
+    fprintf(stderr, "Cannot render the job: %s\n", error.c_str());
+    return 1;
+  }
+
+  if ((!TOKEN || !*TOKEN) && !IsLoopbackAddress(BIND_ADDRESS)) {
+    fprintf(stderr, "Set RENDER_JOB_TOKEN to listen on %s\n", BIND_ADDRESS.c_str());
+    return 1;
+  }
+
+  RenderCoordinator coordinator(atoi(argv[1]), BIND_ADDRESS, TOKEN ? TOKEN : "");
+  if (!coordinator.Listen()) {
+    fprintf(stderr, "Cannot listen on %s port %s\n", BIND_ADDRESS.c_str(), argv[1]);
+    return 1;
+  }
+  printf("Waiting for workers on %s port %d\n", BIND_ADDRESS.c_str(), coordinator.Port());
+  fflush(stdout);
+
+  Canvas canvas(job.width, job.height);
+  DistributedStats stats;
+  const bool SUCCESS = coordinator.Render(job, canvas, CoordinatorOptions(), stats);
+  coordinator.Shutdown();
+
+  printf("%d tiles in %.1f ms on %d workers (%d re-issued ranges, %d duplicate tiles, %d workers lost)\n",
+         stats.tiles, stats.seconds * 1000.0, stats.workers, stats.reissuedRanges,
+         stats.duplicateTiles, stats.workersLost);
+  if (!SUCCESS) {
+    fprintf(stderr, "Render timed out\n");
+    return 1;
+  }
+
+  canvas.WriteToPPM(OUTPUT.c_str());
+  return 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * renderdaemon.cpp
+ *
+ * Long-lived render server.  Keeps scenes and worker threads warm between
+ * jobs and streams tiles back to clients over a Unix domain socket.
+ *
+ * Usage: RenderDaemon [socket path] [threads]
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "RenderServer.h"
+#include "RenderStats.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+int main(int argc, char **argv) {
+  const std::string PATH = (argc > 1) ? argv[1] : "/tmp/renderd.sock";
+  const int THREADS      = (argc > 2) ? atoi(argv[2]) : 0;
+
+  RenderServer server(PATH, THREADS);
+  if (!server.Listen()) {
+    fprintf(stderr, "Cannot listen on %s\n", PATH.c_str());
+    return 1;
+  }
+
+  printf("Serving on %s with %d threads\n", PATH.c_str(), server.NumThreads());
+  fflush(stdout);
+  server.Serve();
+
+  printf("Shut down after %d jobs\n", server.JobsServed());
+  ReportRenderStats();
+  return 0;
+}
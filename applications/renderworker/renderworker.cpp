@@ -0,0 +1,37 @@
+/*
+ * renderworker.cpp
+ *
+ * Worker process for distributed rendering.  Connects to a
+ * RenderCoordinator and renders the tiles it assigns until told to stop.
+ *
+ * Usage: RenderWorker <host> <port> [threads]
+ *
+ * Set RENDER_JOB_TOKEN to the coordinator's job token, if it has one.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "DistributedRender.h"
+#include "RenderStats.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s <host> <port> [threads]\n", argv[0]);
+    return 1;
+  }
+
+  const char *TOKEN = getenv("RENDER_JOB_TOKEN");
+
+  RenderWorker worker((argc > 3) ? atoi(argv[3]) : 0);
+  if (!worker.Run(argv[1], atoi(argv[2]), TOKEN ? TOKEN : "")) {
+    fprintf(stderr, "Cannot work for %s:%s\n", argv[1], argv[2]);
+    return 1;
+  }
+
+  printf("Rendered %d tiles\n", worker.TilesRendered());
+  ReportRenderStats();
+  return 0;
+}
@@ -6,7 +6,7 @@
  * sphere will be marked black.
  *
  * The sphere will be lit using the Phong Lighting Model to create
- * 3D shading.
+ * 3D shading.  Edges are smoothed with adaptive anti-aliasing.
  *
  * Bryant Pong
  * 12/28/19
@@ -15,6 +15,11 @@
 #include "RaySphere.h"
 #include "Canvas.h"
 #include "Lighting.h"
+#include "AntiAliasing.h"
+#include "TileScheduler.h"
+#include "RenderStats.h"
+
+#include <cstdio>
 
 int main(void) {
   // Ray's origin:
@@ -63,43 +68,56 @@ int main(void) {
   const Color LIGHT_COLOR(1, 1, 1);
   const PointLight POINT_LIGHT(LIGHT_POS, LIGHT_COLOR);
 
-  // Red Color to mark rays that hit the sphere
-  const Color RED(1, 0, 0);
-
-  // Iterate through the canvas and cast rays + check for hits
-  for (int y = 0; y < CANVAS_PIXELS; ++y) {
-    // Compute World Y-coordinate (y > 0 = +half; y < 0 = -half)
+  /*
+   * Computes the color seen through the continuous canvas coordinate (x, y).
+   * Pixel (x, y) covers [x, x+1) x [y, y+1), so the anti-aliasing pass can
+   * place several samples inside of it.
+   */
+  const SampleFunction SAMPLE = [&](const float x, const float y, int &objectID) {
+    // Compute World X/Y-coordinates (y > 0 = +half; y < 0 = -half)
     const float WORLD_Y = HALF - WORLD_TO_CANVAS * y;
+    const float WORLD_X = -HALF + WORLD_TO_CANVAS * x;
 
-    for (int x = 0; x < CANVAS_PIXELS; ++x) {
-      // Compute World X-coordinate (x > 0 = +half; x < 0 = -half)
-      const float WORLD_X = -HALF + WORLD_TO_CANVAS * x;
+    // Compute the point on the wall the ray will target
+    const Tuple WALL_PT = Point(WORLD_X, WORLD_Y, WALL_Z);
 
-      // Compute the point on the wall the ray will target
-      const Tuple WALL_PT = Point(WORLD_X, WORLD_Y, WALL_Z);
+    // Construct the ray from the origin to the wall
+    const Tuple DIRECTION = Normalize(WALL_PT - RAY_ORIGIN);
+    const Ray ray(RAY_ORIGIN, DIRECTION);
 
-      // Construct the ray from the origin to the wall
-      const Tuple DIRECTION = Normalize(WALL_PT - RAY_ORIGIN);
-      const Ray ray(RAY_ORIGIN, DIRECTION);
+    // Check for intersections
+    const std::vector<Intersection> XS = Intersect(SPHERE, ray);
+    const Intersection HIT = Hit(XS);
 
-      // Check for intersections
-      const std::vector<Intersection> XS = Intersect(SPHERE, ray);
-      const Intersection HIT = Hit(XS);
+    // If it's a hit, shade it
+    if (HIT.T() != FLT_MAX) {
+      const Tuple POINT = Position(ray, HIT.T());
+      const Tuple NORMAL = SPHERE.NormalAt(POINT);
+      const Tuple EYE = -ray.Direction();
 
-      // If it's a hit, mark as red
-      if (HIT.T() != FLT_MAX) {
-        const Tuple POINT = Position(ray, HIT.T());
-        const Tuple NORMAL = SPHERE.NormalAt(POINT);
-        const Tuple EYE = -ray.Direction();
+      objectID = SPHERE.ID();
+      return Lighting(SPHERE.GetMaterial(), POINT_LIGHT, POINT, EYE, NORMAL);
+    }
 
-        const Color FINAL_COLOR = Lighting(SPHERE.GetMaterial(), POINT_LIGHT, POINT, EYE, NORMAL);
+    objectID = NO_OBJECT_ID;
+    return Color(0, 0, 0);
+  };
 
-        canvas.WritePixel(x, y, FINAL_COLOR);
-      }
-    }
+  // Render with adaptive anti-aliasing: extra samples only along the silhouette
+  TileScheduler scheduler;
+  AntiAliasStats stats;
+  {
+    RenderStatsPhase phase("render");
+    stats = RenderAdaptive(SAMPLE, canvas, AntiAliasOptions(), scheduler);
   }
+  printf("Average samples per pixel: %.2f (%lld of %lld pixels refined)\n",
+         stats.AverageSamplesPerPixel(), stats.refinedPixels, stats.pixels);
 
   // Write canvas to file
-  canvas.WriteToPPM("shadedsphere.ppm");
+  {
+    RenderStatsPhase phase("output");
+    canvas.WriteToPPM("shadedsphere.ppm");
+  }
+  ReportRenderStats();
   return 0;
 }
@@ -11,6 +11,7 @@
 #include "Tuple.h"
 #include "RaySphere.h"
 #include "Canvas.h"
+#include "RenderStats.h"
 
 int main(void) {
   // Ray's origin:
@@ -81,5 +82,6 @@ int main(void) {
 
   // Write canvas to file
   canvas.WriteToPPM("spherecast.ppm");
+  ReportRenderStats();
   return 0;
 }
@@ -0,0 +1,78 @@
+/*
+ * turntable.cpp
+ *
+ * Renders an animated sequence of the glass spheres scene: the mirrored
+ * sphere orbits the glass sphere, which bobs up and down.  Frames are
+ * written to turntable_NNN.ppm in the background while later frames trace.
+ *
+ * Usage: Turntable [frames] [width] [height]
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Scenes.h"
+#include "Camera.h"
+#include "Animation.h"
+#include "SequenceRenderer.h"
+#include "AsyncImageWriter.h"
+#include "TileScheduler.h"
+#include "RenderStats.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char **argv) {
+  const int FRAMES = (argc > 1) ? atoi(argv[1]) : 8;
+  const int WIDTH  = (argc > 2) ? atoi(argv[2]) : 200;
+  const int HEIGHT = (argc > 3) ? atoi(argv[3]) : 100;
+
+  Scene scene;
+  BuildScene("glassspheres", scene);
+
+  // Mirrored sphere (object 2): one orbit around the glass sphere
+  TransformTrack orbit;
+  const int ORBIT_KEYS = 8;
+  for (int i = 0; i <= ORBIT_KEYS; ++i) {
+    const float ANGLE = 2 * M_PI * i / ORBIT_KEYS;
+    orbit.AddKey(Keyframe(static_cast<float>(i) / ORBIT_KEYS,
+                          Vector(-0.5 + 2 * cosf(ANGLE), 0.5, 0.5 - 2 * sinf(ANGLE)),
+                          Vector(0, 0, 0), Vector(0.5, 0.5, 0.5)));
+  }
+
+  // Glass sphere (object 1): up and back down
+  TransformTrack bob;
+  bob.AddKey(Keyframe(0.0, Vector(-0.5, 1, 0.5), Vector(0, 0, 0), Vector(1, 1, 1)));
+  bob.AddKey(Keyframe(0.5, Vector(-0.5, 1.5, 0.5), Vector(0, 0, 0), Vector(1, 1, 1)));
+  bob.AddKey(Keyframe(1.0, Vector(-0.5, 1, 0.5), Vector(0, 0, 0), Vector(1, 1, 1)));
+
+  Animation animation;
+  animation.AddTrack(2, orbit);
+  animation.AddTrack(1, bob);
+
+  SequenceOptions options;
+  options.frames = FRAMES;
+
+  TileScheduler scheduler;
+  AsyncImageWriter writer(WIDTH, HEIGHT);
+  SequenceRenderer renderer(scene.world, animation, SceneCamera(scene, WIDTH, HEIGHT),
+                            scheduler, options);
+
+  bool written = false;
+  SequenceStats stats;
+  {
+    RenderStatsPhase phase("sequence");
+    stats = renderer.Render(writer, "turntable_%03d.ppm", written);
+  }
+  if (!written) {
+    fprintf(stderr, "Some frames could not be written\n");
+  }
+
+  printf("%d frames in %.2f s (%.2f frames/s)\n", stats.frames, stats.seconds,
+         stats.FramesPerSecond());
+  printf("Setup %.2f s, trace %.2f s, waiting on output %.2f s (tracing %.0f%% of wall time)\n",
+         stats.setupSeconds, stats.traceSeconds, stats.outputWaitSeconds,
+         stats.TraceFraction() * 100.0);
+  ReportRenderStats();
+  return written ? 0 : 1;
+}
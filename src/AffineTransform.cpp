@@ -0,0 +1,86 @@
+/*
+ * AffineTransform.cpp
+ *
+ * Conversions from Matrix and application of affine transforms to tuples.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "AffineTransform.h"
+
+/**
+ * @brief  Whether a Matrix is a 4x4 affine transform.
+ */
+bool IsAffine(const Matrix &mat) {
+  return mat.GetRows() == 4 && mat.GetCols() == 4 &&
+         mat.GetValue(3, 0) == 0 && mat.GetValue(3, 1) == 0 &&
+         mat.GetValue(3, 2) == 0 && mat.GetValue(3, 3) == 1;
+}
+
+/**
+ * @brief  The affine transform of a 4x4 Matrix (see IsAffine()).
+ */
+AffineTransform ToAffine(const Matrix &mat) {
+  assert(mat.GetRows() == 4 && mat.GetCols() == 4);
+  AffineTransform result;
+  for (int y = 0; y < 3; ++y) {
+    for (int x = 0; x < 4; ++x) {
+      result.SetValue(y, x, mat.GetValue(y, x));
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief  Applies the transform to a point (w = 1) or vector (w = 0).
+ *         w passes through unchanged.
+ */
+Tuple operator*(const AffineTransform &affine, const Tuple &tuple) {
+  const float X = tuple.X(), Y = tuple.Y(), Z = tuple.Z(), W = tuple.W();
+  return Tuple(affine.GetValue(0, 0) * X + affine.GetValue(0, 1) * Y +
+               affine.GetValue(0, 2) * Z + affine.GetValue(0, 3) * W,
+               affine.GetValue(1, 0) * X + affine.GetValue(1, 1) * Y +
+               affine.GetValue(1, 2) * Z + affine.GetValue(1, 3) * W,
+               affine.GetValue(2, 0) * X + affine.GetValue(2, 1) * Y +
+               affine.GetValue(2, 2) * Z + affine.GetValue(2, 3) * W,
+               W);
+}
+
+/**
+ * @brief  Applies the transform to a point, including the translation.
+ */
+Tuple TransformPoint(const AffineTransform &affine, const Tuple &pt) {
+  const float X = pt.X(), Y = pt.Y(), Z = pt.Z();
+  return Point(affine.GetValue(0, 0) * X + affine.GetValue(0, 1) * Y +
+               affine.GetValue(0, 2) * Z + affine.GetValue(0, 3),
+               affine.GetValue(1, 0) * X + affine.GetValue(1, 1) * Y +
+               affine.GetValue(1, 2) * Z + affine.GetValue(1, 3),
+               affine.GetValue(2, 0) * X + affine.GetValue(2, 1) * Y +
+               affine.GetValue(2, 2) * Z + affine.GetValue(2, 3));
+}
+
+/**
+ * @brief  Applies the linear part of the transform to a vector.
+ */
+Tuple TransformVector(const AffineTransform &affine, const Tuple &vec) {
+  const float X = vec.X(), Y = vec.Y(), Z = vec.Z();
+  return Vector(affine.GetValue(0, 0) * X + affine.GetValue(0, 1) * Y + affine.GetValue(0, 2) * Z,
+                affine.GetValue(1, 0) * X + affine.GetValue(1, 1) * Y + affine.GetValue(1, 2) * Z,
+                affine.GetValue(2, 0) * X + affine.GetValue(2, 1) * Y + affine.GetValue(2, 2) * Z);
+}
+
+/**
+ * @brief  Transforms an object space normal to world space.
+ * @param inverse: The INVERSE of the object's transform
+ * @param normal: Object space normal
+ * @return Tuple: World space normal (not normalized)
+ *
+ * This is transpose(inverse) * normal; the transpose of the translation
+ * column only lands in w, which is zero for a vector anyway.
+ */
+Tuple TransformNormal(const AffineTransform &inverse, const Tuple &normal) {
+  const float X = normal.X(), Y = normal.Y(), Z = normal.Z();
+  return Vector(inverse.GetValue(0, 0) * X + inverse.GetValue(1, 0) * Y + inverse.GetValue(2, 0) * Z,
+                inverse.GetValue(0, 1) * X + inverse.GetValue(1, 1) * Y + inverse.GetValue(2, 1) * Z,
+                inverse.GetValue(0, 2) * X + inverse.GetValue(1, 2) * Y + inverse.GetValue(2, 2) * Z);
+}
@@ -0,0 +1,43 @@
+/*
+ * Animation.cpp
+ *
+ * Keyframe interpolation for animated transforms.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Animation.h"
+
+/**
+ * @brief  Linearly interpolates between two keyframes.
+ * @param time: Time to interpolate at, between a.time and b.time
+ */
+Keyframe InterpolateKeyframes(const Keyframe &a, const Keyframe &b, const float time) {
+  const float SPAN = b.time - a.time;
+  const float T = (SPAN > 0) ? (time - a.time) / SPAN : 0.0f;
+
+  return Keyframe(time,
+                  a.translation + (b.translation - a.translation) * T,
+                  a.rotation    + (b.rotation    - a.rotation)    * T,
+                  a.scale       + (b.scale       - a.scale)       * T);
+}
+
+/**
+ * @brief  Composes a keyframe into a transform and its inverse: scale, then
+ *         rotate about x, y, and z, then translate.
+ */
+TransformBuilder KeyframeBuilder(const Keyframe &key) {
+  return TransformBuilder().Scale(key.scale.X(), key.scale.Y(), key.scale.Z())
+                           .RotX(key.rotation.X())
+                           .RotY(key.rotation.Y())
+                           .RotZ(key.rotation.Z())
+                           .Translate(key.translation.X(), key.translation.Y(),
+                                      key.translation.Z());
+}
+
+/**
+ * @brief  The transform of a keyframe (see KeyframeBuilder()).
+ */
+Matrix KeyframeTransform(const Keyframe &key) {
+  return KeyframeBuilder(key).ForwardMatrix();
+}
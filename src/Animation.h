@@ -0,0 +1,133 @@
+#ifndef __ANIMATION_H_
+#define __ANIMATION_H_
+/*
+ * Animation.h
+ *
+ * Keyframed object transforms.  Each keyframe stores a translation, a
+ * rotation (as angles about x, y, and z), and a scale; values between
+ * keyframes are interpolated linearly and composed into a transform.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "Matrix.h"
+#include "Transformations.h"
+#include "TransformBuilder.h"
+#include "World.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief  The pose of an object at a point in time.
+ */
+struct Keyframe {
+  Keyframe() :
+    time(0), translation(Vector(0, 0, 0)), rotation(Vector(0, 0, 0)), scale(Vector(1, 1, 1)) {
+  }
+
+  Keyframe(const float t, const Tuple &trans, const Tuple &rot, const Tuple &scl) :
+    time(t), translation(trans), rotation(rot), scale(scl) {
+  }
+
+  float time;
+  Tuple translation;
+
+  // Rotations (in radians) about x, then y, then z
+  Tuple rotation;
+
+  Tuple scale;
+};
+
+// Function Prototypes
+Keyframe InterpolateKeyframes(const Keyframe &, const Keyframe &, const float);
+TransformBuilder KeyframeBuilder(const Keyframe &);
+Matrix KeyframeTransform(const Keyframe &);
+
+/**
+ * @brief  TransformTrack class.  A sequence of keyframes for one object.
+ */
+class TransformTrack {
+public:
+  /**
+   * @brief Adds a keyframe, keeping the keyframes sorted by time.
+   */
+  void AddKey(const Keyframe &key) {
+    std::vector<Keyframe>::iterator pos = std::upper_bound(
+      keys_.begin(), keys_.end(), key,
+      [](const Keyframe &a, const Keyframe &b) { return a.time < b.time; });
+    keys_.insert(pos, key);
+  }
+
+  /**
+   * @brief Computes the pose at a point in time.  Times before the first or
+   *        after the last keyframe hold that keyframe's pose.
+   */
+  Keyframe Evaluate(const float time) const {
+    if (keys_.empty()) {
+      return Keyframe();
+    }
+    if (time <= keys_.front().time) {
+      return keys_.front();
+    }
+    if (time >= keys_.back().time) {
+      return keys_.back();
+    }
+
+    size_t next = 1;
+    while (keys_[next].time < time) {
+      ++next;
+    }
+    return InterpolateKeyframes(keys_[next - 1], keys_[next], time);
+  }
+
+  /**
+   * @brief Computes the transform at a point in time.
+   */
+  Matrix TransformAt(const float time) const {
+    return KeyframeTransform(Evaluate(time));
+  }
+
+  // Accessor functions
+  size_t NumKeys() const { return keys_.size(); }
+
+private:
+  std::vector<Keyframe> keys_;
+};
+
+/**
+ * @brief  Animation class.  Transform tracks for objects of a world.
+ */
+class Animation {
+public:
+  /**
+   * @brief Animates world.Objects()[objectIndex] with the track.
+   */
+  void AddTrack(const size_t objectIndex, const TransformTrack &track) {
+    objectIndices_.push_back(objectIndex);
+    tracks_.push_back(track);
+  }
+
+  /**
+   * @brief Poses every animated object of the world at a point in time.
+   */
+  void Apply(World &world, const float time) const {
+    std::vector<Sphere> &objects = world.Objects();
+    for (size_t i = 0; i < tracks_.size(); ++i) {
+      if (objectIndices_[i] < objects.size()) {
+        // The builder's inverse saves inverting every object every frame
+        objects[objectIndices_[i]].SetTransform(KeyframeBuilder(tracks_[i].Evaluate(time)));
+      }
+    }
+  }
+
+  // Accessor functions
+  size_t NumTracks() const { return tracks_.size(); }
+
+private:
+  // Index of the animated object and its track
+  std::vector<size_t> objectIndices_;
+  std::vector<TransformTrack> tracks_;
+};
+#endif
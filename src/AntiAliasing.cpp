@@ -0,0 +1,213 @@
+/*
+ * AntiAliasing.cpp
+ *
+ * Supersampled and adaptive rendering of a World onto a Canvas.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "AntiAliasing.h"
+
+/**
+ * @brief  Shades a primary ray and reports which object it hit.
+ */
+Color TraceSample(const World &world, const Ray &ray, int &objectID) {
+  const std::vector<Intersection> XS = IntersectWorld(world, ray);
+  const Intersection HIT = Hit(XS);
+
+  if (HIT.T() == FLT_MAX) {
+    objectID = NO_OBJECT_ID;
+    return Color(0, 0, 0);
+  }
+
+  objectID = HIT.Object().ID();
+  return ShadeHit(world, PrepareComputations(HIT, ray, XS), 0, 1.0);
+}
+
+/**
+ * @brief  Checks if any channel of the two colors differs by more than the
+ *         threshold.
+ */
+bool ColorsDiffer(const Color &a, const Color &b, const float threshold) {
+  return std::fabs(a.Red()   - b.Red())   > threshold ||
+         std::fabs(a.Green() - b.Green()) > threshold ||
+         std::fabs(a.Blue()  - b.Blue())  > threshold;
+}
+
+/**
+ * @brief  Splits a square region that already has one sample into four
+ *         quadrants and recursively splits quadrants while their samples
+ *         disagree.  The region's own sample lies on the corner the four
+ *         quadrants share and is reused for the quadrant facing the center
+ *         of the parent region, so the offsets of the reused samples cancel
+ *         out across a fully split parent.  Each split takes 3 new samples,
+ *         so a region never takes more samples than it has cells at the
+ *         finest depth.
+ * @param x0, y0: Top left corner of the region
+ * @param size: Edge length of the region
+ * @param depth: Number of subdivisions that produced this region
+ * @param quadrant: Which quadrant of its parent the region is (0-3, in
+ *                  scanline order)
+ * @param color, id: The sample the region already has
+ * @param samples: Incremented by the number of samples taken
+ * @return Color: Average color over the region
+ */
+Color SampleRegion(const SampleFunction &fn, const float x0, const float y0,
+                   const float size, const int depth, const int quadrant,
+                   const Color &color, const int id,
+                   const AntiAliasOptions &options, long long &samples) {
+  const float HALF = size / 2;
+  const int REUSED = 3 - quadrant;
+  Color colors[4];
+  int ids[4];
+
+  for (int q = 0; q < 4; ++q) {
+    if (q == REUSED) {
+      colors[q] = color;
+      ids[q]    = id;
+      continue;
+    }
+    const float QX = x0 + (q % 2) * HALF;
+    const float QY = y0 + (q / 2) * HALF;
+    colors[q] = fn(QX + HALF / 2, QY + HALF / 2, ids[q]);
+  }
+  samples += 3;
+
+  Color sum;
+  for (int q = 0; q < 4; ++q) {
+    if (depth < options.maxSubdivisions) {
+      // A quadrant is split if it disagrees with any of its siblings
+      bool differs = false;
+      for (int other = 0; other < 4 && !differs; ++other) {
+        differs = (ids[q] != ids[other]) ||
+                  ColorsDiffer(colors[q], colors[other], options.contrastThreshold);
+      }
+
+      if (differs) {
+        const float QX = x0 + (q % 2) * HALF;
+        const float QY = y0 + (q / 2) * HALF;
+        sum += SampleRegion(fn, QX, QY, HALF, depth + 1, q, colors[q], ids[q], options,
+                            samples);
+        continue;
+      }
+    }
+    sum += colors[q];
+  }
+
+  return sum * 0.25;
+}
+
+/**
+ * @brief  Renders a canvas with adaptive supersampling.
+ *
+ *         Pass 1 takes four samples per pixel.  Pass 2 refines every pixel
+ *         whose own samples disagree or that differs from one of its four
+ *         neighbours, in color (by more than the contrast threshold) or in
+ *         the ID of the object hit.  A refined pixel splits each quadrant,
+ *         reusing the quadrant's pass 1 sample.
+ *
+ * @return AntiAliasStats: Sample counts, including the average samples per pixel
+ */
+AntiAliasStats RenderAdaptive(const SampleFunction &fn, Canvas &canvas,
+                              const AntiAliasOptions &options,
+                              TileScheduler &scheduler) {
+  TRACE_SCOPE("RenderAdaptive");
+  const int WIDTH  = canvas.GetWidth();
+  const int HEIGHT = canvas.GetHeight();
+  const std::vector<Tile> TILES = MakeTiles(WIDTH, HEIGHT, std::max(1, options.tileSize));
+
+  // Per-pixel results of the first pass, and the samples of every quadrant
+  std::vector<Color> colors(WIDTH * HEIGHT);
+  std::vector<int> ids(WIDTH * HEIGHT);
+  std::vector<char> mixed(WIDTH * HEIGHT);
+  std::vector<Color> quadrantColors(4 * WIDTH * HEIGHT);
+  std::vector<int> quadrantIDs(4 * WIDTH * HEIGHT);
+
+  std::atomic<long long> totalSamples(0), refinedPixels(0);
+
+  // Pass 1: one sample in each quadrant
+  scheduler.Run(TILES, [&](const Tile &tile, const int) {
+    for (int y = tile.y0; y < tile.y1; ++y) {
+      for (int x = tile.x0; x < tile.x1; ++x) {
+        const int INDEX = y * WIDTH + x;
+        Color *quadrant = &quadrantColors[4 * INDEX];
+        int *quadrantID = &quadrantIDs[4 * INDEX];
+        for (int q = 0; q < 4; ++q) {
+          quadrant[q] = fn(x + 0.25f + 0.5f * (q % 2), y + 0.25f + 0.5f * (q / 2), quadrantID[q]);
+        }
+
+        bool isMixed = false;
+        for (int q = 1; q < 4; ++q) {
+          isMixed = isMixed || (quadrantID[q] != quadrantID[0]) ||
+                    ColorsDiffer(quadrant[q], quadrant[0], options.contrastThreshold);
+        }
+
+        colors[INDEX] = (quadrant[0] + quadrant[1] + quadrant[2] + quadrant[3]) * 0.25;
+        ids[INDEX]    = quadrantID[0];
+        mixed[INDEX]  = isMixed;
+      }
+    }
+    totalSamples += 4LL * (tile.x1 - tile.x0) * (tile.y1 - tile.y0);
+  });
+
+  // Pass 2: refine pixels along edges and write the canvas
+  scheduler.Run(TILES, [&](const Tile &tile, const int) {
+    long long tileSamples = 0, tileRefined = 0;
+
+    for (int y = tile.y0; y < tile.y1; ++y) {
+      for (int x = tile.x0; x < tile.x1; ++x) {
+        const int INDEX = y * WIDTH + x;
+        bool refine = mixed[INDEX] != 0;
+
+        const int NEIGHBOURS[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+        for (int n = 0; n < 4 && !refine; ++n) {
+          const int NX = x + NEIGHBOURS[n][0];
+          const int NY = y + NEIGHBOURS[n][1];
+          if (NX < 0 || NX >= WIDTH || NY < 0 || NY >= HEIGHT) {
+            continue;
+          }
+          const int N_INDEX = NY * WIDTH + NX;
+          refine = (ids[N_INDEX] != ids[INDEX]) ||
+                   ColorsDiffer(colors[N_INDEX], colors[INDEX], options.contrastThreshold);
+        }
+
+        Color result = colors[INDEX];
+        if (refine && options.maxSubdivisions > 0) {
+          // Split each quadrant, subdividing further where needed
+          Color sum;
+          for (int q = 0; q < 4; ++q) {
+            sum += SampleRegion(fn, x + 0.5f * (q % 2), y + 0.5f * (q / 2), 0.5f, 1, q,
+                                quadrantColors[4 * INDEX + q], quadrantIDs[4 * INDEX + q],
+                                options, tileSamples);
+          }
+          result = sum * 0.25;
+          ++tileRefined;
+        }
+
+        canvas.WritePixel(x, y, result);
+      }
+    }
+
+    totalSamples  += tileSamples;
+    refinedPixels += tileRefined;
+  });
+
+  AntiAliasStats stats;
+  stats.pixels        = static_cast<long long>(WIDTH) * HEIGHT;
+  stats.refinedPixels = refinedPixels;
+  stats.samples       = totalSamples;
+  return stats;
+}
+
+/**
+ * @brief  Renders the world through the camera with adaptive supersampling.
+ */
+AntiAliasStats RenderAdaptive(const Camera &camera, const World &world, Canvas &canvas,
+                              const AntiAliasOptions &options, TileScheduler &scheduler) {
+  const SampleFunction FN = [&camera, &world](const float x, const float y, int &objectID) {
+    const int PX = static_cast<int>(x);
+    const int PY = static_cast<int>(y);
+    return TraceSample(world, RayForPixel(camera, PX, PY, x - PX, y - PY), objectID);
+  };
+  return RenderAdaptive(FN, canvas, options, scheduler);
+}
@@ -0,0 +1,91 @@
+#ifndef __ANTI_ALIASING_H_
+#define __ANTI_ALIASING_H_
+/*
+ * AntiAliasing.h
+ *
+ * Adaptive supersampling.  Every pixel starts with one sample at the center
+ * of each of its four quadrants.  Pixels whose samples disagree, or that
+ * differ from a neighbouring pixel, in color or in the object that was hit
+ * are refined.  Refinement recursively subdivides only the quadrants that
+ * still disagree, so the extra samples are spent along edges instead of
+ * across the whole frame.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Color.h"
+#include "Canvas.h"
+#include "Camera.h"
+#include "World.h"
+#include "TileScheduler.h"
+#include "FrameTrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+// Object ID reported for samples that do not hit anything
+const int NO_OBJECT_ID = -1;
+
+/*
+ * Computes the color seen through the continuous canvas coordinate (x, y)
+ * and stores the ID of the object that was hit (or NO_OBJECT_ID) in
+ * objectID.  Pixel (px, py) covers [px, px+1) x [py, py+1).
+ */
+typedef std::function<Color(const float, const float, int &)> SampleFunction;
+
+/**
+ * @brief  Adaptive anti-aliasing settings
+ */
+struct AntiAliasOptions {
+  AntiAliasOptions() :
+    maxSubdivisions(2),
+    contrastThreshold(0.1),
+    tileSize(16) {
+  }
+
+  /*
+   * Number of times a quadrant may be split into four.  Pixels take 4
+   * samples without refinement and at most 4^(maxSubdivisions+1) with it.
+   */
+  int maxSubdivisions;
+
+  // Largest per-channel color difference that is not considered an edge
+  float contrastThreshold;
+
+  // Edge length of a tile in pixels
+  int tileSize;
+};
+
+/**
+ * @brief  Sample counts from an adaptive render.
+ */
+struct AntiAliasStats {
+  AntiAliasStats() : pixels(0), refinedPixels(0), samples(0) {
+  }
+
+  long long pixels;
+  long long refinedPixels;
+
+  // Calls of the sample function, at most 4^(maxSubdivisions+1) per pixel
+  long long samples;
+
+  double AverageSamplesPerPixel() const {
+    return (pixels > 0) ? static_cast<double>(samples) / pixels : 0.0;
+  }
+};
+
+// Function Prototypes
+Color TraceSample(const World &, const Ray &, int &);
+bool ColorsDiffer(const Color &, const Color &, const float);
+Color SampleRegion(const SampleFunction &, const float, const float, const float,
+                   const int, const int, const Color &, const int,
+                   const AntiAliasOptions &, long long &);
+AntiAliasStats RenderAdaptive(const SampleFunction &, Canvas &, const AntiAliasOptions &,
+                              TileScheduler &);
+AntiAliasStats RenderAdaptive(const Camera &, const World &, Canvas &,
+                              const AntiAliasOptions &, TileScheduler &);
+#endif
@@ -0,0 +1,229 @@
+#ifndef __ASYNC_IMAGE_WRITER_H_
+#define __ASYNC_IMAGE_WRITER_H_
+/*
+ * AsyncImageWriter.h
+ *
+ * Writes canvases to disk on background threads so that rendering does not
+ * wait on fopen/fwrite/fclose.  The writer owns a small pool of frame
+ * buffers: the renderer acquires a buffer, renders into it, and submits it
+ * with a file name.  Once the file is written the buffer returns to the
+ * pool.  If the writers fall behind, Acquire() blocks until a buffer is
+ * free, which holds the renderer back instead of queueing frames without
+ * bound.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Canvas.h"
+#include "BoundedQueue.h"
+#include "FrameTrace.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief  Asynchronous writer settings
+ */
+struct AsyncWriterOptions {
+  AsyncWriterOptions() : buffers(3), writers(1), sync(true) {
+  }
+
+  // Number of frame buffers in the pool (2 = double buffering)
+  int buffers;
+
+  // Number of writer threads
+  int writers;
+
+  // If set, each file is flushed to the storage device (fsync) before its
+  // buffer is released, so Flush() means the files are durable
+  bool sync;
+};
+
+/**
+ * @brief  AsyncImageWriter class
+ */
+class AsyncImageWriter {
+public:
+  /**
+   * @brief Constructor.  Allocates the buffers and starts the writer threads.
+   * @param width, height: Size of every buffer in the pool
+   */
+  AsyncImageWriter(const int width, const int height,
+                   const AsyncWriterOptions &options = AsyncWriterOptions()) :
+    options_(options),
+    requests_(std::max(1, options.buffers)),
+    pending_(0),
+    failures_(0),
+    filesWritten_(0),
+    stallSeconds_(0.0) {
+    for (int i = 0; i < std::max(1, options.buffers); ++i) {
+      buffers_.push_back(std::unique_ptr<Canvas>(new Canvas(width, height)));
+      free_.push_back(buffers_.back().get());
+    }
+
+    for (int i = 0; i < std::max(1, options.writers); ++i) {
+      writers_.push_back(std::thread(&AsyncImageWriter::WriterLoop, this));
+    }
+  }
+
+  /**
+   * @brief Destructor.  Finishes every submitted write and stops the writers.
+   */
+  ~AsyncImageWriter() {
+    requests_.Close();
+    for (size_t i = 0; i < writers_.size(); ++i) {
+      writers_[i].join();
+    }
+  }
+
+  /**
+   * @brief Takes a free buffer from the pool, waiting while every buffer is
+   *        being written.  The buffer must be passed to Submit() or Release().
+   *        Its contents are whatever was last written to it.
+   */
+  Canvas *Acquire() {
+    const std::chrono::steady_clock::time_point START = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    bufferFreed_.wait(lock, [this] { return !free_.empty(); });
+    Canvas *buffer = free_.back();
+    free_.pop_back();
+
+    stallSeconds_ += std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - START).count();
+    return buffer;
+  }
+
+  /**
+   * @brief Queues an acquired buffer to be written to a PPM file.  Returns
+   *        immediately; the buffer must not be used again by the caller.
+   */
+  void Submit(Canvas *buffer, const std::string &filename) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++pending_;
+    }
+
+    WriteRequest request;
+    request.buffer   = buffer;
+    request.filename = filename;
+    requests_.Push(request);
+  }
+
+  /**
+   * @brief Returns an acquired buffer to the pool without writing it.
+   */
+  void Release(Canvas *buffer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(buffer);
+    bufferFreed_.notify_one();
+  }
+
+  /**
+   * @brief Waits until every submitted file has been written (and synced to
+   *        the device if options.sync is set).
+   * @return bool: False if any write failed since the previous Flush()
+   */
+  bool Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    writesDone_.wait(lock, [this] { return pending_ == 0; });
+
+    const bool SUCCESS = (failures_ == 0);
+    failures_ = 0;
+    return SUCCESS;
+  }
+
+  // Accessor functions
+  int NumBuffers() const { return static_cast<int>(buffers_.size()); }
+  int FilesWritten() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return filesWritten_;
+  }
+
+  // Total time Acquire() has spent waiting for a free buffer
+  double StallSeconds() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stallSeconds_;
+  }
+
+private:
+  /**
+   * @brief  A buffer waiting to be written.
+   */
+  struct WriteRequest {
+    Canvas *buffer;
+    std::string filename;
+  };
+
+  /**
+   * @brief Body of each writer thread.
+   */
+  void WriterLoop() {
+    SetTraceThreadName("AsyncImageWriter");
+    WriteRequest request;
+    while (requests_.Pop(request)) {
+      const bool SUCCESS = WriteFile(*request.buffer, request.filename);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_.push_back(request.buffer);
+      --pending_;
+      failures_ += SUCCESS ? 0 : 1;
+      filesWritten_ += SUCCESS ? 1 : 0;
+      bufferFreed_.notify_one();
+      writesDone_.notify_all();
+    }
+  }
+
+  /**
+   * @brief Writes a canvas to a PPM file, syncing it if requested.
+   * @return bool: False if the file could not be written
+   */
+  bool WriteFile(const Canvas &canvas, const std::string &filename) const {
+    TRACE_SCOPE("AsyncImageWriter::WriteFile");
+    FILE *output = fopen(filename.c_str(), "wb");
+    if (!output) {
+      return false;
+    }
+
+    bool success = canvas.WritePPM(output) && fflush(output) == 0;
+    if (success && options_.sync) {
+      success = fsync(fileno(output)) == 0;
+    }
+    return (fclose(output) == 0) && success;
+  }
+
+  // The writer owns threads and buffers, so it cannot be copied
+  AsyncImageWriter(const AsyncImageWriter &);
+  AsyncImageWriter &operator=(const AsyncImageWriter &);
+
+  AsyncWriterOptions options_;
+
+  // Every buffer in the pool, and the ones not currently in use
+  std::vector<std::unique_ptr<Canvas> > buffers_;
+  std::vector<Canvas *> free_;
+
+  // Buffers submitted for writing
+  BoundedQueue<WriteRequest> requests_;
+  std::vector<std::thread> writers_;
+
+  // Guards everything below plus free_
+  mutable std::mutex mutex_;
+  std::condition_variable bufferFreed_, writesDone_;
+
+  // Submitted writes that have not finished, and failed writes since the last Flush()
+  int pending_;
+  int failures_;
+
+  int filesWritten_;
+  double stallSeconds_;
+};
+#endif
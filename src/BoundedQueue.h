@@ -0,0 +1,102 @@
+#ifndef __BOUNDED_QUEUE_H_
+#define __BOUNDED_QUEUE_H_
+/*
+ * BoundedQueue.h
+ *
+ * A thread-safe FIFO queue with a fixed capacity, used to connect the
+ * stages of a pipeline.  Push() blocks while the queue is full, so a fast
+ * producer is held back to the pace of a slow consumer instead of queueing
+ * unbounded work.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/**
+ * @brief  BoundedQueue class
+ */
+template <typename T>
+class BoundedQueue {
+public:
+  /**
+   * @brief Constructor
+   * @param capacity: Number of items the queue holds before Push() blocks
+   */
+  explicit BoundedQueue(const size_t capacity) : capacity_(capacity), closed_(false) {
+  }
+
+  /**
+   * @brief Destructor
+   */
+  ~BoundedQueue() {
+  }
+
+  /**
+   * @brief Adds an item, waiting while the queue is full.
+   * @return bool: False if the queue was closed (the item is dropped)
+   */
+  bool Push(T item) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notFull_.wait(lock, [this] { return closed_ || items_.size() < capacity_; });
+    if (closed_) {
+      return false;
+    }
+
+    items_.push_back(std::move(item));
+    notEmpty_.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Removes the oldest item, waiting while the queue is empty.
+   * @return bool: False once the queue is closed and empty
+   */
+  bool Pop(T &item) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notEmpty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+    if (items_.empty()) {
+      return false;
+    }
+
+    item = std::move(items_.front());
+    items_.pop_front();
+    notFull_.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Closes the queue.  Pushes fail from now on; pops drain the
+   *        remaining items and then fail.
+   */
+  void Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    notEmpty_.notify_all();
+    notFull_.notify_all();
+  }
+
+  // Accessor functions
+  size_t Capacity() const { return capacity_; }
+  size_t Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return items_.size();
+  }
+
+private:
+  // The queue is shared between threads, so it cannot be copied
+  BoundedQueue(const BoundedQueue &);
+  BoundedQueue &operator=(const BoundedQueue &);
+
+  std::deque<T> items_;
+  size_t capacity_;
+  bool closed_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable notEmpty_, notFull_;
+};
+#endif
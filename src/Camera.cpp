@@ -0,0 +1,50 @@
+/*
+ * Camera.cpp
+ *
+ * Camera ray generation and the basic render loop.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Camera.h"
+
+/**
+ * @brief  Constructs a ray from the camera through the specified pixel.
+ * @param px, py: Pixel coordinates
+ * @param dx, dy: Offset within the pixel (0.0-1.0).  Defaults to the center.
+ * @return Ray: Ray in world space
+ */
+Ray RayForPixel(const Camera &camera, const int px, const int py,
+                const float dx, const float dy) {
+  COUNT_RENDER_STAT(STAT_PRIMARY_RAYS, 1);
+
+  // Offset from the edge of the canvas to the sample point
+  const float X_OFFSET = (px + dx) * camera.PixelSize();
+  const float Y_OFFSET = (py + dy) * camera.PixelSize();
+
+  // Untransformed coordinates of the sample in world space
+  const float WORLD_X = camera.HalfWidth()  - X_OFFSET;
+  const float WORLD_Y = camera.HalfHeight() - Y_OFFSET;
+
+  // The canvas is at Z = -1
+  const Matrix &INV = camera.InverseTransform();
+  const Tuple PIXEL     = INV * Point(WORLD_X, WORLD_Y, -1);
+  const Tuple ORIGIN    = INV * Point(0, 0, 0);
+  const Tuple DIRECTION = Normalize(PIXEL - ORIGIN);
+
+  return Ray(ORIGIN, DIRECTION);
+}
+
+/**
+ * @brief  Renders the world through the camera onto the canvas.  The canvas
+ *         must be at least camera.HSize() x camera.VSize().
+ */
+void Render(const Camera &camera, const World &world, Canvas &canvas) {
+  TRACE_SCOPE("Render");
+  for (int y = 0; y < camera.VSize(); ++y) {
+    for (int x = 0; x < camera.HSize(); ++x) {
+      const Ray RAY = RayForPixel(camera, x, y);
+      canvas.WritePixel(x, y, ColorAt(world, RAY));
+    }
+  }
+}
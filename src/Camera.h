@@ -0,0 +1,142 @@
+#ifndef __CAMERA_H_
+#define __CAMERA_H_
+/*
+ * Camera.h
+ *
+ * Class definition for a Camera that maps canvas pixels to rays in the
+ * world, plus a function to render a World onto a Canvas.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "Matrix.h"
+#include "TransformBuilder.h"
+#include "RaySphere.h"
+#include "Canvas.h"
+#include "World.h"
+#include "FrameTrace.h"
+#include "RenderStats.h"
+
+#include <cmath>
+
+/**
+ * @brief  Camera class
+ */
+class Camera {
+public:
+  /**
+   * @brief Constructor
+   * @param hsize: Horizontal size (in pixels) of the canvas
+   * @param vsize: Vertical size (in pixels) of the canvas
+   * @param fov: Field of view (in radians)
+   */
+  Camera(const int hsize, const int vsize, const float fov) :
+    hsize_(hsize),
+    vsize_(vsize),
+    fov_(fov),
+    transform_(Identity(4)),
+    inverse_(Identity(4)) {
+    ComputePixelSize();
+  }
+
+  /**
+   * @brief Destructor
+   */
+  ~Camera() {
+  }
+
+  /**
+   * @brief Copy Constructor
+   */
+  Camera(const Camera &rhs) :
+    hsize_(rhs.hsize_),
+    vsize_(rhs.vsize_),
+    fov_(rhs.fov_),
+    halfWidth_(rhs.halfWidth_),
+    halfHeight_(rhs.halfHeight_),
+    pixelSize_(rhs.pixelSize_),
+    transform_(rhs.transform_),
+    inverse_(rhs.inverse_) {
+  }
+
+  /**
+   * @brief Assignment operator=
+   */
+  Camera &operator=(const Camera &rhs) {
+    // Check for self-assignment
+    if (this != &rhs) {
+      hsize_      = rhs.hsize_;
+      vsize_      = rhs.vsize_;
+      fov_        = rhs.fov_;
+      halfWidth_  = rhs.halfWidth_;
+      halfHeight_ = rhs.halfHeight_;
+      pixelSize_  = rhs.pixelSize_;
+      transform_  = rhs.transform_;
+      inverse_    = rhs.inverse_;
+    }
+    return *this;
+  }
+
+  // Accessor functions
+  int HSize() const { return hsize_; }
+  int VSize() const { return vsize_; }
+  float FieldOfView() const { return fov_; }
+  float HalfWidth() const { return halfWidth_; }
+  float HalfHeight() const { return halfHeight_; }
+  float PixelSize() const { return pixelSize_; }
+  Matrix Transform() const { return transform_; }
+  const Matrix &InverseTransform() const { return inverse_; }
+
+  /**
+   * @brief Sets the view transformation.  The inverse is cached since every
+   *        ray cast through the camera needs it.
+   */
+  void SetTransform(const Matrix &trans) {
+    transform_ = trans;
+    inverse_   = Inverse(trans);
+  }
+
+  void SetTransform(const TransformBuilder &builder) {
+    transform_ = builder.ForwardMatrix();
+    inverse_   = builder.InverseMatrix();
+  }
+
+private:
+  /**
+   * @brief Computes the size of a pixel on the canvas one unit in front of
+   *        the camera.
+   */
+  void ComputePixelSize() {
+    const float HALF_VIEW = tanf(fov_ / 2);
+    const float ASPECT    = static_cast<float>(hsize_) / vsize_;
+
+    if (ASPECT >= 1) {
+      halfWidth_  = HALF_VIEW;
+      halfHeight_ = HALF_VIEW / ASPECT;
+    } else {
+      halfWidth_  = HALF_VIEW * ASPECT;
+      halfHeight_ = HALF_VIEW;
+    }
+
+    pixelSize_ = (halfWidth_ * 2) / hsize_;
+  }
+
+  // Canvas dimensions and field of view
+  int hsize_, vsize_;
+  float fov_;
+
+  // Half the width/height of the canvas one unit in front of the camera
+  float halfWidth_, halfHeight_;
+
+  // Size of a single pixel in world units
+  float pixelSize_;
+
+  // View transformation and its inverse
+  Matrix transform_, inverse_;
+};
+
+// Function Prototypes
+Ray RayForPixel(const Camera &, const int, const int, const float = 0.5, const float = 0.5);
+void Render(const Camera &, const World &, Canvas &);
+#endif
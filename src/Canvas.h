@@ -11,105 +11,211 @@
 #define _CANVAS_H_
 
 #include "Color.h" // Each pixel is a color
+#include "FrameTrace.h"
+#include "kernels/Kernels.h"
 #include <cstdio>
 #include <cstring>
+#include <vector>
 
 class Canvas {
 public:
   // Constructor:
   Canvas(const int width, const int height) : width_(width), height_(height) {
-    // Allocate memory for canvas
-    canvas_ = new Color*[height_];
-    for(int i = 0; i < height_; i++) {
-      canvas_[i] = new Color[width_];
-    }
+    // Allocate memory for canvas.  Rows are stored one after another so
+    // post-processing passes can stream over the pixels.
+    canvas_ = new Color[width_ * height_];
   }
 
   // Destructor:
   ~Canvas() {
     // Free up the canvas
-    for(int i = 0; i < height_; i++) {
-      delete [] canvas_[ i ];
-    }
     delete [] canvas_;
   }
 
   // Write the canvas to a PPM file
-  void WriteToPPM(const char *filename) {
+  void WriteToPPM(const char *filename) const {
+    TRACE_SCOPE("WriteToPPM");
     FILE *output = fopen(filename, "wb");
     if(output) {
-      /*
-       * A PPM header consists of:
-       * P3\n
-       * <width> <height>\n
-       * 255\n
-       * <data>\n
-       */
-      char header[100];
-      const char *HEADER_TEMPLATE = "P3\n%d %d\n255\n";
-      sprintf(header, HEADER_TEMPLATE, width_, height_);
-
-      // Write the header
-      fwrite(header, 1, strlen(header), output);
-
-      /*
-       * The data is as follows:
-       * R G B
-       *
-       * where R, G, B are scaled from 0 to 255.
-       */
-      for(int y = 0; y < height_; ++y) {
-        for(int x = 0; x < width_; ++x) {
-          // Next color
-          Color nextColor = canvas_[y][x];
-          int scaledRed = ScaleColorValue(nextColor.Red());
-          int scaledGreen = ScaleColorValue(nextColor.Green());
-          int scaledBlue = ScaleColorValue(nextColor.Blue());
-
-          char nextColorBody[100] = {0};
-          const char *COLOR_TEMPLATE = "%d %d %d ";
-          sprintf(nextColorBody, COLOR_TEMPLATE, scaledRed, scaledGreen, scaledBlue);
-
-          fwrite(nextColorBody, 1, strlen(nextColorBody), output);
-        }
-      }
-      fwrite("\n", 1, 1, output);
+      WritePPM(output);
       fclose(output);
     }
   }
 
+  // Write the canvas in PPM format to an open file.  Returns false on a write error.
+  bool WritePPM(FILE *output) const {
+    /*
+     * A PPM header consists of:
+     * P3\n
+     * <width> <height>\n
+     * 255\n
+     * <data>\n
+     */
+    char header[100];
+    const char *HEADER_TEMPLATE = "P3\n%d %d\n255\n";
+    sprintf(header, HEADER_TEMPLATE, width_, height_);
+
+    // Write the header
+    fwrite(header, 1, strlen(header), output);
+
+    /*
+     * The data is as follows:
+     * R G B
+     *
+     * where R, G, B are scaled from 0 to 255.  Each row is scaled at once
+     * by the quantizePixels kernel, which reads the Colors as raw floats:
+     * the Color layout (4 packed floats) is load-bearing.
+     */
+    static_assert(sizeof(Color) == 4 * sizeof(float),
+                  "WritePPM() requires Color to be exactly 4 packed floats");
+    const RenderKernels &KERNELS = GetRenderKernels();
+    std::vector<uint8_t> rgb(3 * static_cast<size_t>(width_));
+    for(int y = 0; y < height_; ++y) {
+      KERNELS.quantizePixels(reinterpret_cast<const float *>(&canvas_[y * width_]), width_,
+                             rgb.data());
+      for(int x = 0; x < width_; ++x) {
+        // Next color
+        int scaledRed = rgb[3 * x];
+        int scaledGreen = rgb[3 * x + 1];
+        int scaledBlue = rgb[3 * x + 2];
+
+        char nextColorBody[100] = {0};
+        const char *COLOR_TEMPLATE = "%d %d %d ";
+        sprintf(nextColorBody, COLOR_TEMPLATE, scaledRed, scaledGreen, scaledBlue);
+
+        fwrite(nextColorBody, 1, strlen(nextColorBody), output);
+      }
+    }
+    fwrite("\n", 1, 1, output);
+    return !ferror(output);
+  }
+
+  // Read a PPM file into the canvas, resizing it to the image.  Returns
+  // false (leaving the canvas unchanged) if the file cannot be read.
+  bool ReadFromPPM(const char *filename) {
+    TRACE_SCOPE("ReadFromPPM");
+    FILE *input = fopen(filename, "rb");
+    if(!input) {
+      return false;
+    }
+    const bool SUCCESS = ReadPPM(input);
+    fclose(input);
+    return SUCCESS;
+  }
+
+  // Read a PPM image (ASCII P3 or binary P6, 8 or 16 bit) from an open
+  // file.  Samples are scaled to 0.0-1.0 by the image's maximum value.
+  bool ReadPPM(FILE *input) {
+    // Read the whole file at once; parsing from memory is much faster than
+    // scanning one value at a time
+    std::vector<unsigned char> data;
+    unsigned char buffer[65536];
+    size_t count;
+    while((count = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+      data.insert(data.end(), buffer, buffer + count);
+    }
+    if(ferror(input) || data.size() < 2 || data[0] != 'P' ||
+       (data[1] != '3' && data[1] != '6')) {
+      return false;
+    }
+    const bool BINARY = (data[1] == '6');
+
+    // Header: width, height, and maximum sample value
+    size_t pos = 2;
+    int width = 0, height = 0, maxValue = 0;
+    if(!ReadPPMNumber(data, pos, width) || !ReadPPMNumber(data, pos, height) ||
+       !ReadPPMNumber(data, pos, maxValue) || width <= 0 || height <= 0 ||
+       maxValue <= 0 || maxValue > 65535) {
+      return false;
+    }
+
+    const size_t SAMPLES = static_cast<size_t>(width) * height * 3;
+    const int BYTES = (maxValue < 256) ? 1 : 2;
+
+    // A single whitespace character separates the header from binary data.
+    // Every sample takes at least one byte, even in ASCII.
+    ++pos;
+    if(data.size() < pos || data.size() - pos < SAMPLES * (BINARY ? BYTES : 1)) {
+      return false;
+    }
+
+    std::vector<float> samples(SAMPLES);
+    for(size_t i = 0; i < SAMPLES; ++i) {
+      int value = 0;
+      if(BINARY) {
+        value = (BYTES == 1) ? data[pos + i] : (data[pos + 2 * i] << 8) | data[pos + 2 * i + 1];
+      } else if(!ReadPPMNumber(data, pos, value)) {
+        return false;
+      }
+      samples[i] = static_cast<float>(value) / maxValue;
+    }
+
+    // Replace the pixels only once the whole image has been parsed
+    Color *pixels = new Color[width * height];
+    for(int i = 0; i < width * height; ++i) {
+      pixels[i] = Color(samples[3 * i], samples[3 * i + 1], samples[3 * i + 2]);
+    }
+    delete [] canvas_;
+    canvas_ = pixels;
+    width_  = width;
+    height_ = height;
+    return true;
+  }
+
   // Accessor/Modifier functions
   int GetWidth() const { return width_; }
   int GetHeight() const { return height_; }
   Color PixelAt( const int x, const int y ) const {
-    return canvas_[y][x];
+    return canvas_[y * width_ + x];
   }
 
+  // The pixels of row y, followed by the rest of the rows in order
+  const Color *Row(const int y) const { return canvas_ + y * width_; }
+  Color *Row(const int y) { return canvas_ + y * width_; }
+
   void WritePixel(const int x, const int y, const Color& color) {
     // Ensure the pixel value is accessible
-    if((x > 0) && (x < width_) &&
-       (y > 0) && (y < height_)) {
-      canvas_[ y ][ x ] = color;
+    if((x >= 0) && (x < width_) &&
+       (y >= 0) && (y < height_)) {
+      canvas_[ y * width_ + x ] = color;
     }
   }
 
 private:
-  // Scale the RGB color values from (0.0-1.0) to (0-255)
-  int ScaleColorValue(const float colorValue) const {
-    float clr = colorValue;
-    // Threshold the input color value to be between 0.0-1.0
-    if (clr > 1.0) {
-      clr = 1.0;
-    } else if (clr < 0.0) {
-      clr = 0.0;
+  // Parse the next decimal number of a PPM header or ASCII body, skipping
+  // whitespace and comments (# to the end of the line)
+  static bool ReadPPMNumber(const std::vector<unsigned char> &data, size_t &pos, int &value) {
+    while(pos < data.size()) {
+      if(data[pos] == '#') {
+        while(pos < data.size() && data[pos] != '\n') {
+          ++pos;
+        }
+      } else if(data[pos] == ' ' || data[pos] == '\t' || data[pos] == '\n' || data[pos] == '\r') {
+        ++pos;
+      } else {
+        break;
+      }
+    }
+
+    if(pos >= data.size() || data[pos] < '0' || data[pos] > '9') {
+      return false;
+    }
+    long long number = 0;
+    while(pos < data.size() && data[pos] >= '0' && data[pos] <= '9') {
+      number = number * 10 + (data[pos] - '0');
+      if(number > 1000000000) {
+        return false;
+      }
+      ++pos;
     }
-    return static_cast<int>(255 * clr);
+    value = static_cast<int>(number);
+    return true;
   }
 
   // Canvas dimensions
   int width_, height_;
 
-  // Pointer to the actual canvas
-  Color **canvas_;
+  // Pointer to the actual canvas (width_ * height_ pixels, row by row)
+  Color *canvas_;
 };
 #endif
@@ -0,0 +1,89 @@
+/*
+ * CanvasDiff.cpp
+ *
+ * Per-pixel comparison of two canvases.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "CanvasDiff.h"
+
+/**
+ * @brief  Clamps a channel to 0.0-1.0.
+ */
+float ClampUnit(const float value) {
+  return std::min(std::max(value, 0.0f), 1.0f);
+}
+
+/**
+ * @brief  Maps 0.0-1.0 onto a black -> red -> yellow -> white ramp.
+ */
+Color HeatmapColor(const float t) {
+  const float T = ClampUnit(t) * 3.0f;
+  return Color(ClampUnit(T), ClampUnit(T - 1.0f), ClampUnit(T - 2.0f));
+}
+
+/**
+ * @brief  Compares two canvases of the same size.
+ * @param stats: Receives the differences
+ * @param heatmap: If given (and the same size), each pixel is set to the
+ *                 HeatmapColor() of that pixel's largest channel difference
+ * @param heatmapScale: Difference drawn as white in the heatmap
+ * @return bool: False if the canvases are different sizes
+ */
+bool CompareCanvases(const Canvas &reference, const Canvas &test, CanvasDiffStats &stats,
+                     Canvas *heatmap, const float heatmapScale) {
+  const int WIDTH  = reference.GetWidth();
+  const int HEIGHT = reference.GetHeight();
+  if (test.GetWidth() != WIDTH || test.GetHeight() != HEIGHT ||
+      (heatmap && (heatmap->GetWidth() != WIDTH || heatmap->GetHeight() != HEIGHT))) {
+    return false;
+  }
+
+  stats = CanvasDiffStats();
+  double sum = 0.0, sumSquares = 0.0;
+  for (int y = 0; y < HEIGHT; ++y) {
+    const Color *REFERENCE_ROW = reference.Row(y);
+    const Color *TEST_ROW = test.Row(y);
+    for (int x = 0; x < WIDTH; ++x) {
+      const float EXPECTED[3] = {REFERENCE_ROW[x].Red(), REFERENCE_ROW[x].Green(),
+                                 REFERENCE_ROW[x].Blue()};
+      const float ACTUAL[3] = {TEST_ROW[x].Red(), TEST_ROW[x].Green(), TEST_ROW[x].Blue()};
+
+      float pixelError = 0.0f;
+      bool visible = false;
+      for (int c = 0; c < 3; ++c) {
+        const float A = ClampUnit(EXPECTED[c]);
+        const float B = ClampUnit(ACTUAL[c]);
+        const float ERROR = std::fabs(A - B);
+        pixelError  = std::max(pixelError, ERROR);
+        sum        += ERROR;
+        sumSquares += static_cast<double>(ERROR) * ERROR;
+
+        // Quantized the same way WriteToPPM() does
+        visible = visible || static_cast<int>(255 * A) != static_cast<int>(255 * B);
+      }
+
+      if (pixelError > stats.maxError) {
+        stats.maxError = pixelError;
+        stats.worstX   = x;
+        stats.worstY   = y;
+      }
+      stats.visiblePixels += visible ? 1 : 0;
+
+      if (heatmap) {
+        heatmap->WritePixel(x, y, HeatmapColor(pixelError / heatmapScale));
+      }
+    }
+  }
+
+  const double SAMPLES = 3.0 * WIDTH * HEIGHT;
+  if (SAMPLES > 0) {
+    stats.meanError = sum / SAMPLES;
+    stats.rmse      = std::sqrt(sumSquares / SAMPLES);
+    if (sumSquares > 0) {
+      stats.psnr = 10.0 * std::log10(SAMPLES / sumSquares);
+    }
+  }
+  return true;
+}
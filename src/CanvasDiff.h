@@ -0,0 +1,54 @@
+#ifndef __CANVAS_DIFF_H_
+#define __CANVAS_DIFF_H_
+/*
+ * CanvasDiff.h
+ *
+ * Compares two renders of the same image, e.g. the output of an optimized
+ * code path against the reference renderer.  Reports the largest and mean
+ * differences, PSNR, and how many pixels would visibly change once written
+ * as 8 bit color, and can draw a heatmap of where the differences are.
+ *
+ * Colors are clamped to the displayable 0.0-1.0 range before comparing,
+ * matching what is written to image files.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Color.h"
+#include "Canvas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief  Differences between two canvases.
+ */
+struct CanvasDiffStats {
+  CanvasDiffStats() :
+    maxError(0), meanError(0), rmse(0), psnr(std::numeric_limits<double>::infinity()),
+    visiblePixels(0), worstX(-1), worstY(-1) {
+  }
+
+  // Largest difference in any channel of any pixel
+  float maxError;
+
+  // Mean and root mean square difference over every channel
+  double meanError, rmse;
+
+  // Peak signal to noise ratio in dB (infinite if the canvases are identical)
+  double psnr;
+
+  // Pixels whose 8 bit color differs
+  long long visiblePixels;
+
+  // Pixel with the largest difference (-1 if the canvases are identical)
+  int worstX, worstY;
+};
+
+// Function Prototypes
+float ClampUnit(const float);
+Color HeatmapColor(const float);
+bool CompareCanvases(const Canvas &, const Canvas &, CanvasDiffStats &,
+                     Canvas * = NULL, const float = 0.1);
+#endif
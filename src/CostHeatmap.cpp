@@ -0,0 +1,119 @@
+/*
+ * CostHeatmap.cpp
+ *
+ * Renders with per-pixel counters and turns them into heatmaps.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "CostHeatmap.h"
+
+/**
+ * @brief  Name of a counter, as used in heatmap file names.
+ */
+const char *CounterName(const PixelCounterField field) {
+  switch (field) {
+    case COUNTER_RAYS:       return "rays";
+    case COUNTER_INTERSECTS: return "intersects";
+    case COUNTER_SHADES:     return "shades";
+    case COUNTER_CYCLES:     return "cycles";
+  }
+  return "";
+}
+
+/**
+ * @brief  Reads one counter.
+ */
+uint64_t CounterValue(const PixelCounters &counters, const PixelCounterField field) {
+  switch (field) {
+    case COUNTER_RAYS:       return counters.rays;
+    case COUNTER_INTERSECTS: return counters.intersects;
+    case COUNTER_SHADES:     return counters.shades;
+    case COUNTER_CYCLES:     return counters.cycles;
+  }
+  return 0;
+}
+
+/**
+ * @brief  Renders the world like Render(), tile by tile on the scheduler,
+ *         recording the counters of every pixel.
+ * @param counters: Receives HSize() * VSize() counters in scanline order
+ * @return PixelCounters: Totals over the frame
+ */
+PixelCounters RenderWithCounters(const Camera &camera, const World &world, Canvas &canvas,
+                                 TileScheduler &scheduler, std::vector<PixelCounters> &counters) {
+  const int WIDTH = camera.HSize();
+  counters.assign(static_cast<size_t>(WIDTH) * camera.VSize(), PixelCounters());
+
+  scheduler.Run(MakeTiles(WIDTH, camera.VSize(), 16), [&](const Tile &tile, const int) {
+    for (int y = tile.y0; y < tile.y1; ++y) {
+      for (int x = tile.x0; x < tile.x1; ++x) {
+        PixelCounters &pixel = counters[static_cast<size_t>(y) * WIDTH + x];
+        ActivePixelCounters() = &pixel;
+
+        const uint64_t START = ReadCycleCounter();
+        const Color COLOR = ColorAt(world, RayForPixel(camera, x, y));
+        pixel.cycles = ReadCycleCounter() - START;
+
+        ActivePixelCounters() = NULL;
+        canvas.WritePixel(x, y, COLOR);
+      }
+    }
+  });
+
+  PixelCounters total;
+  for (size_t i = 0; i < counters.size(); ++i) {
+    total += counters[i];
+  }
+  return total;
+}
+
+/**
+ * @brief  Draws one counter as a heatmap (black -> red -> yellow -> white).
+ *         The scale saturates at the 99th percentile so a few outliers
+ *         (e.g. a thread being preempted mid-pixel) do not wash it out.
+ */
+void CounterHeatmap(const std::vector<PixelCounters> &counters, const PixelCounterField field,
+                    Canvas &heatmap) {
+  if (counters.empty()) {
+    return;
+  }
+
+  std::vector<uint64_t> values(counters.size());
+  for (size_t i = 0; i < counters.size(); ++i) {
+    values[i] = CounterValue(counters[i], field);
+  }
+  std::vector<uint64_t> sorted(values);
+  std::nth_element(sorted.begin(), sorted.begin() + (sorted.size() * 99) / 100, sorted.end());
+  const double SCALE = std::max<uint64_t>(1, sorted[(sorted.size() * 99) / 100]);
+
+  const int WIDTH = heatmap.GetWidth();
+  for (size_t i = 0; i < values.size(); ++i) {
+    heatmap.WritePixel(static_cast<int>(i % WIDTH), static_cast<int>(i / WIDTH),
+                       HeatmapColor(static_cast<float>(values[i] / SCALE)));
+  }
+}
+
+/**
+ * @brief  Writes a heatmap of every counter as <prefix>_<counter>.ppm.
+ *         Only cycles are written if the counting hooks are compiled out.
+ * @return bool: False if the counters do not match the image size
+ */
+bool WriteCounterHeatmaps(const std::vector<PixelCounters> &counters, const int width,
+                          const int height, const std::string &prefix) {
+  if (counters.size() != static_cast<size_t>(width) * height) {
+    return false;
+  }
+
+  const PixelCounterField FIELDS[] = {COUNTER_RAYS, COUNTER_INTERSECTS, COUNTER_SHADES,
+                                      COUNTER_CYCLES};
+  for (int i = 0; i < 4; ++i) {
+    if (FIELDS[i] != COUNTER_CYCLES && !PixelCountersEnabled()) {
+      continue;
+    }
+    Canvas heatmap(width, height);
+    CounterHeatmap(counters, FIELDS[i], heatmap);
+    heatmap.WriteToPPM((prefix + "_" + CounterName(FIELDS[i]) + ".ppm").c_str());
+  }
+  return true;
+}
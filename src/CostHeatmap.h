@@ -0,0 +1,42 @@
+#ifndef __COST_HEATMAP_H_
+#define __COST_HEATMAP_H_
+/*
+ * CostHeatmap.h
+ *
+ * Renders a frame while recording the cost of every pixel (see
+ * PixelCounters.h), and draws each counter as a false color heatmap so it
+ * is easy to see where in the image the time goes.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Camera.h"
+#include "Canvas.h"
+#include "CanvasDiff.h"
+#include "PixelCounters.h"
+#include "TileScheduler.h"
+#include "World.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/**
+ * @brief  The counters that can be drawn as heatmaps.
+ */
+enum PixelCounterField {
+  COUNTER_RAYS,
+  COUNTER_INTERSECTS,
+  COUNTER_SHADES,
+  COUNTER_CYCLES
+};
+
+// Function Prototypes
+const char *CounterName(const PixelCounterField);
+uint64_t CounterValue(const PixelCounters &, const PixelCounterField);
+PixelCounters RenderWithCounters(const Camera &, const World &, Canvas &, TileScheduler &,
+                                 std::vector<PixelCounters> &);
+void CounterHeatmap(const std::vector<PixelCounters> &, const PixelCounterField, Canvas &);
+bool WriteCounterHeatmaps(const std::vector<PixelCounters> &, const int, const int,
+                          const std::string &);
+#endif
@@ -0,0 +1,47 @@
+/*
+ * CountingAllocator.cpp
+ *
+ * Replacement global allocation functions that count every heap
+ * allocation in the render statistics.  Not part of the renderer library:
+ * only binaries that want heap counts link this file (the
+ * renderer_heap_stats objects), so other users of the library keep the
+ * normal allocator and do not pay for a counter lookup per allocation.
+ *
+ * The array and nothrow forms forward to these.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "RenderStats.h"
+
+/**
+ * @brief  Marks the heap counts as valid for the report.
+ */
+static bool EnableHeapStats() {
+  GetRenderStatsRegistry().countsHeap = true;
+  return true;
+}
+
+static const bool HEAP_STATS_ENABLED = EnableHeapStats();
+
+void *operator new(size_t size) {
+  RenderStatCounters &counters = ThreadRenderStats();
+  std::atomic<uint64_t> &allocations = counters.values[STAT_HEAP_ALLOCATIONS];
+  std::atomic<uint64_t> &bytes = counters.values[STAT_HEAP_BYTES];
+  allocations.store(allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  bytes.store(bytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+
+  void *memory = malloc(size ? size : 1);
+  if (!memory) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void operator delete(void *memory) noexcept {
+  free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+  free(memory);
+}
@@ -0,0 +1,573 @@
+#ifndef __DISTRIBUTED_RENDER_H_
+#define __DISTRIBUTED_RENDER_H_
+/*
+ * DistributedRender.h
+ *
+ * Splits a frame across worker processes, possibly on several hosts.  The
+ * coordinator listens on a TCP port; workers connect to it, receive the job
+ * and then render ranges of tiles with their own thread pools, streaming
+ * each tile back as it is finished (see RenderProtocol.h).
+ *
+ * A worker that disconnects has its unfinished range put back in the queue.
+ * A range held for longer than reissueAfterSeconds is also handed to an
+ * idle worker, so a slow or hung worker cannot stall the frame; whichever
+ * copy of a tile arrives first is kept.
+ *
+ * The coordinator binds to loopback unless given another address, since it
+ * takes tiles from whoever connects.  A worker must also open with MSG_HELLO
+ * carrying the coordinator's job token before it is sent the job, and the
+ * coordinator refuses to listen on any other address without a token.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Color.h"
+#include "Canvas.h"
+#include "Camera.h"
+#include "Scenes.h"
+#include "TileScheduler.h"
+#include "RenderProtocol.h"
+#include "RenderServer.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief  Coordinator settings
+ */
+struct CoordinatorOptions {
+  CoordinatorOptions() : rangeSize(4), reissueAfterSeconds(5.0), timeoutSeconds(30.0) {
+  }
+
+  // Number of consecutive tiles handed to a worker at a time
+  int rangeSize;
+
+  // A range held for longer than this is also given to an idle worker
+  double reissueAfterSeconds;
+
+  // Give up if no tile arrives for this long (e.g. no workers connected)
+  double timeoutSeconds;
+};
+
+/**
+ * @brief  Summary of a distributed render.
+ */
+struct DistributedStats {
+  DistributedStats() :
+    tiles(0), duplicateTiles(0), reissuedRanges(0), workersLost(0), workers(0), seconds(0.0) {
+  }
+
+  int tiles;
+
+  // Tiles received more than once because their range was re-issued
+  int duplicateTiles;
+
+  // Ranges handed to a second worker because the first was too slow
+  int reissuedRanges;
+
+  // Workers that disconnected while holding a range
+  int workersLost;
+
+  // Workers connected at the end of the render
+  int workers;
+
+  double seconds;
+};
+
+/**
+ * @brief  RenderCoordinator class
+ */
+class RenderCoordinator {
+public:
+  /**
+   * @brief Constructor
+   * @param port: TCP port to listen on, or 0 to pick any free port
+   * @param bindAddress: Address to listen on.  "0.0.0.0" accepts workers
+   *                     on other hosts, and needs a token.
+   * @param token: Shared secret every worker must send in MSG_HELLO
+   */
+  explicit RenderCoordinator(const int port = 0, const std::string &bindAddress = "127.0.0.1",
+                             const std::string &token = "") :
+    requestedPort_(port), port_(0), listenFd_(-1), bindAddress_(bindAddress), token_(token) {
+  }
+
+  /**
+   * @brief Destructor.  Disconnects every worker.
+   */
+  ~RenderCoordinator() {
+    for (size_t i = 0; i < workers_.size(); ++i) {
+      close(workers_[i].fd);
+    }
+    if (listenFd_ >= 0) {
+      close(listenFd_);
+    }
+  }
+
+  /**
+   * @brief Creates the listening socket.  Workers may connect once this
+   *        returns true; they are accepted during Render().
+   * @return bool: False if the socket cannot be created, or if the bind
+   *               address is not loopback and there is no job token
+   */
+  bool Listen() {
+    if (token_.empty() && !IsLoopbackAddress(bindAddress_)) {
+      return false;
+    }
+    listenFd_ = ListenTcp(bindAddress_, requestedPort_, port_);
+    return listenFd_ >= 0;
+  }
+
+  /**
+   * @brief Renders a job on the connected workers, accepting new workers
+   *        as they arrive.  Workers stay connected for later renders.
+   * @param canvas: Receives the image; at least job.width x job.height
+   * @return bool: True if every tile was received before the timeout
+   */
+  bool Render(const RenderJob &job, Canvas &canvas, const CoordinatorOptions &options,
+              DistributedStats &stats) {
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point START = Clock::now();
+
+    stats = DistributedStats();
+    job_  = SerializeJob(job);
+
+    const std::vector<Tile> TILES = MakeTiles(job.width, job.height, job.tileSize);
+    const int COLUMNS = (job.width + job.tileSize - 1) / job.tileSize;
+    std::vector<char> received(TILES.size(), 0);
+    int remaining = static_cast<int>(TILES.size());
+    stats.tiles = remaining;
+
+    // Every range starts out in the queue
+    std::deque<int> pending;
+    for (int first = 0; first < remaining; first += options.rangeSize) {
+      pending.push_back(first);
+    }
+
+    for (size_t i = 0; i < workers_.size(); ++i) {
+      workers_[i].range = -1;
+      if (workers_[i].verified) {
+        workers_[i].ready = SendMessage(workers_[i].fd, MSG_JOB, job_);
+      }
+    }
+
+    Clock::time_point lastProgress = Clock::now();
+    while (remaining > 0) {
+      // Drop workers whose connection failed
+      for (size_t i = 0; i < workers_.size();) {
+        if (workers_[i].ready) {
+          ++i;
+          continue;
+        }
+        if (workers_[i].range >= 0) {
+          ++stats.workersLost;
+          pending.push_front(workers_[i].range);
+        }
+        close(workers_[i].fd);
+        workers_.erase(workers_.begin() + i);
+      }
+
+      AssignRanges(pending, received, options, stats);
+
+      // Wait for a new worker or a message from an existing one
+      std::vector<pollfd> fds(workers_.size() + 1);
+      fds[0].fd     = listenFd_;
+      fds[0].events = POLLIN;
+      for (size_t i = 0; i < workers_.size(); ++i) {
+        fds[i + 1].fd     = workers_[i].fd;
+        fds[i + 1].events = POLLIN;
+      }
+      poll(fds.data(), fds.size(), 50);
+
+      if (fds[0].revents & POLLIN) {
+        AcceptWorker();
+      }
+
+      for (size_t i = 0; i < workers_.size() && i + 1 < fds.size(); ++i) {
+        if (!(fds[i + 1].revents & (POLLIN | POLLHUP | POLLERR))) {
+          continue;
+        }
+
+        Worker &worker = workers_[i];
+        uint32_t type;
+        std::string payload;
+        if (!ReceiveMessage(worker.fd, type, payload)) {
+          worker.ready = false;
+          continue;
+        }
+
+        if (!worker.verified) {
+          // Only a MSG_HELLO with the right token gets the job
+          if (type == MSG_HELLO && TokensMatch(token_, payload)) {
+            worker.verified = true;
+            worker.ready    = SendMessage(worker.fd, MSG_JOB, job_);
+          } else {
+            SendMessage(worker.fd, MSG_ERROR, "bad job token");
+            worker.ready = false;
+          }
+          continue;
+        }
+
+        if (type == MSG_TILE) {
+          ++worker.tilesSent;
+          Tile tile;
+          std::vector<Color> pixels;
+          if (!DecodeTile(payload, tile, pixels) || tile.x0 % job.tileSize != 0 ||
+              tile.y0 % job.tileSize != 0) {
+            worker.ready = false;
+            continue;
+          }
+
+          const size_t INDEX = (tile.y0 / job.tileSize) * COLUMNS + tile.x0 / job.tileSize;
+          if (INDEX >= received.size()) {
+            worker.ready = false;
+            continue;
+          }
+          if (received[INDEX]) {
+            ++stats.duplicateTiles;
+            continue;
+          }
+
+          size_t next = 0;
+          for (int y = tile.y0; y < tile.y1; ++y) {
+            for (int x = tile.x0; x < tile.x1; ++x) {
+              canvas.WritePixel(x, y, pixels[next++]);
+            }
+          }
+          received[INDEX] = 1;
+          --remaining;
+          lastProgress = Clock::now();
+        } else if (type == MSG_DONE) {
+          worker.range = -1;
+        } else if (type == MSG_ERROR) {
+          fprintf(stderr, "Worker rejected the job: %s\n", payload.c_str());
+          worker.ready = false;
+        }
+      }
+
+      if (std::chrono::duration<double>(Clock::now() - lastProgress).count() >
+          options.timeoutSeconds) {
+        break;
+      }
+    }
+
+    /*
+     * A worker that has sent its whole range only owes MSG_DONE, so wait for
+     * it.  Any other worker still holding a range was overtaken by a
+     * re-issued copy; its late tiles would be mistaken for tiles of the next
+     * job, so disconnect it.
+     */
+    for (size_t i = 0; i < workers_.size();) {
+      Worker &worker = workers_[i];
+      if (worker.range >= 0 && worker.tilesSent == worker.count) {
+        uint32_t type;
+        std::string payload;
+        if (ReceiveMessage(worker.fd, type, payload) && type == MSG_DONE) {
+          worker.range = -1;
+        }
+      }
+
+      if (worker.ready && worker.range < 0) {
+        ++i;
+        continue;
+      }
+      close(worker.fd);
+      workers_.erase(workers_.begin() + i);
+    }
+
+    stats.workers = static_cast<int>(workers_.size());
+    stats.seconds = std::chrono::duration<double>(Clock::now() - START).count();
+    return remaining == 0;
+  }
+
+  /**
+   * @brief Tells every connected worker to exit and disconnects them.
+   */
+  void Shutdown() {
+    for (size_t i = 0; i < workers_.size(); ++i) {
+      SendMessage(workers_[i].fd, MSG_SHUTDOWN, "");
+      close(workers_[i].fd);
+    }
+    workers_.clear();
+  }
+
+  // Accessor functions
+  int Port() const { return port_; }
+  int NumWorkers() const { return static_cast<int>(workers_.size()); }
+
+private:
+  /**
+   * @brief  A connected worker process.
+   */
+  struct Worker {
+    int fd;
+
+    // False once the connection has failed
+    bool ready;
+
+    // True once the worker has sent MSG_HELLO with the job token
+    bool verified;
+
+    // First tile and size of the range the worker is rendering (range is -1 if idle)
+    int range, count;
+
+    // Tiles received from the worker for its current range
+    int tilesSent;
+    std::chrono::steady_clock::time_point assigned;
+  };
+
+  /**
+   * @brief Accepts a waiting worker.  It is sent the current job once its
+   *        MSG_HELLO arrives.
+   */
+  void AcceptWorker() {
+    const int FD = AcceptConnection(listenFd_);
+    if (FD < 0) {
+      return;
+    }
+
+    // A worker that stops mid-message is treated as lost rather than blocking the frame
+    timeval timeout;
+    timeout.tv_sec  = 5;
+    timeout.tv_usec = 0;
+    setsockopt(FD, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    Worker worker;
+    worker.fd        = FD;
+    worker.range     = -1;
+    worker.count     = 0;
+    worker.tilesSent = 0;
+    worker.ready     = true;
+    worker.verified  = false;
+    workers_.push_back(worker);
+  }
+
+  /**
+   * @brief Hands a range to every idle worker: the next queued range, or
+   *        failing that the longest held overdue range.
+   */
+  void AssignRanges(std::deque<int> &pending, const std::vector<char> &received,
+                    const CoordinatorOptions &options, DistributedStats &stats) {
+    const std::chrono::steady_clock::time_point NOW = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < workers_.size(); ++i) {
+      Worker &worker = workers_[i];
+      if (!worker.ready || !worker.verified || worker.range >= 0) {
+        continue;
+      }
+
+      // Skip queued ranges that were completed by a re-issued copy
+      while (!pending.empty() && RangeReceived(pending.front(), received, options)) {
+        pending.pop_front();
+      }
+
+      int range = -1;
+      if (!pending.empty()) {
+        range = pending.front();
+        pending.pop_front();
+      } else {
+        range = OverdueRange(received, options, NOW);
+        if (range < 0) {
+          continue;
+        }
+        ++stats.reissuedRanges;
+      }
+
+      const int COUNT = std::min(options.rangeSize, static_cast<int>(received.size()) - range);
+      std::ostringstream assignment;
+      assignment << range << " " << COUNT;
+      worker.ready    = SendMessage(worker.fd, MSG_ASSIGN, assignment.str());
+      worker.range     = range;
+      worker.count     = COUNT;
+      worker.tilesSent = 0;
+      worker.assigned  = NOW;
+    }
+  }
+
+  /**
+   * @brief Finds the range held the longest past the re-issue deadline
+   *        that has unreceived tiles and only one holder.
+   * @return int: First tile of the range, or -1 if there is none
+   */
+  int OverdueRange(const std::vector<char> &received, const CoordinatorOptions &options,
+                   const std::chrono::steady_clock::time_point now) const {
+    int best = -1;
+    double bestAge = options.reissueAfterSeconds;
+
+    for (size_t i = 0; i < workers_.size(); ++i) {
+      const Worker &WORKER = workers_[i];
+      if (WORKER.range < 0 || RangeReceived(WORKER.range, received, options)) {
+        continue;
+      }
+
+      int holders = 0;
+      for (size_t j = 0; j < workers_.size(); ++j) {
+        holders += (workers_[j].range == WORKER.range);
+      }
+
+      const double AGE = std::chrono::duration<double>(now - WORKER.assigned).count();
+      if (holders == 1 && AGE > bestAge) {
+        best    = WORKER.range;
+        bestAge = AGE;
+      }
+    }
+    return best;
+  }
+
+  /**
+   * @brief Checks if every tile of the range has been received.
+   */
+  static bool RangeReceived(const int first, const std::vector<char> &received,
+                            const CoordinatorOptions &options) {
+    const int LAST = std::min(first + options.rangeSize, static_cast<int>(received.size()));
+    for (int i = first; i < LAST; ++i) {
+      if (!received[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // The coordinator owns sockets, so it cannot be copied
+  RenderCoordinator(const RenderCoordinator &);
+  RenderCoordinator &operator=(const RenderCoordinator &);
+
+  // Port requested by the caller and the port actually listened on
+  int requestedPort_, port_;
+  int listenFd_;
+  std::string bindAddress_;
+
+  // Job token workers must send in MSG_HELLO
+  std::string token_;
+
+  // Connected workers
+  std::vector<Worker> workers_;
+
+  // Serialized job sent to workers that connect mid-render
+  std::string job_;
+};
+
+/**
+ * @brief  RenderWorker class
+ */
+class RenderWorker {
+public:
+  /**
+   * @brief Constructor.  Starts the worker threads.
+   * @param numThreads: Number of worker threads.  0 uses one per hardware thread.
+   */
+  explicit RenderWorker(const int numThreads = 0) : scheduler_(numThreads), tilesRendered_(0) {
+  }
+
+  /**
+   * @brief Destructor
+   */
+  ~RenderWorker() {
+  }
+
+  /**
+   * @brief Connects to a coordinator and renders the ranges it assigns
+   *        until it sends MSG_SHUTDOWN or disconnects.
+   * @param token: Job token the coordinator was started with
+   * @return bool: True if the coordinator could be reached and accepted
+   *               the token
+   */
+  bool Run(const std::string &host, const int port, const std::string &token = "") {
+    const int FD = ConnectTcp(host, port);
+    if (FD < 0) {
+      return false;
+    }
+
+    SendMessage(FD, MSG_HELLO, token);
+    bool accepted = true;
+
+    RenderJob job;
+    const Scene *scene = NULL;
+    std::vector<Tile> tiles;
+
+    uint32_t type;
+    std::string payload;
+    while (ReceiveMessage(FD, type, payload)) {
+      if (type == MSG_SHUTDOWN) {
+        break;
+      }
+
+      if (type == MSG_ERROR) {
+        fprintf(stderr, "Coordinator rejected the worker: %s\n", payload.c_str());
+        accepted = false;
+        break;
+      }
+
+      if (type == MSG_JOB) {
+        std::string error;
+        scene = ParseJob(payload, job, error) ? scenes_.Find(job.scene) : NULL;
+        if (!scene) {
+          SendMessage(FD, MSG_ERROR, "cannot render job: " +
+                      (error.empty() ? "unknown scene " + job.scene : error));
+          continue;
+        }
+        tiles = MakeTiles(job.width, job.height, job.tileSize);
+      } else if (type == MSG_ASSIGN && scene) {
+        int first = 0, count = 0;
+        std::istringstream(payload) >> first >> count;
+        if (!RenderRange(FD, job, *scene, tiles, first, count)) {
+          break;
+        }
+      }
+    }
+
+    close(FD);
+    return accepted;
+  }
+
+  // Accessor functions
+  int TilesRendered() const { return tilesRendered_; }
+
+private:
+  /**
+   * @brief Renders tiles [first, first+count) and streams them back,
+   *        followed by MSG_DONE.
+   * @return bool: False if the connection failed
+   */
+  bool RenderRange(const int fd, const RenderJob &job, const Scene &scene,
+                   const std::vector<Tile> &tiles, const int first, const int count) {
+    const int BEGIN = std::max(0, std::min(first, static_cast<int>(tiles.size())));
+    const int END   = std::max(BEGIN, std::min(first + count, static_cast<int>(tiles.size())));
+    const std::vector<Tile> RANGE(tiles.begin() + BEGIN, tiles.begin() + END);
+
+    const Camera CAMERA = JobCamera(job, scene);
+    std::mutex sendMutex;
+    bool connected = true;
+
+    scheduler_.Run(RANGE, [&](const Tile &tile, const int) {
+      const std::string PAYLOAD = EncodeTile(tile, TraceTile(scene.world, CAMERA, tile));
+      std::lock_guard<std::mutex> lock(sendMutex);
+      connected = connected && SendMessage(fd, MSG_TILE, PAYLOAD);
+    });
+
+    tilesRendered_ += END - BEGIN;
+    return connected && SendMessage(fd, MSG_DONE, "");
+  }
+
+  // The worker owns threads, so it cannot be copied
+  RenderWorker(const RenderWorker &);
+  RenderWorker &operator=(const RenderWorker &);
+
+  // Threads that render the assigned tiles
+  TileScheduler scheduler_;
+
+  // Scenes built so far
+  SceneCache scenes_;
+
+  int tilesRendered_;
+};
+#endif
@@ -0,0 +1,481 @@
+/*
+ * ExrImage.cpp
+ *
+ * OpenEXR encoding and decoding.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "ExrImage.h"
+
+/*
+ * Little endian field helpers.  EXR stores every number little endian
+ * regardless of the host.
+ */
+void ExrPutUint32(std::string &out, const uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+void ExrPutUint64(std::string &out, const uint64_t value) {
+  for (int i = 0; i < 8; ++i) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+void ExrPutFloat(std::string &out, const float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  ExrPutUint32(out, bits);
+}
+
+void ExrPutAttribute(std::string &out, const char *name, const char *type,
+                     const std::string &value) {
+  out.append(name, strlen(name) + 1);
+  out.append(type, strlen(type) + 1);
+  ExrPutUint32(out, static_cast<uint32_t>(value.size()));
+  out.append(value);
+}
+
+uint32_t ExrGetUint32(const std::string &in, const size_t pos) {
+  uint32_t value = 0;
+  for (int i = 3; i >= 0; --i) {
+    value = (value << 8) | static_cast<unsigned char>(in[pos + i]);
+  }
+  return value;
+}
+
+uint64_t ExrGetUint64(const std::string &in, const size_t pos) {
+  return static_cast<uint64_t>(ExrGetUint32(in, pos)) |
+         (static_cast<uint64_t>(ExrGetUint32(in, pos + 4)) << 32);
+}
+
+/**
+ * @brief  Number of scanlines stored in each block for a compression method.
+ */
+int ExrLinesPerBlock(const ExrCompression compression) {
+  return (compression == EXR_ZIP_COMPRESSION) ? 16 : 1;
+}
+
+/**
+ * @brief  Size in bytes of one channel sample.
+ */
+int ExrBytesPerSample(const ExrPixelType type) {
+  return (type == EXR_HALF) ? 2 : 4;
+}
+
+/**
+ * @brief  Builds the magic number, version, and header attributes of an
+ *         RGB image.  The offset table follows directly after.
+ */
+std::string ExrHeader(const int width, const int height, const ExrOptions &options) {
+  std::string header;
+  ExrPutUint32(header, 20000630); // Magic number (76 2f 31 01)
+  ExrPutUint32(header, 2);        // Version 2, single part scanline image
+
+  // Channels must be listed in alphabetical order
+  std::string channels;
+  const char *NAMES[] = {"B", "G", "R"};
+  for (int i = 0; i < 3; ++i) {
+    channels.append(NAMES[i], 2);
+    ExrPutUint32(channels, options.pixelType);
+    ExrPutUint32(channels, 0);    // pLinear + reserved
+    ExrPutUint32(channels, 1);    // xSampling
+    ExrPutUint32(channels, 1);    // ySampling
+  }
+  channels.push_back('\0');
+  ExrPutAttribute(header, "channels", "chlist", channels);
+
+  ExrPutAttribute(header, "compression", "compression",
+                  std::string(1, static_cast<char>(options.compression)));
+
+  std::string window;
+  ExrPutUint32(window, 0);
+  ExrPutUint32(window, 0);
+  ExrPutUint32(window, static_cast<uint32_t>(width - 1));
+  ExrPutUint32(window, static_cast<uint32_t>(height - 1));
+  ExrPutAttribute(header, "dataWindow", "box2i", window);
+  ExrPutAttribute(header, "displayWindow", "box2i", window);
+
+  // Increasing y
+  ExrPutAttribute(header, "lineOrder", "lineOrder", std::string(1, '\0'));
+
+  std::string value;
+  ExrPutFloat(value, 1.0f);
+  ExrPutAttribute(header, "pixelAspectRatio", "float", value);
+
+  value.clear();
+  ExrPutFloat(value, 0.0f);
+  ExrPutFloat(value, 0.0f);
+  ExrPutAttribute(header, "screenWindowCenter", "v2f", value);
+
+  value.clear();
+  ExrPutFloat(value, 1.0f);
+  ExrPutAttribute(header, "screenWindowWidth", "float", value);
+
+  // End of header
+  header.push_back('\0');
+  return header;
+}
+
+/**
+ * @brief  Compresses a block with the EXR ZIP filter: the bytes are split
+ *         into even and odd halves (separating the low and high bytes of
+ *         each sample), delta encoded, then deflated.
+ * @return bool: False if zlib fails
+ */
+bool ExrZipPack(const std::string &raw, const int level, std::string &packed) {
+  const size_t SIZE = raw.size();
+  std::string filtered(SIZE, '\0');
+
+  // Interleave
+  size_t even = 0, odd = (SIZE + 1) / 2;
+  for (size_t i = 0; i < SIZE; ++i) {
+    filtered[(i % 2 == 0) ? even++ : odd++] = raw[i];
+  }
+
+  // Predictor
+  int previous = (SIZE > 0) ? static_cast<unsigned char>(filtered[0]) : 0;
+  for (size_t i = 1; i < SIZE; ++i) {
+    const int CURRENT = static_cast<unsigned char>(filtered[i]);
+    filtered[i] = static_cast<char>((CURRENT - previous + 128 + 256) & 0xff);
+    previous = CURRENT;
+  }
+
+  uLongf packedSize = compressBound(static_cast<uLong>(SIZE));
+  packed.resize(packedSize);
+  if (compress2(reinterpret_cast<Bytef *>(&packed[0]), &packedSize,
+                reinterpret_cast<const Bytef *>(filtered.data()),
+                static_cast<uLong>(SIZE), level) != Z_OK) {
+    return false;
+  }
+  packed.resize(packedSize);
+  return true;
+}
+
+/**
+ * @brief  Reverses ExrZipPack().
+ * @param rawSize: Size of the uncompressed block
+ * @return bool: False if the data is corrupt
+ */
+bool ExrZipUnpack(const std::string &packed, const size_t rawSize, std::string &raw) {
+  std::string filtered(rawSize, '\0');
+  uLongf size = static_cast<uLongf>(rawSize);
+  if (uncompress(reinterpret_cast<Bytef *>(&filtered[0]), &size,
+                 reinterpret_cast<const Bytef *>(packed.data()),
+                 static_cast<uLong>(packed.size())) != Z_OK || size != rawSize) {
+    return false;
+  }
+
+  // Predictor
+  for (size_t i = 1; i < rawSize; ++i) {
+    filtered[i] = static_cast<char>((static_cast<unsigned char>(filtered[i - 1]) +
+                                     static_cast<unsigned char>(filtered[i]) - 128) & 0xff);
+  }
+
+  // Deinterleave
+  raw.resize(rawSize);
+  size_t even = 0, odd = (rawSize + 1) / 2;
+  for (size_t i = 0; i < rawSize; ++i) {
+    raw[i] = filtered[(i % 2 == 0) ? even++ : odd++];
+  }
+  return true;
+}
+
+/**
+ * @brief  Encodes a canvas as an EXR image in memory.  Scanline blocks are
+ *         packed and compressed in parallel on the scheduler.
+ * @return bool: False if the canvas is empty or compression fails
+ */
+bool EncodeExr(const Canvas &canvas, const ExrOptions &options,
+               TileScheduler &scheduler, std::string &out) {
+  TRACE_SCOPE("EncodeExr");
+  const int WIDTH  = canvas.GetWidth();
+  const int HEIGHT = canvas.GetHeight();
+  if (WIDTH <= 0 || HEIGHT <= 0) {
+    return false;
+  }
+
+  // One band of tiles per scanline block
+  const std::vector<Tile> blocks = MakeBands(WIDTH, HEIGHT, ExrLinesPerBlock(options.compression));
+
+  // Each chunk is the block's first y, its data size, and its data
+  std::vector<std::string> chunks(blocks.size());
+  std::vector<char> failed(blocks.size(), 0);
+  scheduler.Run(blocks, [&](const Tile &block, const int) {
+    const int BYTES = ExrBytesPerSample(options.pixelType);
+    std::string raw;
+    raw.reserve(static_cast<size_t>(block.y1 - block.y0) * WIDTH * 3 * BYTES);
+
+    // Each scanline holds all of its B samples, then G, then R
+    for (int y = block.y0; y < block.y1; ++y) {
+      for (int channel = 0; channel < 3; ++channel) {
+        for (int x = 0; x < WIDTH; ++x) {
+          const Color PIXEL = canvas.PixelAt(x, y);
+          const float VALUE = (channel == 0) ? PIXEL.Blue() :
+                              (channel == 1) ? PIXEL.Green() : PIXEL.Red();
+          if (options.pixelType == EXR_HALF) {
+            const uint16_t HALF = FloatToHalf(VALUE);
+            raw.push_back(static_cast<char>(HALF & 0xff));
+            raw.push_back(static_cast<char>(HALF >> 8));
+          } else {
+            ExrPutFloat(raw, VALUE);
+          }
+        }
+      }
+    }
+
+    // Keep the block uncompressed if compression does not make it smaller
+    std::string packed;
+    const std::string *data = &raw;
+    if (options.compression != EXR_NO_COMPRESSION) {
+      if (!ExrZipPack(raw, options.level, packed)) {
+        failed[block.index] = 1;
+        return;
+      }
+      if (packed.size() < raw.size()) {
+        data = &packed;
+      }
+    }
+
+    std::string &chunk = chunks[block.index];
+    ExrPutUint32(chunk, static_cast<uint32_t>(block.y0));
+    ExrPutUint32(chunk, static_cast<uint32_t>(data->size()));
+    chunk.append(*data);
+  });
+
+  if (std::find(failed.begin(), failed.end(), 1) != failed.end()) {
+    return false;
+  }
+
+  // Header, then the absolute file offset of every chunk, then the chunks
+  out = ExrHeader(WIDTH, HEIGHT, options);
+  uint64_t offset = out.size() + 8 * chunks.size();
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    ExrPutUint64(out, offset);
+    offset += chunks[i].size();
+  }
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    out.append(chunks[i]);
+  }
+  return true;
+}
+
+/**
+ * @brief  Writes a canvas to an EXR file.
+ * @return bool: False if the image could not be encoded or written
+ */
+bool WriteExr(const Canvas &canvas, const std::string &filename,
+              const ExrOptions &options, TileScheduler &scheduler) {
+  TRACE_SCOPE("WriteExr");
+  std::string data;
+  if (!EncodeExr(canvas, options, scheduler, data)) {
+    return false;
+  }
+
+  FILE *output = fopen(filename.c_str(), "wb");
+  if (!output) {
+    return false;
+  }
+  const bool WRITTEN = fwrite(data.data(), 1, data.size(), output) == data.size();
+  return (fclose(output) == 0) && WRITTEN;
+}
+
+/*
+ * Limits on what DecodeExr() will allocate.  Decoded images are capped at
+ * 64M pixels (1 GB of Color), and a block can't unpack to more than
+ * deflate's best ratio (about 1032:1) times the size of the whole file, so
+ * a small corrupt file can't claim a huge image.
+ */
+static const int64_t EXR_MAX_PIXELS = int64_t(1) << 26;
+static const int64_t EXR_MAX_ZIP_RATIO = 1032;
+
+/**
+ * @brief  Decodes an EXR image from memory.  Accepts any single part
+ *         scanline image with HALF/FLOAT R, G, and B channels (other
+ *         channels are skipped) and NONE, ZIPS, or ZIP compression.
+ * @param pixels: Receives width * height colors in scanline order
+ * @return bool: False if the image is malformed or unsupported
+ */
+bool DecodeExr(const std::string &data, int &width, int &height, std::vector<Color> &pixels) {
+  if (data.size() < 8 || ExrGetUint32(data, 0) != 20000630 ||
+      (ExrGetUint32(data, 4) & 0xff) != 2 || (ExrGetUint32(data, 4) & ~0xffu) != 0) {
+    return false;
+  }
+
+  // Header attributes
+  std::vector<ExrChannel> channels;
+  int compression = -1;
+  int xMin = 0, yMin = 0, xMax = -1, yMax = -1;
+  size_t pos = 8;
+  while (true) {
+    const size_t NAME_END = data.find('\0', pos);
+    if (NAME_END == std::string::npos) {
+      return false;
+    }
+    const std::string NAME = data.substr(pos, NAME_END - pos);
+    pos = NAME_END + 1;
+    if (NAME.empty()) {
+      break;
+    }
+
+    const size_t TYPE_END = data.find('\0', pos);
+    if (TYPE_END == std::string::npos || TYPE_END + 5 > data.size()) {
+      return false;
+    }
+    const std::string TYPE = data.substr(pos, TYPE_END - pos);
+    const size_t SIZE = ExrGetUint32(data, TYPE_END + 1);
+    pos = TYPE_END + 5;
+    if (pos + SIZE > data.size()) {
+      return false;
+    }
+
+    if (NAME == "channels" && TYPE == "chlist") {
+      size_t c = pos;
+      while (c < pos + SIZE && data[c] != '\0') {
+        const size_t END = data.find('\0', c);
+        if (END == std::string::npos || END + 17 > pos + SIZE) {
+          return false;
+        }
+        ExrChannel channel;
+        channel.name = data.substr(c, END - c);
+        channel.type = static_cast<int>(ExrGetUint32(data, END + 1));
+        if ((channel.type != EXR_HALF && channel.type != EXR_FLOAT) ||
+            ExrGetUint32(data, END + 9) != 1 || ExrGetUint32(data, END + 13) != 1) {
+          return false;
+        }
+        channels.push_back(channel);
+        c = END + 17;
+      }
+    } else if (NAME == "compression" && SIZE == 1) {
+      compression = static_cast<unsigned char>(data[pos]);
+    } else if (NAME == "dataWindow" && SIZE == 16) {
+      xMin = static_cast<int32_t>(ExrGetUint32(data, pos));
+      yMin = static_cast<int32_t>(ExrGetUint32(data, pos + 4));
+      xMax = static_cast<int32_t>(ExrGetUint32(data, pos + 8));
+      yMax = static_cast<int32_t>(ExrGetUint32(data, pos + 12));
+    }
+    pos += SIZE;
+  }
+
+  if (compression != EXR_NO_COMPRESSION && compression != EXR_ZIPS_COMPRESSION &&
+      compression != EXR_ZIP_COMPRESSION) {
+    return false;
+  }
+  if (xMax < xMin || yMax < yMin) {
+    return false;
+  }
+
+  // The window's corners can be anywhere in the int range, so its size is
+  // computed in 64 bits before anything is allocated
+  const int64_t WIDTH  = static_cast<int64_t>(xMax) - xMin + 1;
+  const int64_t HEIGHT = static_cast<int64_t>(yMax) - yMin + 1;
+  if (WIDTH > EXR_MAX_PIXELS || HEIGHT > EXR_MAX_PIXELS || WIDTH * HEIGHT > EXR_MAX_PIXELS) {
+    return false;
+  }
+
+  // Locate the color channels and the size of one scanline
+  width  = static_cast<int>(WIDTH);
+  height = static_cast<int>(HEIGHT);
+  int red = -1, green = -1, blue = -1;
+  std::vector<size_t> channelOffsets;
+  size_t lineBytes = 0;
+  for (size_t i = 0; i < channels.size(); ++i) {
+    channelOffsets.push_back(lineBytes);
+    lineBytes += static_cast<size_t>(width) *
+                 ExrBytesPerSample(static_cast<ExrPixelType>(channels[i].type));
+    if (channels[i].name == "R") red   = static_cast<int>(i);
+    if (channels[i].name == "G") green = static_cast<int>(i);
+    if (channels[i].name == "B") blue  = static_cast<int>(i);
+  }
+  if (red < 0 || green < 0 || blue < 0) {
+    return false;
+  }
+
+  const int LINES = ExrLinesPerBlock(static_cast<ExrCompression>(compression));
+  const int NUM_CHUNKS = (height + LINES - 1) / LINES;
+  if (pos + 8 * static_cast<size_t>(NUM_CHUNKS) > data.size()) {
+    return false;
+  }
+
+  // Every block has to come out of the file, compressed at best
+  const int64_t MAX_BLOCK_BYTES = (compression == EXR_NO_COMPRESSION) ?
+                                  static_cast<int64_t>(data.size()) :
+                                  static_cast<int64_t>(data.size()) * EXR_MAX_ZIP_RATIO;
+  if (static_cast<int64_t>(lineBytes) * LINES > MAX_BLOCK_BYTES) {
+    return false;
+  }
+
+  pixels.assign(static_cast<size_t>(width) * height, Color(0, 0, 0));
+  const int COLOR_CHANNELS[3] = {red, green, blue};
+  for (int chunk = 0; chunk < NUM_CHUNKS; ++chunk) {
+    const uint64_t OFFSET = ExrGetUint64(data, pos + 8 * chunk);
+    if (OFFSET > data.size() - 8) {
+      return false;
+    }
+    const int64_t BLOCK_Y = static_cast<int64_t>(static_cast<int32_t>(ExrGetUint32(data, OFFSET))) - yMin;
+    const size_t SIZE = ExrGetUint32(data, OFFSET + 4);
+    if (BLOCK_Y < 0 || BLOCK_Y >= height || (BLOCK_Y % LINES) != 0 ||
+        OFFSET + 8 + SIZE > data.size()) {
+      return false;
+    }
+    const int Y0 = static_cast<int>(BLOCK_Y);
+
+    const int Y1 = std::min(Y0 + LINES, height);
+    const size_t RAW_SIZE = lineBytes * (Y1 - Y0);
+    std::string raw = data.substr(OFFSET + 8, SIZE);
+    if (SIZE < RAW_SIZE) {
+      std::string packed;
+      packed.swap(raw);
+      if (compression == EXR_NO_COMPRESSION || !ExrZipUnpack(packed, RAW_SIZE, raw)) {
+        return false;
+      }
+    } else if (SIZE != RAW_SIZE) {
+      return false;
+    }
+
+    for (int y = Y0; y < Y1; ++y) {
+      const size_t LINE = lineBytes * (y - Y0);
+      for (int x = 0; x < width; ++x) {
+        float rgb[3];
+        for (int c = 0; c < 3; ++c) {
+          const ExrChannel &CHANNEL = channels[COLOR_CHANNELS[c]];
+          const size_t BYTES = ExrBytesPerSample(static_cast<ExrPixelType>(CHANNEL.type));
+          const size_t AT = LINE + channelOffsets[COLOR_CHANNELS[c]] + BYTES * x;
+          if (CHANNEL.type == EXR_HALF) {
+            rgb[c] = HalfToFloat(static_cast<uint16_t>(
+                       static_cast<unsigned char>(raw[AT]) |
+                       (static_cast<unsigned char>(raw[AT + 1]) << 8)));
+          } else {
+            const uint32_t BITS = ExrGetUint32(raw, AT);
+            memcpy(&rgb[c], &BITS, sizeof(float));
+          }
+        }
+        pixels[static_cast<size_t>(y) * width + x] = Color(rgb[0], rgb[1], rgb[2]);
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief  Reads an EXR file (see DecodeExr()).
+ * @return bool: False if the file cannot be read or decoded
+ */
+bool ReadExr(const std::string &filename, int &width, int &height, std::vector<Color> &pixels) {
+  FILE *input = fopen(filename.c_str(), "rb");
+  if (!input) {
+    return false;
+  }
+
+  std::string data;
+  char buffer[65536];
+  size_t count;
+  while ((count = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+    data.append(buffer, count);
+  }
+  const bool READ = !ferror(input);
+  fclose(input);
+  return READ && DecodeExr(data, width, height, pixels);
+}
@@ -0,0 +1,94 @@
+#ifndef __EXR_IMAGE_H_
+#define __EXR_IMAGE_H_
+/*
+ * ExrImage.h
+ *
+ * Reads and writes canvases as OpenEXR scanline images.  Unlike PPM, EXR
+ * keeps the full high dynamic range of the render: pixels are stored as
+ * half or float R, G, B channels without clamping to [0, 1].
+ *
+ * The image is split into blocks of scanlines (16 lines for ZIP, 1 line for
+ * ZIPS and uncompressed images).  Each block is packed and compressed
+ * independently on the tile scheduler, then the blocks are written behind
+ * the header and the offset table in scanline order.
+ *
+ * Only the parts of the format needed for RGB images are supported: a
+ * single part scanline image with HALF/FLOAT channels and NONE, ZIPS, or
+ * ZIP compression.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Color.h"
+#include "Canvas.h"
+#include "Half.h"
+#include "TileScheduler.h"
+#include "FrameTrace.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief  Channel sample types (values match the file format).  Only HALF
+ *         and FLOAT are supported.
+ */
+enum ExrPixelType {
+  EXR_HALF  = 1,
+  EXR_FLOAT = 2
+};
+
+/**
+ * @brief  Block compression methods (values match the file format).
+ */
+enum ExrCompression {
+  EXR_NO_COMPRESSION   = 0,
+  EXR_ZIPS_COMPRESSION = 2, // zlib, one scanline per block
+  EXR_ZIP_COMPRESSION  = 3  // zlib, 16 scanlines per block
+};
+
+/**
+ * @brief  EXR output settings
+ */
+struct ExrOptions {
+  ExrOptions() : pixelType(EXR_HALF), compression(EXR_ZIP_COMPRESSION), level(6) {
+  }
+
+  ExrPixelType pixelType;
+  ExrCompression compression;
+
+  // zlib compression level (1 = fastest, 9 = smallest)
+  int level;
+};
+
+/**
+ * @brief  A channel stored in a file.  Channels are listed (and their
+ *         samples stored within each scanline) in alphabetical order.
+ */
+struct ExrChannel {
+  std::string name;
+  int type;
+};
+
+// Function Prototypes
+void ExrPutUint32(std::string &, const uint32_t);
+void ExrPutUint64(std::string &, const uint64_t);
+void ExrPutFloat(std::string &, const float);
+void ExrPutAttribute(std::string &, const char *, const char *, const std::string &);
+uint32_t ExrGetUint32(const std::string &, const size_t);
+uint64_t ExrGetUint64(const std::string &, const size_t);
+int ExrLinesPerBlock(const ExrCompression);
+int ExrBytesPerSample(const ExrPixelType);
+std::string ExrHeader(const int, const int, const ExrOptions &);
+bool ExrZipPack(const std::string &, const int, std::string &);
+bool ExrZipUnpack(const std::string &, const size_t, std::string &);
+bool EncodeExr(const Canvas &, const ExrOptions &, TileScheduler &, std::string &);
+bool WriteExr(const Canvas &, const std::string &, const ExrOptions &, TileScheduler &);
+bool DecodeExr(const std::string &, int &, int &, std::vector<Color> &);
+bool ReadExr(const std::string &, int &, int &, std::vector<Color> &);
+#endif
@@ -0,0 +1,376 @@
+#ifndef __FIXED_MATRIX_H_
+#define __FIXED_MATRIX_H_
+/*
+ * FixedMatrix.h
+ *
+ * Matrix whose dimensions are template parameters.  The values live inside
+ * the object (no heap storage) and every operation is constexpr, so a
+ * transform built from constants is folded at compile time, and multiplying
+ * matrices of mismatched sizes is a compile error rather than garbage.
+ *
+ * A FixedMatrix converts implicitly to a Matrix, so it can be passed
+ * anywhere a Matrix is expected (SetTransform(), Inverse(), ...).
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Matrix.h"
+#include "Tuple.h"
+
+#include <cassert>
+
+template <int R, int C, typename T = float>
+class FixedMatrix {
+public:
+  static_assert(R > 0 && C > 0, "FixedMatrix dimensions must be positive");
+
+  /**
+   * @brief  Constructs a matrix of zeros.
+   */
+  constexpr FixedMatrix() : values_() {
+  }
+
+  /**
+   * @brief  Constructs a matrix from its values in row major order.
+   */
+  template <typename... Values>
+  constexpr FixedMatrix(const T first, const Values... rest) :
+    values_{first, static_cast<T>(rest)...} {
+    static_assert(sizeof...(Values) + 1 == R * C, "Wrong number of FixedMatrix values");
+  }
+
+  // Dimensions
+  static constexpr int Rows() { return R; }
+  static constexpr int Cols() { return C; }
+
+  // Accessor/modifier functions
+  constexpr T GetValue(const int y, const int x) const {
+    return values_[y * C + x];
+  }
+
+  constexpr void SetValue(const int y, const int x, const T val) {
+    values_[y * C + x] = val;
+  }
+
+  /**
+   * @brief  Comparison operator==, with the same tolerance as Matrix.
+   */
+  constexpr bool operator==(const FixedMatrix &rhs) const {
+    for (int i = 0; i < R * C; ++i) {
+      const T DIFFERENCE = values_[i] - rhs.values_[i];
+      if (DIFFERENCE > T(0.0001) || DIFFERENCE < T(-0.0001)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  constexpr bool operator!=(const FixedMatrix &rhs) const {
+    return !operator==(rhs);
+  }
+
+  /**
+   * @brief  Conversion to a heap backed Matrix.
+   */
+  operator Matrix() const {
+    Matrix result(R, C);
+    for (int y = 0; y < R; ++y) {
+      for (int x = 0; x < C; ++x) {
+        result.SetValue(y, x, static_cast<float>(GetValue(y, x)));
+      }
+    }
+    return result;
+  }
+
+private:
+  // Values in row major order
+  T values_[R * C];
+};
+
+// The transforms used by the tracer
+typedef FixedMatrix<4, 4> Matrix4;
+
+/**
+ * @brief  N x N identity matrix.
+ */
+template <int N, typename T = float>
+constexpr FixedMatrix<N, N, T> FixedIdentity() {
+  FixedMatrix<N, N, T> result;
+  for (int i = 0; i < N; ++i) {
+    result.SetValue(i, i, T(1));
+  }
+  return result;
+}
+
+/**
+ * @brief  Matrix multiplication.  The inner dimensions must match.
+ */
+template <int R, int K, int C, typename T>
+constexpr FixedMatrix<R, C, T> operator*(const FixedMatrix<R, K, T> &lhs,
+                                         const FixedMatrix<K, C, T> &rhs) {
+  FixedMatrix<R, C, T> result;
+  for (int y = 0; y < R; ++y) {
+    for (int x = 0; x < C; ++x) {
+      T dotProduct = T(0);
+      for (int i = 0; i < K; ++i) {
+        dotProduct += lhs.GetValue(y, i) * rhs.GetValue(i, x);
+      }
+      result.SetValue(y, x, dotProduct);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief  4x4 matrix times a point or vector.
+ */
+template <typename T>
+Tuple operator*(const FixedMatrix<4, 4, T> &lhs, const Tuple &rhs) {
+  float values[4];
+  for (int y = 0; y < 4; ++y) {
+    values[y] = static_cast<float>(lhs.GetValue(y, 0) * rhs.X() + lhs.GetValue(y, 1) * rhs.Y() +
+                                   lhs.GetValue(y, 2) * rhs.Z() + lhs.GetValue(y, 3) * rhs.W());
+  }
+  return Tuple(values[0], values[1], values[2], values[3]);
+}
+
+/**
+ * @brief  Mixed FixedMatrix and Matrix operations, done on Matrix.  (A
+ *         Matrix on the left hand side already converts the FixedMatrix.)
+ */
+template <int R, int C, typename T>
+Matrix operator*(const FixedMatrix<R, C, T> &lhs, const Matrix &rhs) {
+  return Matrix(lhs) * rhs;
+}
+
+template <int R, int C, typename T>
+bool operator==(const FixedMatrix<R, C, T> &lhs, const Matrix &rhs) {
+  return Matrix(lhs) == rhs;
+}
+
+template <int R, int C, typename T>
+bool operator!=(const FixedMatrix<R, C, T> &lhs, const Matrix &rhs) {
+  return !(lhs == rhs);
+}
+
+/**
+ * @brief  Computes the transpose of a matrix.
+ */
+template <int R, int C, typename T>
+constexpr FixedMatrix<C, R, T> Transpose(const FixedMatrix<R, C, T> &mat) {
+  FixedMatrix<C, R, T> result;
+  for (int y = 0; y < R; ++y) {
+    for (int x = 0; x < C; ++x) {
+      result.SetValue(x, y, mat.GetValue(y, x));
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief  Removes the specified row and column from a matrix.
+ */
+template <int N, typename T>
+constexpr FixedMatrix<N - 1, N - 1, T> Submatrix(const FixedMatrix<N, N, T> &mat,
+                                                 const int row, const int col) {
+  FixedMatrix<N - 1, N - 1, T> result;
+  for (int y = 0, outY = 0; y < N; ++y) {
+    if (y == row) {
+      continue;
+    }
+    for (int x = 0, outX = 0; x < N; ++x) {
+      if (x == col) {
+        continue;
+      }
+      result.SetValue(outY, outX, mat.GetValue(y, x));
+      ++outX;
+    }
+    ++outY;
+  }
+  return result;
+}
+
+/**
+ * @brief  Determinants of the small sizes are written out in full; larger
+ *         ones expand along the first row.
+ */
+template <int N, typename T>
+struct FixedDeterminant {
+  static constexpr T Compute(const FixedMatrix<N, N, T> &mat) {
+    T det = T(0);
+    for (int x = 0; x < N; ++x) {
+      const T MINOR = FixedDeterminant<N - 1, T>::Compute(Submatrix(mat, 0, x));
+      det += (x % 2 == 0 ? MINOR : -MINOR) * mat.GetValue(0, x);
+    }
+    return det;
+  }
+};
+
+template <typename T>
+struct FixedDeterminant<1, T> {
+  static constexpr T Compute(const FixedMatrix<1, 1, T> &mat) {
+    return mat.GetValue(0, 0);
+  }
+};
+
+template <typename T>
+struct FixedDeterminant<2, T> {
+  static constexpr T Compute(const FixedMatrix<2, 2, T> &mat) {
+    return mat.GetValue(0, 0) * mat.GetValue(1, 1) - mat.GetValue(0, 1) * mat.GetValue(1, 0);
+  }
+};
+
+template <typename T>
+struct FixedDeterminant<3, T> {
+  static constexpr T Compute(const FixedMatrix<3, 3, T> &m) {
+    return m.GetValue(0, 0) * (m.GetValue(1, 1) * m.GetValue(2, 2) - m.GetValue(1, 2) * m.GetValue(2, 1)) -
+           m.GetValue(0, 1) * (m.GetValue(1, 0) * m.GetValue(2, 2) - m.GetValue(1, 2) * m.GetValue(2, 0)) +
+           m.GetValue(0, 2) * (m.GetValue(1, 0) * m.GetValue(2, 1) - m.GetValue(1, 1) * m.GetValue(2, 0));
+  }
+};
+
+/**
+ * @brief  4x4 inverse from the 2x2 minors of the top and bottom row pairs
+ *         (Laplace expansion), sharing them between the cofactors.
+ */
+template <typename T>
+struct FixedInverse4 {
+  // 2x2 minor of rows r and r+1 and columns c0 and c1
+  static constexpr T Minor(const FixedMatrix<4, 4, T> &m, const int r,
+                           const int c0, const int c1) {
+    return m.GetValue(r, c0) * m.GetValue(r + 1, c1) - m.GetValue(r, c1) * m.GetValue(r + 1, c0);
+  }
+
+  static constexpr T Determinant(const FixedMatrix<4, 4, T> &m) {
+    const T S0 = Minor(m, 0, 0, 1), S1 = Minor(m, 0, 0, 2), S2 = Minor(m, 0, 0, 3);
+    const T S3 = Minor(m, 0, 1, 2), S4 = Minor(m, 0, 1, 3), S5 = Minor(m, 0, 2, 3);
+    const T C5 = Minor(m, 2, 2, 3), C4 = Minor(m, 2, 1, 3), C3 = Minor(m, 2, 1, 2);
+    const T C2 = Minor(m, 2, 0, 3), C1 = Minor(m, 2, 0, 2), C0 = Minor(m, 2, 0, 1);
+    return S0 * C5 - S1 * C4 + S2 * C3 + S3 * C2 - S4 * C1 + S5 * C0;
+  }
+
+  static constexpr FixedMatrix<4, 4, T> Compute(const FixedMatrix<4, 4, T> &m) {
+    const T S0 = Minor(m, 0, 0, 1), S1 = Minor(m, 0, 0, 2), S2 = Minor(m, 0, 0, 3);
+    const T S3 = Minor(m, 0, 1, 2), S4 = Minor(m, 0, 1, 3), S5 = Minor(m, 0, 2, 3);
+    const T C5 = Minor(m, 2, 2, 3), C4 = Minor(m, 2, 1, 3), C3 = Minor(m, 2, 1, 2);
+    const T C2 = Minor(m, 2, 0, 3), C1 = Minor(m, 2, 0, 2), C0 = Minor(m, 2, 0, 1);
+
+    const T DET = S0 * C5 - S1 * C4 + S2 * C3 + S3 * C2 - S4 * C1 + S5 * C0;
+    const T INV = T(1) / DET;
+
+    T a[4][4] = {};
+    for (int y = 0; y < 4; ++y) {
+      for (int x = 0; x < 4; ++x) {
+        a[y][x] = m.GetValue(y, x);
+      }
+    }
+    return FixedMatrix<4, 4, T>(
+      ( a[1][1] * C5 - a[1][2] * C4 + a[1][3] * C3) * INV,
+      (-a[0][1] * C5 + a[0][2] * C4 - a[0][3] * C3) * INV,
+      ( a[3][1] * S5 - a[3][2] * S4 + a[3][3] * S3) * INV,
+      (-a[2][1] * S5 + a[2][2] * S4 - a[2][3] * S3) * INV,
+
+      (-a[1][0] * C5 + a[1][2] * C2 - a[1][3] * C1) * INV,
+      ( a[0][0] * C5 - a[0][2] * C2 + a[0][3] * C1) * INV,
+      (-a[3][0] * S5 + a[3][2] * S2 - a[3][3] * S1) * INV,
+      ( a[2][0] * S5 - a[2][2] * S2 + a[2][3] * S1) * INV,
+
+      ( a[1][0] * C4 - a[1][1] * C2 + a[1][3] * C0) * INV,
+      (-a[0][0] * C4 + a[0][1] * C2 - a[0][3] * C0) * INV,
+      ( a[3][0] * S4 - a[3][1] * S2 + a[3][3] * S0) * INV,
+      (-a[2][0] * S4 + a[2][1] * S2 - a[2][3] * S0) * INV,
+
+      (-a[1][0] * C3 + a[1][1] * C1 - a[1][2] * C0) * INV,
+      ( a[0][0] * C3 - a[0][1] * C1 + a[0][2] * C0) * INV,
+      (-a[3][0] * S3 + a[3][1] * S1 - a[3][2] * S0) * INV,
+      ( a[2][0] * S3 - a[2][1] * S1 + a[2][2] * S0) * INV);
+  }
+};
+
+template <typename T>
+struct FixedDeterminant<4, T> {
+  static constexpr T Compute(const FixedMatrix<4, 4, T> &mat) {
+    return FixedInverse4<T>::Determinant(mat);
+  }
+};
+
+/**
+ * @brief  Computes the determinant of a square matrix.
+ */
+template <int N, typename T>
+constexpr T Determinant(const FixedMatrix<N, N, T> &mat) {
+  return FixedDeterminant<N, T>::Compute(mat);
+}
+
+/**
+ * @brief  Computes the cofactor of the element at (row, col).
+ */
+template <int N, typename T>
+constexpr T Cofactor(const FixedMatrix<N, N, T> &mat, const int row, const int col) {
+  const T MINOR = Determinant(Submatrix(mat, row, col));
+  return ((row + col) % 2 == 0) ? MINOR : -MINOR;
+}
+
+/**
+ * @brief  Whether a square matrix can be inverted.
+ */
+template <int N, typename T>
+constexpr bool IsInvertible(const FixedMatrix<N, N, T> &mat) {
+  return Determinant(mat) != T(0);
+}
+
+/**
+ * @brief  Inverse of a square matrix by cofactors.  The matrix must be
+ *         invertible.
+ */
+template <int N, typename T>
+struct FixedInverse {
+  static constexpr FixedMatrix<N, N, T> Compute(const FixedMatrix<N, N, T> &mat) {
+    const T DET = Determinant(mat);
+    FixedMatrix<N, N, T> result;
+    for (int y = 0; y < N; ++y) {
+      for (int x = 0; x < N; ++x) {
+        // Transposed: the inverse is the adjugate over the determinant
+        result.SetValue(x, y, Cofactor(mat, y, x) / DET);
+      }
+    }
+    return result;
+  }
+};
+
+template <typename T>
+struct FixedInverse<1, T> {
+  static constexpr FixedMatrix<1, 1, T> Compute(const FixedMatrix<1, 1, T> &mat) {
+    return FixedMatrix<1, 1, T>(T(1) / mat.GetValue(0, 0));
+  }
+};
+
+template <typename T>
+struct FixedInverse<4, T> {
+  static constexpr FixedMatrix<4, 4, T> Compute(const FixedMatrix<4, 4, T> &mat) {
+    return FixedInverse4<T>::Compute(mat);
+  }
+};
+
+/**
+ * @brief  Computes the inverse of a square matrix.  The matrix must be
+ *         invertible.
+ */
+template <int N, typename T>
+constexpr FixedMatrix<N, N, T> Inverse(const FixedMatrix<N, N, T> &mat) {
+  return FixedInverse<N, T>::Compute(mat);
+}
+
+/**
+ * @brief  Copies a Matrix of the right size into a FixedMatrix.
+ */
+template <int R, int C, typename T>
+void ToFixedMatrix(const Matrix &mat, FixedMatrix<R, C, T> &result) {
+  assert(mat.GetRows() == R && mat.GetCols() == C);
+  for (int y = 0; y < R; ++y) {
+    for (int x = 0; x < C; ++x) {
+      result.SetValue(y, x, static_cast<T>(mat.GetValue(y, x)));
+    }
+  }
+}
+#endif
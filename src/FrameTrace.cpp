@@ -0,0 +1,225 @@
+/*
+ * FrameTrace.cpp
+ *
+ * Span recording and Chrome trace export.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "FrameTrace.h"
+
+/**
+ * @brief  The process wide trace state.
+ */
+FrameTraceState &GetFrameTraceState() {
+  static FrameTraceState state;
+  return state;
+}
+
+/**
+ * @brief  The calling thread's ring, if it has one.  The ring is handed
+ *         back for reuse when the thread exits.
+ */
+struct ThreadRingOwner {
+  ThreadRingOwner() : ring(NULL) {
+  }
+
+  ~ThreadRingOwner() {
+    if (ring) {
+      std::lock_guard<std::mutex> lock(GetFrameTraceState().mutex);
+      ring->inUse = false;
+    }
+  }
+
+  TraceRing *ring;
+
+  // Name set by SetTraceThreadName(), applied when the ring is created
+  std::string name;
+};
+
+static ThreadRingOwner &ThreadRing() {
+  static thread_local ThreadRingOwner owner;
+  return owner;
+}
+
+/**
+ * @brief  The calling thread's ring, created on first use.  Reuses the
+ *         ring of an exited thread if it holds no spans of the current
+ *         trace.
+ */
+TraceRing &ThreadTraceRing() {
+  ThreadRingOwner &owner = ThreadRing();
+  if (!owner.ring) {
+    FrameTraceState &state = GetFrameTraceState();
+    const unsigned int SESSION = state.session.load();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (size_t r = 0; r < state.rings.size() && !owner.ring; ++r) {
+      TraceRing &ring = *state.rings[r];
+      if (!ring.inUse && (ring.session.load() != SESSION || ring.count.load() == 0)) {
+        owner.ring = &ring;
+      }
+    }
+    if (!owner.ring) {
+      state.rings.push_back(std::unique_ptr<TraceRing>(
+        new TraceRing(static_cast<int>(state.rings.size()) + 1)));
+      owner.ring = state.rings.back().get();
+    }
+    owner.ring->inUse = true;
+    owner.ring->name  = owner.name;
+  }
+  return *owner.ring;
+}
+
+/**
+ * @brief  Monotonic time in nanoseconds.
+ */
+int64_t TraceClock() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief  Discards any previous trace and starts recording spans.  Should
+ *         not be called while traced work is running on other threads.
+ */
+void StartFrameTrace() {
+  FrameTraceState &state = GetFrameTraceState();
+  state.epoch.store(TraceClock());
+  state.session.fetch_add(1);
+  state.enabled.store(true);
+}
+
+/**
+ * @brief  Stops recording spans.  Spans already recorded are kept for export.
+ */
+void StopFrameTrace() {
+  GetFrameTraceState().enabled.store(false);
+}
+
+/**
+ * @brief  Whether spans are currently being recorded.
+ */
+bool FrameTraceEnabled() {
+  return GetFrameTraceState().enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief  Names the calling thread in exported traces.  The name is kept
+ *         with the thread and does not create a ring.
+ */
+void SetTraceThreadName(const std::string &name) {
+  ThreadRingOwner &owner = ThreadRing();
+  owner.name = name;
+  if (owner.ring) {
+    std::lock_guard<std::mutex> lock(GetFrameTraceState().mutex);
+    owner.ring->name = name;
+  }
+}
+
+/**
+ * @brief  Adds a span to the calling thread's ring.
+ * @param start, end: TraceClock() times the span began and ended
+ */
+void RecordTraceSpan(const char *name, const int64_t start, const int64_t end) {
+  const FrameTraceState &state = GetFrameTraceState();
+  const unsigned int SESSION = state.session.load(std::memory_order_relaxed);
+  const int64_t EPOCH = state.epoch.load(std::memory_order_relaxed);
+
+  TraceRing &ring = ThreadTraceRing();
+  size_t count = ring.count.load(std::memory_order_relaxed);
+  if (ring.session.load(std::memory_order_relaxed) != SESSION) {
+    ring.session.store(SESSION, std::memory_order_relaxed);
+    count = 0;
+  }
+  if (ring.spans.empty()) {
+    ring.spans.resize(TraceRing::CAPACITY);
+  }
+
+  TraceSpan &span = ring.spans[count % TraceRing::CAPACITY];
+  span.name  = name;
+  span.start = start - EPOCH;
+  span.end   = end - EPOCH;
+  ring.count.store(count + 1, std::memory_order_release);
+}
+
+/**
+ * @brief  Escapes a string for use inside a JSON string literal.
+ */
+std::string TraceEscape(const std::string &text) {
+  std::string escaped;
+  for (size_t i = 0; i < text.size(); ++i) {
+    const unsigned char C = static_cast<unsigned char>(text[i]);
+    if (C == '"' || C == '\\') {
+      escaped += '\\';
+      escaped += static_cast<char>(C);
+    } else if (C < 0x20) {
+      char code[8];
+      snprintf(code, sizeof(code), "\\u%04x", C);
+      escaped += code;
+    } else {
+      escaped += static_cast<char>(C);
+    }
+  }
+  return escaped;
+}
+
+/**
+ * @brief  Formats the spans of the current trace as Chrome trace event
+ *         JSON: one complete ("X") event per span and one thread_name
+ *         metadata event per thread.  Call once the traced work is finished.
+ */
+std::string ChromeTraceJson() {
+  FrameTraceState &state = GetFrameTraceState();
+  const unsigned int SESSION = state.session.load();
+
+  std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  char line[256];
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  for (size_t r = 0; r < state.rings.size(); ++r) {
+    const TraceRing &RING = *state.rings[r];
+    if (RING.session.load() != SESSION) {
+      continue;
+    }
+    const size_t COUNT = RING.count.load(std::memory_order_acquire);
+    if (COUNT == 0) {
+      continue;
+    }
+
+    const std::string NAME = RING.name.empty() ? "thread " + std::to_string(RING.tid) : RING.name;
+    snprintf(line, sizeof(line),
+             "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"",
+             first ? "" : ",", RING.tid);
+    json += line;
+    json += TraceEscape(NAME) + "\"}}";
+    first = false;
+
+    // Oldest surviving span first
+    const size_t CAPACITY = TraceRing::CAPACITY;
+    const size_t KEPT = COUNT < CAPACITY ? COUNT : CAPACITY;
+    for (size_t i = COUNT - KEPT; i < COUNT; ++i) {
+      const TraceSpan &SPAN = RING.spans[i % TraceRing::CAPACITY];
+      json += ",\n{\"name\":\"" + TraceEscape(SPAN.name) + "\"";
+      snprintf(line, sizeof(line), ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+               RING.tid, SPAN.start / 1000.0, (SPAN.end - SPAN.start) / 1000.0);
+      json += line;
+    }
+  }
+  json += "\n]}\n";
+  return json;
+}
+
+/**
+ * @brief  Writes ChromeTraceJson() to a file.
+ * @return bool: False if the file could not be written
+ */
+bool WriteChromeTrace(const std::string &filename) {
+  const std::string JSON = ChromeTraceJson();
+  FILE *output = fopen(filename.c_str(), "wb");
+  if (!output) {
+    return false;
+  }
+  const bool WRITTEN = fwrite(JSON.data(), 1, JSON.size(), output) == JSON.size();
+  return (fclose(output) == 0) && WRITTEN;
+}
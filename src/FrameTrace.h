@@ -0,0 +1,134 @@
+#ifndef __FRAME_TRACE_H_
+#define __FRAME_TRACE_H_
+/*
+ * FrameTrace.h
+ *
+ * A lightweight timeline profiler.  TRACE_SCOPE("name") records how long the
+ * enclosing scope took on the calling thread; WriteChromeTrace() exports the
+ * recorded spans as Chrome trace event JSON, which can be opened in
+ * chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Each thread records into its own fixed size ring buffer, so recording a
+ * span never takes a lock.  When a ring fills up the oldest spans are
+ * overwritten.  While tracing is stopped a span costs one atomic load.
+ *
+ * Span names must be string literals (or otherwise outlive the trace).
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief  One timed scope.  Times are nanoseconds since StartFrameTrace().
+ */
+struct TraceSpan {
+  const char *name;
+  int64_t start, end;
+};
+
+/**
+ * @brief  Spans recorded by one thread.  Only the owning thread writes to
+ *         the ring; the exporter reads it once the traced work is finished.
+ */
+struct TraceRing {
+  // Spans kept per thread before the oldest are overwritten
+  static const size_t CAPACITY = 16384;
+
+  explicit TraceRing(const int tid) : tid(tid), inUse(false), session(0), count(0) {
+  }
+
+  // Thread id shown in the trace viewer
+  const int tid;
+
+  // Thread name shown in the trace viewer (empty for "thread <tid>")
+  std::string name;
+
+  // True while the thread that owns the ring is running (guarded by the state mutex)
+  bool inUse;
+
+  // Trace the spans belong to; spans from an older trace are discarded
+  std::atomic<unsigned int> session;
+
+  // Total spans recorded in this session (may exceed CAPACITY)
+  std::atomic<size_t> count;
+
+  // Allocated when the thread records its first span
+  std::vector<TraceSpan> spans;
+};
+
+/**
+ * @brief  Trace wide state.  Rings are never freed, so spans recorded by
+ *         threads that have since exited can still be exported.  A thread
+ *         only gets a ring when it records a span, and takes over the ring
+ *         of an exited thread once that ring holds no spans of the current
+ *         trace.
+ */
+struct FrameTraceState {
+  FrameTraceState() : enabled(false), session(0), epoch(0) {
+  }
+
+  std::atomic<bool> enabled;
+  std::atomic<unsigned int> session;
+
+  // steady_clock time (ns) that span times are relative to
+  std::atomic<int64_t> epoch;
+
+  // Guards rings and each ring's name and inUse (only taken when a thread
+  // gets or gives up a ring, or renames itself)
+  std::mutex mutex;
+  std::vector<std::unique_ptr<TraceRing> > rings;
+};
+
+// Function Prototypes
+FrameTraceState &GetFrameTraceState();
+TraceRing &ThreadTraceRing();
+int64_t TraceClock();
+void StartFrameTrace();
+void StopFrameTrace();
+bool FrameTraceEnabled();
+void SetTraceThreadName(const std::string &);
+void RecordTraceSpan(const char *, const int64_t, const int64_t);
+std::string TraceEscape(const std::string &);
+std::string ChromeTraceJson();
+bool WriteChromeTrace(const std::string &);
+
+/**
+ * @brief  Records the rest of the enclosing scope as a span.
+ */
+class ScopedTraceSpan {
+public:
+  explicit ScopedTraceSpan(const char *name) : name_(NULL), start_(0) {
+    if (FrameTraceEnabled()) {
+      name_  = name;
+      start_ = TraceClock();
+    }
+  }
+
+  ~ScopedTraceSpan() {
+    if (name_) {
+      RecordTraceSpan(name_, start_, TraceClock());
+    }
+  }
+
+private:
+  ScopedTraceSpan(const ScopedTraceSpan &);
+  ScopedTraceSpan &operator=(const ScopedTraceSpan &);
+
+  // NULL if tracing was stopped when the scope was entered
+  const char *name_;
+  int64_t start_;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name) ScopedTraceSpan TRACE_CONCAT(traceSpan_, __LINE__)(name)
+#endif
@@ -0,0 +1,91 @@
+/*
+ * Half.cpp
+ *
+ * Conversions between float and IEEE half precision.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Half.h"
+
+/**
+ * @brief  Converts a float to the nearest half (ties to even).  Values too
+ *         large for a half become infinity; NaN stays NaN.
+ */
+uint16_t FloatToHalf(const float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+
+  const uint32_t SIGN = (bits >> 16) & 0x8000;
+  const int EXPONENT = static_cast<int>((bits >> 23) & 0xff);
+  uint32_t mantissa = bits & 0x7fffff;
+
+  // Infinity and NaN
+  if (EXPONENT == 0xff) {
+    return static_cast<uint16_t>(SIGN | 0x7c00 | (mantissa ? 0x200 : 0));
+  }
+
+  // Rebias the exponent from 127 to 15
+  const int HALF_EXPONENT = EXPONENT - 127 + 15;
+  if (HALF_EXPONENT >= 31) {
+    return static_cast<uint16_t>(SIGN | 0x7c00);
+  }
+
+  if (HALF_EXPONENT <= 0) {
+    // Too small even for a subnormal half
+    if (HALF_EXPONENT < -10) {
+      return static_cast<uint16_t>(SIGN);
+    }
+
+    // Subnormal: shift the mantissa (with its implicit 1) into place
+    mantissa |= 0x800000;
+    const int SHIFT = 14 - HALF_EXPONENT;
+    uint32_t half = mantissa >> SHIFT;
+    const uint32_t REMAINDER = mantissa & ((1u << SHIFT) - 1);
+    const uint32_t HALFWAY = 1u << (SHIFT - 1);
+    if (REMAINDER > HALFWAY || (REMAINDER == HALFWAY && (half & 1))) {
+      ++half;
+    }
+    return static_cast<uint16_t>(SIGN | half);
+  }
+
+  // Normal: rounding may carry into the exponent, which is still correct
+  uint32_t half = (static_cast<uint32_t>(HALF_EXPONENT) << 10) | (mantissa >> 13);
+  const uint32_t REMAINDER = mantissa & 0x1fff;
+  if (REMAINDER > 0x1000 || (REMAINDER == 0x1000 && (half & 1))) {
+    ++half;
+  }
+  return static_cast<uint16_t>(SIGN | half);
+}
+
+/**
+ * @brief  Converts a half to a float (exact).
+ */
+float HalfToFloat(const uint16_t half) {
+  const uint32_t SIGN = static_cast<uint32_t>(half & 0x8000) << 16;
+  const uint32_t EXPONENT = (half >> 10) & 0x1f;
+  uint32_t mantissa = half & 0x3ff;
+  uint32_t bits;
+
+  if (EXPONENT == 0) {
+    if (mantissa == 0) {
+      bits = SIGN;
+    } else {
+      // Subnormal: normalize the mantissa
+      int shift = 0;
+      while (!(mantissa & 0x400)) {
+        mantissa <<= 1;
+        ++shift;
+      }
+      bits = SIGN | (static_cast<uint32_t>(113 - shift) << 23) | ((mantissa & 0x3ff) << 13);
+    }
+  } else if (EXPONENT == 31) {
+    bits = SIGN | 0x7f800000 | (mantissa << 13);
+  } else {
+    bits = SIGN | ((EXPONENT + 112) << 23) | (mantissa << 13);
+  }
+
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
@@ -0,0 +1,20 @@
+#ifndef __HALF_H_
+#define __HALF_H_
+/*
+ * Half.h
+ *
+ * Conversion between 32 bit floats and IEEE 754 half precision (16 bit)
+ * floats: 1 sign bit, 5 exponent bits, and 10 mantissa bits.  Halves
+ * cover about 6e-8 to 65504 with 3 significant digits, which is plenty for
+ * storing HDR images at half the size of floats.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include <cstring>
+#include <stdint.h>
+
+// Function Prototypes
+uint16_t FloatToHalf(const float);
+float HalfToFloat(const uint16_t);
+#endif
@@ -0,0 +1,81 @@
+/*
+ * IncrementalRenderer.cpp
+ *
+ * Scene change detection for the incremental renderer.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "IncrementalRenderer.h"
+
+/**
+ * @brief  Computes the world space bounding box of a sphere by transforming
+ *         the corners of the unit cube around it.
+ */
+void SphereBounds(const Sphere &sphere, Tuple &boxMin, Tuple &boxMax) {
+  const Matrix &TRANSFORM = sphere.Transform();
+
+  for (int corner = 0; corner < 8; ++corner) {
+    const Tuple PT = TRANSFORM * Point((corner & 1) ? 1 : -1,
+                                       (corner & 2) ? 1 : -1,
+                                       (corner & 4) ? 1 : -1);
+    if (corner == 0) {
+      boxMin = boxMax = PT;
+      continue;
+    }
+    boxMin = Point(std::min(boxMin.X(), PT.X()), std::min(boxMin.Y(), PT.Y()),
+                   std::min(boxMin.Z(), PT.Z()));
+    boxMax = Point(std::max(boxMax.X(), PT.X()), std::max(boxMax.Y(), PT.Y()),
+                   std::max(boxMax.Z(), PT.Z()));
+  }
+}
+
+/**
+ * @brief  Checks if two axis aligned boxes overlap (touching counts).
+ */
+bool BoxesOverlap(const Tuple &aMin, const Tuple &aMax,
+                  const Tuple &bMin, const Tuple &bMax) {
+  return aMin.X() <= bMax.X() && bMin.X() <= aMax.X() &&
+         aMin.Y() <= bMax.Y() && bMin.Y() <= aMax.Y() &&
+         aMin.Z() <= bMax.Z() && bMin.Z() <= aMax.Z();
+}
+
+/**
+ * @brief  Computes the pixels a world space box can cover when seen through
+ *         the camera, padded by one pixel.  Boxes reaching behind the camera
+ *         cover the whole canvas.
+ * @return ScreenRect: Covered pixels, clipped to the canvas (may be empty)
+ */
+ScreenRect ProjectBounds(const Camera &camera, const Tuple &boxMin, const Tuple &boxMax) {
+  ScreenRect rect;
+  rect.x0 = 0;
+  rect.y0 = 0;
+  rect.x1 = camera.HSize();
+  rect.y1 = camera.VSize();
+
+  float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+  for (int corner = 0; corner < 8; ++corner) {
+    const Tuple PT = camera.Transform() * Point((corner & 1) ? boxMax.X() : boxMin.X(),
+                                                (corner & 2) ? boxMax.Y() : boxMin.Y(),
+                                                (corner & 4) ? boxMax.Z() : boxMin.Z());
+
+    // The camera looks down -z; anything at or behind the eye is unbounded
+    if (PT.Z() >= -SURFACE_EPSILON) {
+      return rect;
+    }
+
+    // Project onto the canvas at z = -1 and convert to pixel coordinates
+    const float PX = (camera.HalfWidth()  - PT.X() / -PT.Z()) / camera.PixelSize();
+    const float PY = (camera.HalfHeight() - PT.Y() / -PT.Z()) / camera.PixelSize();
+    minX = std::min(minX, PX);
+    maxX = std::max(maxX, PX);
+    minY = std::min(minY, PY);
+    maxY = std::max(maxY, PY);
+  }
+
+  rect.x0 = std::max(rect.x0, static_cast<int>(std::floor(minX)) - 1);
+  rect.y0 = std::max(rect.y0, static_cast<int>(std::floor(minY)) - 1);
+  rect.x1 = std::min(rect.x1, static_cast<int>(std::ceil(maxX)) + 1);
+  rect.y1 = std::min(rect.y1, static_cast<int>(std::ceil(maxY)) + 1);
+  return rect;
+}
@@ -0,0 +1,197 @@
+#ifndef __INCREMENTAL_RENDERER_H_
+#define __INCREMENTAL_RENDERER_H_
+/*
+ * IncrementalRenderer.h
+ *
+ * Re-renders only the tiles of a frame that an edit to the world can affect.
+ * While a tile is traced, every object hit by its primary, shadow, and
+ * secondary rays is recorded, along with a box around its shadow and
+ * secondary ray segments.  Editing an object then invalidates:
+ *
+ * - Tiles whose rays hit the object (this covers its old position).
+ * - Tiles within the screen space bounds of the object's old and new
+ *   positions (primary rays that may now hit it).
+ * - Tiles whose shadow/secondary segments pass through the object's new
+ *   bounds, or that have a secondary ray escaping to infinity (rays that
+ *   may now be blocked by it).
+ *
+ * Material edits do not move geometry, so only the first rule applies.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "Matrix.h"
+#include "Canvas.h"
+#include "Camera.h"
+#include "Material.h"
+#include "RaySphere.h"
+#include "World.h"
+#include "TileScheduler.h"
+#include "FrameTrace.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief  A rectangle of pixels: [x0, x1) x [y0, y1).
+ */
+struct ScreenRect {
+  int x0, y0, x1, y1;
+};
+
+// Function Prototypes
+void SphereBounds(const Sphere &, Tuple &, Tuple &);
+bool BoxesOverlap(const Tuple &, const Tuple &, const Tuple &, const Tuple &);
+ScreenRect ProjectBounds(const Camera &, const Tuple &, const Tuple &);
+
+/**
+ * @brief  IncrementalRenderer class
+ */
+class IncrementalRenderer {
+public:
+  /**
+   * @brief Constructor.  Every tile starts out invalid.  The world and
+   *        scheduler must outlive the renderer.
+   */
+  IncrementalRenderer(World &world, const Camera &camera, TileScheduler &scheduler,
+                      const int tileSize = 16) :
+    world_(world),
+    camera_(camera),
+    scheduler_(scheduler),
+    tiles_(MakeTiles(camera.HSize(), camera.VSize(), std::max(1, tileSize))),
+    records_(tiles_.size()),
+    dirty_(tiles_.size(), 1) {
+  }
+
+  /**
+   * @brief Destructor
+   */
+  ~IncrementalRenderer() {
+  }
+
+  /**
+   * @brief Re-traces every invalid tile onto the canvas.  The canvas must
+   *        hold the result of the previous Update() for the valid tiles.
+   * @return int: Number of tiles that were traced
+   */
+  int Update(Canvas &canvas) {
+    TRACE_SCOPE("IncrementalRenderer::Update");
+    std::vector<Tile> work;
+    for (size_t i = 0; i < tiles_.size(); ++i) {
+      if (dirty_[i]) {
+        work.push_back(tiles_[i]);
+      }
+    }
+
+    scheduler_.Run(work, [this, &canvas](const Tile &tile, const int) {
+      TraceRecord record;
+      for (int y = tile.y0; y < tile.y1; ++y) {
+        for (int x = tile.x0; x < tile.x1; ++x) {
+          canvas.WritePixel(x, y, ColorAt(world_, RayForPixel(camera_, x, y), 0, 1.0, &record));
+        }
+      }
+
+      // Only membership matters, so keep each ID once
+      std::sort(record.objectIDs.begin(), record.objectIDs.end());
+      record.objectIDs.erase(std::unique(record.objectIDs.begin(), record.objectIDs.end()),
+                             record.objectIDs.end());
+      records_[tile.index] = record;
+      dirty_[tile.index]   = 0;
+    });
+
+    return static_cast<int>(work.size());
+  }
+
+  /**
+   * @brief Replaces the material of world.Objects()[index] and invalidates
+   *        the tiles that saw the object.
+   */
+  void SetMaterial(const size_t index, const Material &mat) {
+    Sphere &obj = world_.Objects()[index];
+    obj.SetMaterial(mat);
+    InvalidateObject(obj.ID());
+  }
+
+  /**
+   * @brief Replaces the transform of world.Objects()[index] and invalidates
+   *        the tiles that saw the object or may see it at its new position.
+   */
+  void SetTransform(const size_t index, const Matrix &transform) {
+    Sphere &obj = world_.Objects()[index];
+
+    Tuple oldMin, oldMax, newMin, newMax;
+    SphereBounds(obj, oldMin, oldMax);
+    obj.SetTransform(transform);
+    SphereBounds(obj, newMin, newMax);
+
+    InvalidateObject(obj.ID());
+    InvalidateRect(ProjectBounds(camera_, oldMin, oldMax));
+    InvalidateRect(ProjectBounds(camera_, newMin, newMax));
+
+    for (size_t i = 0; i < tiles_.size(); ++i) {
+      const TraceRecord &RECORD = records_[i];
+      if (RECORD.escaped ||
+          (RECORD.hasBounds && BoxesOverlap(RECORD.boundsMin, RECORD.boundsMax, newMin, newMax))) {
+        dirty_[i] = 1;
+      }
+    }
+  }
+
+  /**
+   * @brief Invalidates every tile (e.g. after adding objects or lights).
+   */
+  void InvalidateAll() {
+    std::fill(dirty_.begin(), dirty_.end(), 1);
+  }
+
+  // Accessor functions
+  int NumTiles() const { return static_cast<int>(tiles_.size()); }
+  int DirtyTiles() const { return static_cast<int>(std::count(dirty_.begin(), dirty_.end(), 1)); }
+
+private:
+  /**
+   * @brief Invalidates the tiles whose rays hit the object.
+   */
+  void InvalidateObject(const int id) {
+    for (size_t i = 0; i < tiles_.size(); ++i) {
+      const std::vector<int> &IDS = records_[i].objectIDs;
+      if (std::binary_search(IDS.begin(), IDS.end(), id)) {
+        dirty_[i] = 1;
+      }
+    }
+  }
+
+  /**
+   * @brief Invalidates the tiles overlapping the rectangle of pixels.
+   */
+  void InvalidateRect(const ScreenRect &rect) {
+    for (size_t i = 0; i < tiles_.size(); ++i) {
+      const Tile &TILE = tiles_[i];
+      if (TILE.x0 < rect.x1 && rect.x0 < TILE.x1 && TILE.y0 < rect.y1 && rect.y0 < TILE.y1) {
+        dirty_[i] = 1;
+      }
+    }
+  }
+
+  // The renderer keeps a pointer to its scheduler, so it cannot be copied
+  IncrementalRenderer(const IncrementalRenderer &);
+  IncrementalRenderer &operator=(const IncrementalRenderer &);
+
+  // Scene being rendered
+  World &world_;
+  Camera camera_;
+
+  // Worker pool and the tiles of the frame
+  TileScheduler &scheduler_;
+  std::vector<Tile> tiles_;
+
+  // What each tile's rays touched the last time it was traced
+  std::vector<TraceRecord> records_;
+
+  // Non-zero for tiles that must be traced by the next Update()
+  std::vector<char> dirty_;
+};
+#endif
@@ -0,0 +1,49 @@
+/*
+ * Lighting.cpp
+ *
+ * Phong lighting model.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Lighting.h"
+#include "kernels/Kernels.h"
+
+/**
+ * @brief  Computes the Phong Lighting Model constants.  The shading itself
+ *         is done by the shadePhong kernel for the CPU's instruction set.
+ * @param inShadow: If true, only the ambient contribution is returned
+ */
+Color Lighting(const Material &mat, const PointLight &pl, const Tuple &pt,
+              const Tuple &eye, const Tuple &normal, const bool inShadow) {
+  const Color COLOR = mat.GetColor();
+  const Tuple POSITION = pl.Position();
+  const Color INTENSITY = pl.Intensity();
+
+  KernelMaterial material;
+  material.color[0]  = COLOR.Red();
+  material.color[1]  = COLOR.Green();
+  material.color[2]  = COLOR.Blue();
+  material.ambient   = mat.Ambient();
+  material.diffuse   = mat.Diffuse();
+  material.specular  = mat.Specular();
+  material.shininess = mat.Shininess();
+
+  KernelLight light;
+  light.position[0]  = POSITION.X();
+  light.position[1]  = POSITION.Y();
+  light.position[2]  = POSITION.Z();
+  light.intensity[0] = INTENSITY.Red();
+  light.intensity[1] = INTENSITY.Green();
+  light.intensity[2] = INTENSITY.Blue();
+
+  float point[4], eyeVector[4], normalVector[4], color[4];
+  pt.Store(point);
+  eye.Store(eyeVector);
+  normal.Store(normalVector);
+  const uint8_t SHADOW = inShadow ? 1 : 0;
+  GetRenderKernels().shadePhong(material, light, point, eyeVector, normalVector, &SHADOW, 1,
+                                color);
+
+  return Color(color[0], color[1], color[2]);
+}
@@ -23,7 +23,10 @@ public:
     ambient_(0.1),
     diffuse_(0.9),
     specular_(0.9),
-    shininess_(200.0) {
+    shininess_(200.0),
+    reflective_(0.0),
+    transparency_(0.0),
+    refractiveIndex_(1.0) {
   }
 
   /**
@@ -40,7 +43,10 @@ public:
     ambient_(rhs.ambient_),
     diffuse_(rhs.diffuse_),
     specular_(rhs.specular_),
-    shininess_(rhs.shininess_) {
+    shininess_(rhs.shininess_),
+    reflective_(rhs.reflective_),
+    transparency_(rhs.transparency_),
+    refractiveIndex_(rhs.refractiveIndex_) {
   }
 
   /**
@@ -54,6 +60,9 @@ public:
       diffuse_ = rhs.diffuse_;
       specular_ = rhs.specular_;
       shininess_ = rhs.shininess_;
+      reflective_ = rhs.reflective_;
+      transparency_ = rhs.transparency_;
+      refractiveIndex_ = rhs.refractiveIndex_;
     }
     return *this;
   }
@@ -66,7 +75,10 @@ public:
            IsEqual(ambient_, rhs.ambient_) &&
            IsEqual(diffuse_, rhs.diffuse_) &&
            IsEqual(specular_, rhs.specular_) &&
-           IsEqual(shininess_, rhs.shininess_);
+           IsEqual(shininess_, rhs.shininess_) &&
+           IsEqual(reflective_, rhs.reflective_) &&
+           IsEqual(transparency_, rhs.transparency_) &&
+           IsEqual(refractiveIndex_, rhs.refractiveIndex_);
   }
 
   // Accessor functions
@@ -75,6 +87,9 @@ public:
   float Diffuse() const { return diffuse_; }
   float Specular() const { return specular_; }
   float Shininess() const { return shininess_; }
+  float Reflective() const { return reflective_; }
+  float Transparency() const { return transparency_; }
+  float RefractiveIndex() const { return refractiveIndex_; }
 
   // Modifier functions
   void SetColor(const Color &clr) { color_ = clr; }
@@ -82,6 +97,9 @@ public:
   void SetDiffuse(const float dif) { diffuse_ = dif; }
   void SetSpecular(const float spec) { specular_ = spec; }
   void SetShininess(const float shi) { shininess_ = shi; }
+  void SetReflective(const float ref) { reflective_ = ref; }
+  void SetTransparency(const float trans) { transparency_ = trans; }
+  void SetRefractiveIndex(const float idx) { refractiveIndex_ = idx; }
 
 private:
   /**
@@ -105,5 +123,14 @@ private:
 
   // Shininess
   float shininess_;
+
+  // Fraction of light mirrored off the surface (0 = matte, 1 = perfect mirror)
+  float reflective_;
+
+  // Fraction of light passed through the surface (0 = opaque, 1 = clear)
+  float transparency_;
+
+  // Index of refraction (1.0 = vacuum, 1.5 = glass)
+  float refractiveIndex_;
 };
 #endif
@@ -0,0 +1,130 @@
+/*
+ * ParticleSystem.cpp
+ *
+ * Structure of arrays particle simulation.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "ParticleSystem.h"
+#include "kernels/Kernels.h"
+
+#include <atomic>
+#include <cmath>
+
+// Particles per task when a tick is split across threads
+static const size_t PARTICLES_PER_TASK = 1 << 16;
+
+unsigned int ParticleSystem::Steps(const float frameTime, float &dt) {
+  if (fixedTimestep_ <= 0) {
+    dt = frameTime;
+    return 1;
+  }
+
+  dt = fixedTimestep_;
+  accumulator_ += frameTime;
+  const unsigned int STEPS = static_cast<unsigned int>(std::floor(accumulator_ / fixedTimestep_));
+  accumulator_ -= STEPS * fixedTimestep_;
+  return STEPS;
+}
+
+size_t ParticleSystem::Tick(const float dt, const unsigned int steps, const size_t first,
+                            const size_t count) {
+  const float ACCELERATION[3] = {acceleration_.X(), acceleration_.Y(), acceleration_.Z()};
+  return GetRenderKernels().tickParticles(ACCELERATION, dt, steps,
+                                          positions_.x.data() + first,
+                                          positions_.y.data() + first,
+                                          positions_.z.data() + first,
+                                          velocities_.x.data() + first,
+                                          velocities_.y.data() + first,
+                                          velocities_.z.data() + first,
+                                          life_.data() + first, count);
+}
+
+void ParticleSystem::Compact() {
+  // Fill each gap with the last particle, so only the expired particles'
+  // slots are written instead of shifting every particle after them
+  size_t count = life_.size();
+  size_t i = 0;
+  while (i < count) {
+    if (life_[i] > 0) {
+      ++i;
+      continue;
+    }
+
+    --count;
+    positions_.x[i]  = positions_.x[count];
+    positions_.y[i]  = positions_.y[count];
+    positions_.z[i]  = positions_.z[count];
+    velocities_.x[i] = velocities_.x[count];
+    velocities_.y[i] = velocities_.y[count];
+    velocities_.z[i] = velocities_.z[count];
+    life_[i]         = life_[count];
+  }
+
+  positions_.x.resize(count);
+  positions_.y.resize(count);
+  positions_.z.resize(count);
+  velocities_.x.resize(count);
+  velocities_.y.resize(count);
+  velocities_.z.resize(count);
+  life_.resize(count);
+}
+
+unsigned int ParticleSystem::Update(const float frameTime) {
+  float dt = 0;
+  const unsigned int STEPS = Steps(frameTime, dt);
+  if (STEPS > 0 && Tick(dt, STEPS, 0, Size()) > 0) {
+    Compact();
+  }
+  return STEPS;
+}
+
+unsigned int ParticleSystem::Update(const float frameTime, TileScheduler &scheduler) {
+  const size_t COUNT = Size();
+  if (COUNT <= PARTICLES_PER_TASK || scheduler.NumThreads() == 1) {
+    return Update(frameTime);
+  }
+
+  float dt = 0;
+  const unsigned int STEPS = Steps(frameTime, dt);
+  if (STEPS == 0) {
+    return 0;
+  }
+
+  // Each task is a Tile covering particles [x0, x1)
+  std::vector<Tile> tasks;
+  for (size_t start = 0; start < COUNT; start += PARTICLES_PER_TASK) {
+    Tile task;
+    task.x0    = static_cast<int>(start);
+    task.y0    = 0;
+    task.x1    = static_cast<int>(std::min(start + PARTICLES_PER_TASK, COUNT));
+    task.y1    = 1;
+    task.index = static_cast<int>(tasks.size());
+    tasks.push_back(task);
+  }
+
+  std::atomic<size_t> expired(0);
+  scheduler.Run(tasks, [&](const Tile &task, const int) {
+    expired += Tick(dt, STEPS, task.x0, task.x1 - task.x0);
+  });
+
+  if (expired > 0) {
+    Compact();
+  }
+  return STEPS;
+}
+
+void ParticleSystem::Rasterize(Canvas &canvas, const Color &color) const {
+  const float WIDTH  = static_cast<float>(canvas.GetWidth());
+  const float HEIGHT = static_cast<float>(canvas.GetHeight());
+  for (size_t i = 0; i < Size(); ++i) {
+    const float X = positions_.x[i];
+    const float Y = HEIGHT - positions_.y[i];
+
+    // Check before converting: particles far off the canvas overflow an int
+    if (X >= 0 && X < WIDTH && Y >= 0 && Y < HEIGHT) {
+      canvas.WritePixel(static_cast<int>(X), static_cast<int>(Y), color);
+    }
+  }
+}
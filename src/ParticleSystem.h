@@ -0,0 +1,103 @@
+#ifndef __PARTICLE_SYSTEM_H_
+#define __PARTICLE_SYSTEM_H_
+/*
+ * ParticleSystem.h
+ *
+ * Many projectiles at once: the Cannon model (constant gravity and wind)
+ * applied to particles stored as structures of arrays.  A tick runs on the
+ * tickParticles render kernel, optionally split across the threads of a
+ * TileScheduler, and particles whose lifetime runs out are removed by
+ * compacting the arrays in place.
+ *
+ * With a fixed timestep, Update() takes as many whole steps as fit in the
+ * elapsed time and carries the remainder over to the next frame, so the
+ * motion does not depend on the frame rate.  Gravity and wind are
+ * constant, so the kernel takes all of a frame's steps at once in closed
+ * form.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Canvas.h"
+#include "Color.h"
+#include "TileScheduler.h"
+#include "Tuple.h"
+#include "TupleArrays.h"
+
+#include <vector>
+
+class ParticleSystem {
+public:
+  /**
+   * @brief  Constructor.  Variable timestep: each Update() is one step.
+   * @param gravity: Acceleration due to gravity
+   * @param wind: Acceleration due to wind
+   */
+  ParticleSystem(const Tuple &gravity, const Tuple &wind) :
+    acceleration_(gravity + wind), fixedTimestep_(0), accumulator_(0) {
+  }
+
+  /**
+   * @brief  Adds a particle that lives for lifetime units of time.
+   */
+  void Emit(const Tuple &position, const Tuple &velocity, const float lifetime) {
+    positions_.Add(position);
+    velocities_.Add(velocity);
+    life_.push_back(lifetime);
+  }
+
+  /**
+   * @brief  Advances time by whole steps of the given length (0 for a
+   *         variable timestep).  Any time left over is discarded.
+   */
+  void SetFixedTimestep(const float step) {
+    fixedTimestep_ = step;
+    accumulator_ = 0;
+  }
+
+  /**
+   * @brief  Advances every particle by frameTime, then removes the particles
+   *         with no life left.  Removing particles reorders the rest, so
+   *         particle indices are only valid until the next Update().
+   * @return Number of steps taken
+   */
+  unsigned int Update(const float frameTime);
+  unsigned int Update(const float frameTime, TileScheduler &scheduler);
+
+  /**
+   * @brief  Plots each particle's x and y, with y pointing up from the
+   *         bottom of the canvas like the Cannon app.
+   */
+  void Rasterize(Canvas &canvas, const Color &color) const;
+
+  // Accessor functions
+  size_t Size() const { return life_.size(); }
+  Tuple Position(const size_t i) const { return positions_.PointAt(i); }
+  Tuple Velocity(const size_t i) const { return velocities_.VectorAt(i); }
+  float Lifetime(const size_t i) const { return life_[i]; }
+
+private:
+  // Disable copy constructor and assignment operator
+  ParticleSystem(const ParticleSystem &);
+  ParticleSystem &operator=(const ParticleSystem &);
+
+  // Number and length of the steps to take for frameTime
+  unsigned int Steps(const float frameTime, float &dt);
+
+  // Runs the kernel on particles [first, first + count)
+  size_t Tick(const float dt, const unsigned int steps, const size_t first, const size_t count);
+
+  // Removes the particles with no life left.  The order of the remaining
+  // particles changes.
+  void Compact();
+
+  Tuple acceleration_;
+  float fixedTimestep_;
+
+  // Time since the last fixed step
+  float accumulator_;
+
+  TupleArrays positions_, velocities_;
+  std::vector<float> life_;
+};
+#endif
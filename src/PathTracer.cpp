@@ -0,0 +1,154 @@
+/*
+ * PathTracer.cpp
+ *
+ * Monte Carlo path tracing.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "PathTracer.h"
+
+/**
+ * @brief  Computes the root-mean-square error of the averaged image against
+ *         a reference image of the same size.  Used to measure convergence.
+ */
+float RMSE(const AccumulationBuffer &image, const AccumulationBuffer &reference) {
+  double sumSq = 0.0;
+  for (int y = 0; y < image.GetHeight(); ++y) {
+    for (int x = 0; x < image.GetWidth(); ++x) {
+      const Color DIFF = image.Resolve(x, y) - reference.Resolve(x, y);
+      sumSq += DIFF.Red() * DIFF.Red() +
+               DIFF.Green() * DIFF.Green() +
+               DIFF.Blue() * DIFF.Blue();
+    }
+  }
+
+  const double COUNT = 3.0 * image.GetWidth() * image.GetHeight();
+  return static_cast<float>(sqrt(sumSq / COUNT));
+}
+
+/**
+ * @brief  Maps two uniform random numbers to a direction on the hemisphere
+ *         around the normal with probability density cos(theta)/pi.
+ */
+Tuple CosineSampleHemisphere(const Tuple &normal, const float u1, const float u2) {
+  // Uniformly sample the unit disk, then project up onto the hemisphere
+  const float R   = sqrtf(u1);
+  const float PHI = 2.0f * M_PI * u2;
+  const float X   = R * cosf(PHI);
+  const float Y   = R * sinf(PHI);
+  const float Z   = sqrtf(std::max(0.0f, 1.0f - u1));
+
+  // Build an orthonormal basis around the normal
+  const Tuple HELPER  = (std::fabs(normal.X()) > 0.9f) ? Vector(0, 1, 0) : Vector(1, 0, 0);
+  const Tuple TANGENT = Normalize(Cross(HELPER, normal));
+  const Tuple BITANGENT = Cross(normal, TANGENT);
+
+  return TANGENT * X + BITANGENT * Y + normal * Z;
+}
+
+/**
+ * @brief  Next-event estimation: the irradiance arriving at the shading
+ *         point directly from every unoccluded point light.
+ */
+Color DirectLighting(const World &world, const Computations &comps) {
+  Color irradiance;
+
+  const std::vector<PointLight> &LIGHTS = world.Lights();
+  COUNT_PIXEL_EVENT(shades, LIGHTS.size());
+  for (size_t i = 0; i < LIGHTS.size(); ++i) {
+    const Tuple TO_LIGHT = LIGHTS[i].Position() - comps.overPoint;
+    const float DIST_SQ  = Dot(TO_LIGHT, TO_LIGHT);
+    const float COS_THETA = Dot(TO_LIGHT, comps.normalv) / sqrtf(DIST_SQ);
+
+    if (COS_THETA > 0 && !IsShadowed(world, LIGHTS[i], comps.overPoint)) {
+      // Point lights fall off with the square of the distance
+      irradiance += LIGHTS[i].Intensity() * (COS_THETA / DIST_SQ);
+    }
+  }
+
+  return irradiance;
+}
+
+/**
+ * @brief  Estimates the radiance arriving along the ray by tracing a single
+ *         random path through the world.
+ *
+ *         At each hit one event is chosen at random: mirror reflection
+ *         (probability = Material::Reflective()), refraction (probability =
+ *         Material::Transparency()), or a diffuse bounce with the remaining
+ *         probability.  When a surface is both reflective and transparent the
+ *         two are split by Schlick's approximation.
+ */
+Color Radiance(const World &world, const Ray &cameraRay,
+               const PathTracerOptions &options, Pcg32 &rng) {
+  Color radiance;
+  Color throughput(1, 1, 1);
+  Ray ray = cameraRay;
+
+  for (int bounce = 0; bounce < options.maxBounces; ++bounce) {
+    if (bounce > 0) {
+      COUNT_RENDER_STAT(STAT_SECONDARY_RAYS, 1);
+    }
+    const std::vector<Intersection> XS = IntersectWorld(world, ray);
+    const Intersection HIT = Hit(XS);
+    if (HIT.T() == FLT_MAX) {
+      // Escaped the scene.  There is no environment light.
+      break;
+    }
+
+    const Computations COMPS = PrepareComputations(HIT, ray, XS);
+    const Material MAT = COMPS.object.GetMaterial();
+
+    // Probabilities of each scattering event
+    float pReflect = MAT.Reflective();
+    float pRefract = MAT.Transparency();
+    if (pReflect > 0 && pRefract > 0) {
+      const float FRESNEL = Schlick(COMPS);
+      pReflect *= FRESNEL;
+      pRefract *= (1 - FRESNEL);
+    }
+    const float P_SPECULAR = std::min(1.0f, pReflect + pRefract);
+
+    const float EVENT = rng.NextFloat();
+    if (EVENT < pReflect) {
+      // Perfect mirror.  The event's weight cancels its probability.
+      ray = Ray(COMPS.overPoint, COMPS.reflectv);
+    } else if (EVENT < P_SPECULAR) {
+      // Refraction by Snell's Law; falls back to reflection on total internal reflection
+      const float N_RATIO = COMPS.n1 / COMPS.n2;
+      const float COS_I   = Dot(COMPS.eyev, COMPS.normalv);
+      const float SIN2_T  = N_RATIO * N_RATIO * (1 - COS_I * COS_I);
+      if (SIN2_T > 1) {
+        ray = Ray(COMPS.overPoint, COMPS.reflectv);
+      } else {
+        const float COS_T = sqrtf(1.0f - SIN2_T);
+        const Tuple DIRECTION = COMPS.normalv * (N_RATIO * COS_I - COS_T) -
+                                COMPS.eyev * N_RATIO;
+        ray = Ray(COMPS.underPoint, Normalize(DIRECTION));
+      }
+    } else {
+      // Lambertian surface: BRDF = albedo/pi
+      const Color ALBEDO = MAT.GetColor() * MAT.Diffuse();
+      radiance += throughput * ALBEDO * DirectLighting(world, COMPS) * (1.0f / M_PI);
+
+      // Cosine-weighted sampling: BRDF * cos / pdf reduces to the albedo
+      const float U1 = rng.NextFloat();
+      const float U2 = rng.NextFloat();
+      ray = Ray(COMPS.overPoint, CosineSampleHemisphere(COMPS.normalv, U1, U2));
+      throughput *= ALBEDO;
+    }
+
+    // Russian roulette: randomly end dim paths, boosting the survivors
+    if (bounce >= options.rouletteDepth) {
+      const float SURVIVE = std::min(0.95f, std::max(throughput.Red(),
+                                     std::max(throughput.Green(), throughput.Blue())));
+      if (rng.NextFloat() >= SURVIVE) {
+        break;
+      }
+      throughput *= (1.0f / SURVIVE);
+    }
+  }
+
+  return radiance;
+}
@@ -0,0 +1,278 @@
+#ifndef __PATH_TRACER_H_
+#define __PATH_TRACER_H_
+/*
+ * PathTracer.h
+ *
+ * A progressive Monte Carlo path tracer built on top of the World/Camera
+ * classes.  Diffuse surfaces are sampled with a cosine-weighted hemisphere
+ * and lit by next-event estimation towards every PointLight; reflective and
+ * transparent surfaces are followed as perfect specular bounces.  Paths are
+ * terminated with Russian roulette.
+ *
+ * Samples are summed into a floating point AccumulationBuffer so that each
+ * call to RenderPass() refines the image further.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "Color.h"
+#include "Canvas.h"
+#include "Camera.h"
+#include "World.h"
+#include "TileScheduler.h"
+#include "Random.h"
+#include "FrameTrace.h"
+#include "RenderStats.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief  Path tracer settings
+ */
+struct PathTracerOptions {
+  PathTracerOptions() :
+    samplesPerPass(1),
+    maxBounces(16),
+    rouletteDepth(3),
+    numThreads(0),
+    tileSize(16),
+    seed(0) {
+  }
+
+  // Samples added to every pixel per call to RenderPass()
+  int samplesPerPass;
+
+  // Hard limit on the number of bounces along a path
+  int maxBounces;
+
+  // Number of bounces after which Russian roulette may terminate a path
+  int rouletteDepth;
+
+  // Worker threads (0 = one per hardware thread)
+  int numThreads;
+
+  // Edge length of a tile in pixels
+  int tileSize;
+
+  /*
+   * Render-wide seed.  Each sample of each pixel derives its own generator
+   * from this, so the image does not depend on the number of threads.
+   */
+  unsigned int seed;
+};
+
+/**
+ * @brief  Timing statistics for one or more render passes.
+ */
+struct RenderPassStats {
+  RenderPassStats() : samplesPerPixel(0), samples(0), seconds(0.0) {
+  }
+
+  // Samples per pixel rendered
+  int samplesPerPixel;
+
+  // Total camera samples (paths) traced
+  long long samples;
+
+  // Wall clock time spent tracing
+  double seconds;
+
+  double SamplesPerSecond() const {
+    return (seconds > 0.0) ? samples / seconds : 0.0;
+  }
+};
+
+/**
+ * @brief  Floating point buffer that sums samples per pixel.  Every pixel
+ *         holds the same number of samples, so the average is the sum divided
+ *         by Samples().
+ */
+class AccumulationBuffer {
+public:
+  /**
+   * @brief Constructor.  The buffer starts out empty (black).
+   */
+  AccumulationBuffer(const int width, const int height) :
+    width_(width), height_(height), samples_(0), sums_(width * height * 3, 0.0f) {
+  }
+
+  /**
+   * @brief Adds a sample to the pixel's running sum.  Safe to call
+   *        concurrently for different pixels.
+   */
+  void AddSample(const int x, const int y, const Color &color) {
+    float *px = &sums_[(y * width_ + x) * 3];
+    px[0] += color.Red();
+    px[1] += color.Green();
+    px[2] += color.Blue();
+  }
+
+  /**
+   * @brief Records that every pixel has received count more samples.
+   */
+  void AddSamples(const int count) { samples_ += count; }
+
+  /**
+   * @brief Resets the buffer to black with no samples.
+   */
+  void Clear() {
+    std::fill(sums_.begin(), sums_.end(), 0.0f);
+    samples_ = 0;
+  }
+
+  /**
+   * @brief Returns the average of the samples at the pixel.
+   */
+  Color Resolve(const int x, const int y) const {
+    if (samples_ == 0) {
+      return Color(0, 0, 0);
+    }
+    const float *px = &sums_[(y * width_ + x) * 3];
+    const float SCALE = 1.0f / samples_;
+    return Color(px[0] * SCALE, px[1] * SCALE, px[2] * SCALE);
+  }
+
+  /**
+   * @brief Writes the averaged samples onto the canvas.
+   */
+  void ResolveTo(Canvas &canvas) const {
+    for (int y = 0; y < height_; ++y) {
+      for (int x = 0; x < width_; ++x) {
+        canvas.WritePixel(x, y, Resolve(x, y));
+      }
+    }
+  }
+
+  // Accessor functions
+  int GetWidth() const { return width_; }
+  int GetHeight() const { return height_; }
+  int Samples() const { return samples_; }
+
+private:
+  // Buffer dimensions
+  int width_, height_;
+
+  // Number of samples summed into every pixel
+  int samples_;
+
+  // Running RGB sums, 3 floats per pixel in scanline order
+  std::vector<float> sums_;
+};
+
+// Function Prototypes
+float RMSE(const AccumulationBuffer &, const AccumulationBuffer &);
+Tuple CosineSampleHemisphere(const Tuple &, const float, const float);
+Color DirectLighting(const World &, const Computations &);
+Color Radiance(const World &, const Ray &, const PathTracerOptions &, Pcg32 &);
+
+/**
+ * @brief  PathTracer class.  Renders a world progressively on a pool of
+ *         worker threads.  Every sample seeds its own generator from
+ *         (seed, pixel, sample index), so results are reproducible
+ *         regardless of the thread count or tile order.
+ */
+class PathTracer {
+public:
+  /**
+   * @brief Constructor.  The world must outlive the path tracer.
+   */
+  PathTracer(const World &world, const Camera &camera,
+             const PathTracerOptions &options = PathTracerOptions()) :
+    world_(world),
+    camera_(camera),
+    options_(options),
+    scheduler_(options.numThreads),
+    tiles_(MakeTiles(camera.HSize(), camera.VSize(), std::max(1, options.tileSize))),
+    buffer_(camera.HSize(), camera.VSize()),
+    passes_(0) {
+  }
+
+  /**
+   * @brief Destructor
+   */
+  ~PathTracer() {
+  }
+
+  /**
+   * @brief Adds options.samplesPerPass samples to every pixel.
+   * @return RenderPassStats: Timing of this pass
+   */
+  RenderPassStats RenderPass() {
+    TRACE_SCOPE("PathTracer::RenderPass");
+    const std::chrono::steady_clock::time_point START = std::chrono::steady_clock::now();
+
+    const int SPP = options_.samplesPerPass;
+    const uint32_t FIRST_SAMPLE = static_cast<uint32_t>(buffer_.Samples());
+    scheduler_.Run(tiles_, [this, SPP, FIRST_SAMPLE](const Tile &tile, const int) {
+      for (int y = tile.y0; y < tile.y1; ++y) {
+        for (int x = tile.x0; x < tile.x1; ++x) {
+          const uint32_t PIXEL_SEED = HashCombine(HashCombine(options_.seed, x), y);
+
+          for (int s = 0; s < SPP; ++s) {
+            const uint32_t SAMPLE = FIRST_SAMPLE + s;
+            Pcg32 rng = PixelRng(options_.seed, x, y, SAMPLE);
+
+            // Stratify the sample positions within the pixel across samples
+            float dx, dy;
+            Sobol2D(SAMPLE, PIXEL_SEED, dx, dy);
+            const Color L = Radiance(world_, RayForPixel(camera_, x, y, dx, dy), options_, rng);
+
+            // Drop numerically broken paths instead of poisoning the pixel
+            if (std::isfinite(L.Red()) && std::isfinite(L.Green()) && std::isfinite(L.Blue())) {
+              buffer_.AddSample(x, y, L);
+            }
+          }
+        }
+      }
+    });
+    buffer_.AddSamples(SPP);
+    ++passes_;
+
+    RenderPassStats pass;
+    pass.samplesPerPixel = SPP;
+    pass.samples = static_cast<long long>(SPP) * camera_.HSize() * camera_.VSize();
+    pass.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - START).count();
+
+    total_.samplesPerPixel += pass.samplesPerPixel;
+    total_.samples         += pass.samples;
+    total_.seconds         += pass.seconds;
+    return pass;
+  }
+
+  /**
+   * @brief Discards all accumulated samples and statistics.
+   */
+  void Reset() {
+    buffer_.Clear();
+    total_  = RenderPassStats();
+    passes_ = 0;
+  }
+
+  // Accessor functions
+  const AccumulationBuffer &Buffer() const { return buffer_; }
+  const RenderPassStats &TotalStats() const { return total_; }
+  int Passes() const { return passes_; }
+  int NumThreads() const { return scheduler_.NumThreads(); }
+
+private:
+  // Scene being rendered
+  const World &world_;
+  Camera camera_;
+  PathTracerOptions options_;
+
+  // Worker pool and the tiles it renders
+  TileScheduler scheduler_;
+  std::vector<Tile> tiles_;
+
+  // Accumulated samples
+  AccumulationBuffer buffer_;
+
+  // Totals across all passes since the last Reset()
+  RenderPassStats total_;
+  int passes_;
+};
+#endif
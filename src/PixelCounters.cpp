@@ -0,0 +1,42 @@
+/*
+ * PixelCounters.cpp
+ *
+ * Per-thread pixel counter selection and the cycle counter.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "PixelCounters.h"
+
+/**
+ * @brief  The counters the calling thread is currently charging work to
+ *         (NULL when no pixel is being instrumented).
+ */
+PixelCounters *&ActivePixelCounters() {
+  static thread_local PixelCounters *counters = NULL;
+  return counters;
+}
+
+/**
+ * @brief  Whether the tracing code was compiled with its counting hooks.
+ *         If not, only cycles are recorded.
+ */
+bool PixelCountersEnabled() {
+#ifdef RENDER_COUNTERS
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief  Reads the CPU time stamp counter (nanoseconds on other CPUs).
+ */
+uint64_t ReadCycleCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
@@ -0,0 +1,70 @@
+#ifndef __PIXEL_COUNTERS_H_
+#define __PIXEL_COUNTERS_H_
+/*
+ * PixelCounters.h
+ *
+ * Optional per-pixel cost instrumentation.  When the renderer is compiled
+ * with RENDER_COUNTERS defined (the renderer_counters library), the tracing
+ * code counts the rays cast, object intersection tests, and lighting
+ * evaluations made for each pixel.  Without it, the COUNT_PIXEL_EVENT()
+ * hooks compile to nothing.
+ *
+ * The counters being incremented are selected per thread: the render loop
+ * points ActivePixelCounters() at the pixel's counters while tracing it.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+/**
+ * @brief  Work done to render one pixel.
+ */
+struct PixelCounters {
+  PixelCounters() : rays(0), intersects(0), shades(0), cycles(0) {
+  }
+
+  // Rays cast into the world (primary, reflected, refracted, and shadow)
+  uint64_t rays;
+
+  // Ray-object intersection tests
+  uint64_t intersects;
+
+  // Lighting (shading) evaluations
+  uint64_t shades;
+
+  // Time stamp counter ticks spent on the pixel
+  uint64_t cycles;
+
+  PixelCounters &operator+=(const PixelCounters &rhs) {
+    rays       += rhs.rays;
+    intersects += rhs.intersects;
+    shades     += rhs.shades;
+    cycles     += rhs.cycles;
+    return *this;
+  }
+};
+
+#ifdef RENDER_COUNTERS
+#define COUNT_PIXEL_EVENT(field, amount)                  \
+  do {                                                    \
+    PixelCounters *counters_ = ActivePixelCounters();     \
+    if (counters_) {                                      \
+      counters_->field += (amount);                       \
+    }                                                     \
+  } while (0)
+#else
+#define COUNT_PIXEL_EVENT(field, amount) do { } while (0)
+#endif
+
+// Function Prototypes
+PixelCounters *&ActivePixelCounters();
+bool PixelCountersEnabled();
+uint64_t ReadCycleCounter();
+#endif
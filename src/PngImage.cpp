@@ -0,0 +1,439 @@
+/*
+ * PngImage.cpp
+ *
+ * PNG encoding and decoding.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "PngImage.h"
+
+/**
+ * @brief  The Paeth predictor: whichever of left (a), up (b), or up-left
+ *         (c) is closest to a + b - c.
+ */
+uint8_t PngPaethPredictor(const uint8_t a, const uint8_t b, const uint8_t c) {
+  const int P  = a + b - c;
+  const int PA = abs(P - a);
+  const int PB = abs(P - b);
+  const int PC = abs(P - c);
+  if (PA <= PB && PA <= PC) {
+    return a;
+  }
+  return (PB <= PC) ? b : c;
+}
+
+/**
+ * @brief  Filters one byte x given its left (a), up (b), and up-left (c)
+ *         neighbors.
+ */
+uint8_t PngFilterByte(const PngFilter filter, const uint8_t x, const uint8_t a,
+                      const uint8_t b, const uint8_t c) {
+  const uint8_t PREDICTION = (filter == PNG_FILTER_SUB) ? a :
+                             (filter == PNG_FILTER_UP) ? b :
+                             (filter == PNG_FILTER_AVERAGE) ? (a + b) / 2 :
+                             (filter == PNG_FILTER_PAETH) ? PngPaethPredictor(a, b, c) : 0;
+  return static_cast<uint8_t>(x - PREDICTION);
+}
+
+/**
+ * @brief  Filters one row of RGB bytes.
+ * @param row: The row to filter (length bytes)
+ * @param previous: The unfiltered row above it (all zeros for the first row)
+ * @param out: Receives length filtered bytes (without the filter type byte)
+ */
+void PngFilterRow(const PngFilter filter, const uint8_t *row, const uint8_t *previous,
+                  const int length, uint8_t *out) {
+  // Bytes per pixel: the "left" byte is the same channel of the previous pixel
+  const int BPP = 3;
+
+  int i = 0;
+#ifdef __SSE2__
+  // The first pixel has no left neighbor, so the vector loop starts after it
+  for (; i < std::min(BPP, length); ++i) {
+    out[i] = PngFilterByte(filter, row[i], 0, previous[i], 0);
+  }
+
+  const __m128i ZERO = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    const __m128i X = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + i));
+    const __m128i A = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + i - BPP));
+    const __m128i B = _mm_loadu_si128(reinterpret_cast<const __m128i *>(previous + i));
+    const __m128i C = _mm_loadu_si128(reinterpret_cast<const __m128i *>(previous + i - BPP));
+
+    __m128i prediction = ZERO;
+    if (filter == PNG_FILTER_SUB) {
+      prediction = A;
+    } else if (filter == PNG_FILTER_UP) {
+      prediction = B;
+    } else if (filter == PNG_FILTER_AVERAGE) {
+      // _mm_avg_epu8 rounds up; PNG rounds down
+      prediction = _mm_sub_epi8(_mm_avg_epu8(A, B),
+                                _mm_and_si128(_mm_xor_si128(A, B), _mm_set1_epi8(1)));
+    } else if (filter == PNG_FILTER_PAETH) {
+      // Widen to 16 bits so the predictor distances cannot overflow
+      __m128i halves[2];
+      for (int h = 0; h < 2; ++h) {
+        const __m128i A16 = h ? _mm_unpackhi_epi8(A, ZERO) : _mm_unpacklo_epi8(A, ZERO);
+        const __m128i B16 = h ? _mm_unpackhi_epi8(B, ZERO) : _mm_unpacklo_epi8(B, ZERO);
+        const __m128i C16 = h ? _mm_unpackhi_epi8(C, ZERO) : _mm_unpacklo_epi8(C, ZERO);
+
+        // pa = |b - c|, pb = |a - c|, pc = |a + b - 2c|
+        const __m128i DB = _mm_sub_epi16(B16, C16);
+        const __m128i DA = _mm_sub_epi16(A16, C16);
+        const __m128i DC = _mm_add_epi16(DA, DB);
+        const __m128i PA = _mm_max_epi16(DB, _mm_sub_epi16(ZERO, DB));
+        const __m128i PB = _mm_max_epi16(DA, _mm_sub_epi16(ZERO, DA));
+        const __m128i PC = _mm_max_epi16(DC, _mm_sub_epi16(ZERO, DC));
+
+        const __m128i USE_A = _mm_andnot_si128(_mm_or_si128(_mm_cmpgt_epi16(PA, PB),
+                                                            _mm_cmpgt_epi16(PA, PC)),
+                                               _mm_set1_epi16(-1));
+        const __m128i USE_B = _mm_andnot_si128(_mm_cmpgt_epi16(PB, PC), _mm_set1_epi16(-1));
+        const __m128i B_OR_C = _mm_or_si128(_mm_and_si128(USE_B, B16),
+                                            _mm_andnot_si128(USE_B, C16));
+        halves[h] = _mm_or_si128(_mm_and_si128(USE_A, A16), _mm_andnot_si128(USE_A, B_OR_C));
+      }
+      prediction = _mm_packus_epi16(halves[0], halves[1]);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_sub_epi8(X, prediction));
+  }
+#endif
+
+  for (; i < length; ++i) {
+    out[i] = PngFilterByte(filter, row[i], (i >= BPP) ? row[i - BPP] : 0, previous[i],
+                           (i >= BPP) ? previous[i - BPP] : 0);
+  }
+}
+
+/**
+ * @brief  Estimates how well a filtered row will compress: the sum of the
+ *         bytes' magnitudes as signed values (smaller is better).
+ */
+uint32_t PngFilterCost(const uint8_t *filtered, const int length) {
+  uint32_t cost = 0;
+  int i = 0;
+#ifdef __SSE2__
+  const __m128i ZERO = _mm_setzero_si128();
+  __m128i sums = ZERO;
+  for (; i + 16 <= length; i += 16) {
+    const __m128i V = _mm_loadu_si128(reinterpret_cast<const __m128i *>(filtered + i));
+    const __m128i MAGNITUDE = _mm_min_epu8(V, _mm_sub_epi8(ZERO, V));
+    sums = _mm_add_epi64(sums, _mm_sad_epu8(MAGNITUDE, ZERO));
+  }
+  cost = static_cast<uint32_t>(_mm_cvtsi128_si32(sums) +
+                               _mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+#endif
+  for (; i < length; ++i) {
+    cost += std::min<uint32_t>(filtered[i], 256 - filtered[i]);
+  }
+  return cost;
+}
+
+/**
+ * @brief  Appends a big endian 32 bit value.
+ */
+void PngPutUint32(std::string &out, const uint32_t value) {
+  for (int i = 3; i >= 0; --i) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+/**
+ * @brief  Reads a big endian 32 bit value.
+ */
+uint32_t PngGetUint32(const std::string &in, const size_t pos) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    value = (value << 8) | static_cast<unsigned char>(in[pos + i]);
+  }
+  return value;
+}
+
+/**
+ * @brief  Appends a chunk: length, type, data, and the CRC of type + data.
+ * @param dataCrc: CRC-32 of the data alone
+ */
+void PngPutChunk(std::string &out, const char *type, const std::string &data,
+                 const uint32_t dataCrc) {
+  PngPutUint32(out, static_cast<uint32_t>(data.size()));
+  out.append(type, 4);
+  out.append(data);
+
+  const uLong TYPE_CRC = crc32(0L, reinterpret_cast<const Bytef *>(type), 4);
+  PngPutUint32(out, static_cast<uint32_t>(
+                      crc32_combine(TYPE_CRC, dataCrc, static_cast<z_off_t>(data.size()))));
+}
+
+/**
+ * @brief  Encodes an 8 bit RGB image as a PNG file in memory.
+ * @return bool: False if the image is empty or compression fails
+ */
+bool EncodePng(const DisplayImage &image, const PngOptions &options,
+               TileScheduler &scheduler, std::string &out) {
+  TRACE_SCOPE("EncodePng");
+  if (image.width <= 0 || image.height <= 0 ||
+      image.rgb.size() != static_cast<size_t>(image.width) * image.height * 3) {
+    return false;
+  }
+
+  const int LEVEL = std::min(std::max(options.level, 0), 9);
+  const int ROW_BYTES = image.width * 3;
+  const size_t FILTERED_ROW = static_cast<size_t>(ROW_BYTES) + 1;
+  const std::vector<uint8_t> ZERO_ROW(ROW_BYTES, 0);
+
+  const std::vector<Tile> BANDS = MakeBands(image.width, image.height,
+                                            std::max(1, options.bandHeight));
+  const int LAST_BAND = static_cast<int>(BANDS.size()) - 1;
+
+  // First pass: filter every row, each prefixed with its filter type
+  std::vector<uint8_t> filtered(FILTERED_ROW * image.height);
+  scheduler.Run(BANDS, [&](const Tile &band, const int) {
+    std::vector<uint8_t> candidate(ROW_BYTES);
+    for (int y = band.y0; y < band.y1; ++y) {
+      const uint8_t *ROW = &image.rgb[static_cast<size_t>(y) * ROW_BYTES];
+      const uint8_t *PREVIOUS = (y > 0) ? ROW - ROW_BYTES : &ZERO_ROW[0];
+      uint8_t *rowOut = &filtered[FILTERED_ROW * y];
+
+      if (LEVEL < 3) {
+        rowOut[0] = PNG_FILTER_SUB;
+        PngFilterRow(PNG_FILTER_SUB, ROW, PREVIOUS, ROW_BYTES, rowOut + 1);
+        continue;
+      }
+
+      // Keep the filter that leaves the smallest values
+      uint32_t bestCost = 0;
+      for (int filter = PNG_FILTER_NONE; filter <= PNG_FILTER_PAETH; ++filter) {
+        PngFilterRow(static_cast<PngFilter>(filter), ROW, PREVIOUS, ROW_BYTES, &candidate[0]);
+        const uint32_t COST = PngFilterCost(&candidate[0], ROW_BYTES);
+        if (filter == PNG_FILTER_NONE || COST < bestCost) {
+          bestCost  = COST;
+          rowOut[0] = static_cast<uint8_t>(filter);
+          memcpy(rowOut + 1, &candidate[0], ROW_BYTES);
+        }
+      }
+    }
+  });
+
+  // Second pass: deflate each band, and checksum its input and output
+  std::vector<std::string> deflated(BANDS.size());
+  std::vector<uLong> adlers(BANDS.size()), crcs(BANDS.size());
+  std::vector<char> failed(BANDS.size(), 0);
+  scheduler.Run(BANDS, [&](const Tile &band, const int) {
+    const size_t BEGIN = FILTERED_ROW * band.y0;
+    const size_t SIZE  = FILTERED_ROW * (band.y1 - band.y0);
+
+    // Raw deflate (no zlib header); the header and checksum wrap all bands
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (deflateInit2(&stream, LEVEL, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+      failed[band.index] = 1;
+      return;
+    }
+
+    // Prime the window with the data before this band, which the decoder
+    // will already have seen
+    if (BEGIN > 0) {
+      const size_t WINDOW = std::min<size_t>(BEGIN, 32768);
+      deflateSetDictionary(&stream, &filtered[BEGIN - WINDOW], static_cast<uInt>(WINDOW));
+    }
+
+    std::string &compressed = deflated[band.index];
+    compressed.resize(deflateBound(&stream, static_cast<uLong>(SIZE)) + 16);
+    stream.next_in   = &filtered[BEGIN];
+    stream.avail_in  = static_cast<uInt>(SIZE);
+    stream.next_out  = reinterpret_cast<Bytef *>(&compressed[0]);
+    stream.avail_out = static_cast<uInt>(compressed.size());
+
+    // Only the last band finishes the stream
+    const int FLUSH = (band.index == LAST_BAND) ? Z_FINISH : Z_SYNC_FLUSH;
+    const int RESULT = deflate(&stream, FLUSH);
+    if ((FLUSH == Z_FINISH && RESULT != Z_STREAM_END) ||
+        (FLUSH == Z_SYNC_FLUSH && (RESULT != Z_OK || stream.avail_out == 0))) {
+      failed[band.index] = 1;
+    }
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    adlers[band.index] = adler32(1L, &filtered[BEGIN], static_cast<uInt>(SIZE));
+    crcs[band.index] = crc32(0L, reinterpret_cast<const Bytef *>(compressed.data()),
+                             static_cast<uInt>(compressed.size()));
+  });
+
+  if (std::find(failed.begin(), failed.end(), 1) != failed.end()) {
+    return false;
+  }
+
+  // zlib stream: header, the bands back to back, then the Adler-32 of all
+  // of the filtered data
+  // (the second header byte records the level and makes the header a
+  // multiple of 31)
+  std::string idat;
+  idat.push_back(static_cast<char>(0x78));
+  idat.push_back(static_cast<char>((LEVEL < 2) ? 0x01 : (LEVEL < 6) ? 0x5e :
+                                   (LEVEL == 6) ? 0x9c : 0xda));
+  uLong adler = 1L;
+  for (size_t i = 0; i < deflated.size(); ++i) {
+    idat.append(deflated[i]);
+    const size_t ROWS = BANDS[i].y1 - BANDS[i].y0;
+    adler = adler32_combine(adler, adlers[i], static_cast<z_off_t>(FILTERED_ROW * ROWS));
+  }
+  PngPutUint32(idat, static_cast<uint32_t>(adler));
+
+  // CRC-32 of the IDAT data, combined from the pieces
+  uLong idatCrc = crc32(0L, reinterpret_cast<const Bytef *>(idat.data()), 2);
+  for (size_t i = 0; i < deflated.size(); ++i) {
+    idatCrc = crc32_combine(idatCrc, crcs[i], static_cast<z_off_t>(deflated[i].size()));
+  }
+  idatCrc = crc32(idatCrc, reinterpret_cast<const Bytef *>(idat.data() + idat.size() - 4), 4);
+
+  // Header: 8 bit RGB, not interlaced
+  std::string header;
+  PngPutUint32(header, static_cast<uint32_t>(image.width));
+  PngPutUint32(header, static_cast<uint32_t>(image.height));
+  header.push_back(8);
+  header.push_back(2);
+  header.push_back(0);
+  header.push_back(0);
+  header.push_back(0);
+
+  out.assign("\x89PNG\r\n\x1a\n", 8);
+  PngPutChunk(out, "IHDR", header,
+              crc32(0L, reinterpret_cast<const Bytef *>(header.data()),
+                    static_cast<uInt>(header.size())));
+  PngPutChunk(out, "IDAT", idat, idatCrc);
+  PngPutChunk(out, "IEND", std::string(), 0);
+  return true;
+}
+
+/**
+ * @brief  Writes an 8 bit RGB image to a PNG file with a single write.
+ * @return bool: False if the image could not be encoded or written
+ */
+bool WritePng(const DisplayImage &image, const std::string &filename,
+              const PngOptions &options, TileScheduler &scheduler) {
+  TRACE_SCOPE("WritePng");
+  std::string data;
+  if (!EncodePng(image, options, scheduler, data)) {
+    return false;
+  }
+
+  FILE *output = fopen(filename.c_str(), "wb");
+  if (!output) {
+    return false;
+  }
+  const bool WRITTEN = fwrite(data.data(), 1, data.size(), output) == data.size();
+  return (fclose(output) == 0) && WRITTEN;
+}
+
+/**
+ * @brief  Writes a canvas to a PNG file, converting it to 8 bits with
+ *         options.toneMap.
+ * @return bool: False if the image could not be encoded or written
+ */
+bool WritePng(const Canvas &canvas, const std::string &filename,
+              const PngOptions &options, TileScheduler &scheduler) {
+  DisplayImage image;
+  ToneMap(canvas, options.toneMap, scheduler, image);
+  return WritePng(image, filename, options, scheduler);
+}
+
+/*
+ * Limits on what DecodePng() will allocate.  Decoded images are capped at
+ * 64M pixels (192 MB of RGB), and the image data can't unpack to more than
+ * deflate's best ratio (about 1032:1) times the size of the IDAT chunks, so
+ * a small corrupt file can't claim a huge image.
+ */
+static const int64_t PNG_MAX_PIXELS = int64_t(1) << 26;
+static const int64_t PNG_MAX_ZIP_RATIO = 1032;
+
+/**
+ * @brief  Decodes a PNG file written by EncodePng(): 8 bit RGB, not
+ *         interlaced.  Checks every CRC and the zlib checksum.
+ * @param image: Set only if decoding succeeds
+ * @return bool: False if the data is corrupt, in an unsupported format, or
+ *               claims an image larger than the limits above
+ */
+bool DecodePng(const std::string &data, DisplayImage &image) {
+  if (data.size() < 8 || data.compare(0, 8, std::string("\x89PNG\r\n\x1a\n", 8)) != 0) {
+    return false;
+  }
+
+  std::string idat;
+  int64_t width = 0, height = 0;
+  bool haveHeader = false, haveEnd = false;
+  size_t pos = 8;
+  while (pos + 12 <= data.size() && !haveEnd) {
+    const uint32_t LENGTH = PngGetUint32(data, pos);
+    if (pos + 12 + static_cast<size_t>(LENGTH) > data.size()) {
+      return false;
+    }
+    const std::string TYPE = data.substr(pos + 4, 4);
+    const std::string BODY = data.substr(pos + 8, LENGTH);
+
+    const uLong CRC = crc32(0L, reinterpret_cast<const Bytef *>(data.data() + pos + 4), LENGTH + 4);
+    if (CRC != PngGetUint32(data, pos + 8 + LENGTH)) {
+      return false;
+    }
+
+    if (TYPE == "IHDR") {
+      if (LENGTH != 13 || BODY[8] != 8 || BODY[9] != 2 || BODY[12] != 0) {
+        return false;
+      }
+      width  = PngGetUint32(BODY, 0);
+      height = PngGetUint32(BODY, 4);
+      haveHeader = true;
+    } else if (TYPE == "IDAT") {
+      idat.append(BODY);
+    } else if (TYPE == "IEND") {
+      haveEnd = true;
+    }
+    pos += 12 + LENGTH;
+  }
+  if (!haveHeader || !haveEnd || width <= 0 || height <= 0) {
+    return false;
+  }
+
+  // The header is checked in 64 bits before anything is allocated
+  if (width > PNG_MAX_PIXELS || height > PNG_MAX_PIXELS || width * height > PNG_MAX_PIXELS ||
+      (width * 3 + 1) * height > static_cast<int64_t>(idat.size()) * PNG_MAX_ZIP_RATIO) {
+    return false;
+  }
+
+  const size_t ROW_BYTES = static_cast<size_t>(width) * 3;
+  std::vector<uint8_t> filtered((ROW_BYTES + 1) * height);
+  uLongf size = static_cast<uLongf>(filtered.size());
+  if (uncompress(&filtered[0], &size, reinterpret_cast<const Bytef *>(idat.data()),
+                 static_cast<uLong>(idat.size())) != Z_OK || size != filtered.size()) {
+    return false;
+  }
+
+  // Undo the filters row by row
+  std::vector<uint8_t> rgb(ROW_BYTES * height, 0);
+  for (int64_t y = 0; y < height; ++y) {
+    const uint8_t *IN = &filtered[(ROW_BYTES + 1) * y];
+    uint8_t *row = &rgb[ROW_BYTES * y];
+    const uint8_t *PREVIOUS = (y > 0) ? row - ROW_BYTES : NULL;
+    for (size_t i = 0; i < ROW_BYTES; ++i) {
+      const uint8_t A = (i >= 3) ? row[i - 3] : 0;
+      const uint8_t B = PREVIOUS ? PREVIOUS[i] : 0;
+      const uint8_t C = (PREVIOUS && i >= 3) ? PREVIOUS[i - 3] : 0;
+      uint8_t prediction = 0;
+      switch (IN[0]) {
+        case PNG_FILTER_NONE:    prediction = 0; break;
+        case PNG_FILTER_SUB:     prediction = A; break;
+        case PNG_FILTER_UP:      prediction = B; break;
+        case PNG_FILTER_AVERAGE: prediction = static_cast<uint8_t>((A + B) / 2); break;
+        case PNG_FILTER_PAETH:   prediction = PngPaethPredictor(A, B, C); break;
+        default: return false;
+      }
+      row[i] = static_cast<uint8_t>(IN[1 + i] + prediction);
+    }
+  }
+
+  image.width  = static_cast<int>(width);
+  image.height = static_cast<int>(height);
+  image.rgb.swap(rgb);
+  return true;
+}
@@ -0,0 +1,89 @@
+#ifndef __PNG_IMAGE_H_
+#define __PNG_IMAGE_H_
+/*
+ * PngImage.h
+ *
+ * Writes 8 bit RGB images (and canvases, through the tone mapping pass) as
+ * PNG files, which are typically a small fraction of the size of a PPM.
+ *
+ * The image is split into bands of rows.  Each band is filtered (with SSE2)
+ * and then deflated independently on the tile scheduler.  Every band but the
+ * last ends with a sync flush, which leaves the deflate stream byte aligned
+ * without marking it final, so the compressed bands concatenate into one
+ * valid zlib stream.  Each band is primed with the 32 KB of filtered data
+ * before it so matches can still reach back across band boundaries.  The
+ * zlib Adler-32 and PNG CRC-32 checksums of the bands are combined instead
+ * of recomputed, and the file is written with a single fwrite().
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Canvas.h"
+#include "ToneMap.h"
+#include "TileScheduler.h"
+#include "FrameTrace.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief  PNG scanline filter types (values match the file format).
+ */
+enum PngFilter {
+  PNG_FILTER_NONE    = 0,
+  PNG_FILTER_SUB     = 1,
+  PNG_FILTER_UP      = 2,
+  PNG_FILTER_AVERAGE = 3,
+  PNG_FILTER_PAETH   = 4
+};
+
+/**
+ * @brief  PNG output settings
+ */
+struct PngOptions {
+  PngOptions() : level(6), bandHeight(64) {
+    // Match WriteToPPM(): clamp without gamma or dithering
+    toneMap.curve  = TONE_CLAMP;
+    toneMap.srgb   = false;
+    toneMap.dither = false;
+  }
+
+  /*
+   * Size/speed tradeoff, 0 to 9.  This is the zlib compression level; at
+   * levels below 3 every row also uses the Sub filter instead of trying all
+   * five filters and keeping the one that compresses best.  0 stores the
+   * data uncompressed.
+   */
+  int level;
+
+  // Rows per independently compressed band
+  int bandHeight;
+
+  // Used to convert canvases to 8 bits
+  ToneMapOptions toneMap;
+};
+
+// Function Prototypes
+uint8_t PngPaethPredictor(const uint8_t, const uint8_t, const uint8_t);
+uint8_t PngFilterByte(const PngFilter, const uint8_t, const uint8_t, const uint8_t,
+                      const uint8_t);
+void PngFilterRow(const PngFilter, const uint8_t *, const uint8_t *, const int, uint8_t *);
+uint32_t PngFilterCost(const uint8_t *, const int);
+void PngPutUint32(std::string &, const uint32_t);
+uint32_t PngGetUint32(const std::string &, const size_t);
+void PngPutChunk(std::string &, const char *, const std::string &, const uint32_t);
+bool EncodePng(const DisplayImage &, const PngOptions &, TileScheduler &, std::string &);
+bool WritePng(const DisplayImage &, const std::string &, const PngOptions &, TileScheduler &);
+bool WritePng(const Canvas &, const std::string &, const PngOptions &, TileScheduler &);
+bool DecodePng(const std::string &, DisplayImage &);
+#endif
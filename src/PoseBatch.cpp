@@ -0,0 +1,85 @@
+/*
+ * PoseBatch.cpp
+ *
+ * Batched keyframe evaluation for many animated objects.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "PoseBatch.h"
+#include "kernels/Kernels.h"
+
+/**
+ * @brief  The pose of a keyframe.  The rotation is about x, then y, then z,
+ *         like KeyframeTransform().
+ */
+Pose KeyframePose(const Keyframe &key) {
+  return Pose(QuaternionFromEuler(key.rotation), key.translation, key.scale);
+}
+
+/**
+ * @brief  Scales, then rotates, then translates.
+ */
+AffineTransform PoseTransform(const Pose &pose) {
+  AffineTransform result = ToAffine(pose.rotation);
+  const float SCALE[3] = {pose.scale.X(), pose.scale.Y(), pose.scale.Z()};
+  for (int y = 0; y < 3; ++y) {
+    for (int x = 0; x < 3; ++x) {
+      result.SetValue(y, x, result.GetValue(y, x) * SCALE[x]);
+    }
+  }
+  result.SetValue(0, 3, pose.translation.X());
+  result.SetValue(1, 3, pose.translation.Y());
+  result.SetValue(2, 3, pose.translation.Z());
+  return result;
+}
+
+size_t PoseBatch::Add(const Keyframe &from, const Keyframe &to) {
+  const Keyframe *KEYS[2] = {&from, &to};
+  for (int k = 0; k < 2; ++k) {
+    const Pose POSE = KeyframePose(*KEYS[k]);
+    const float COMPONENTS[POSE_COMPONENTS] = {
+      POSE.rotation.W(), POSE.rotation.X(), POSE.rotation.Y(), POSE.rotation.Z(),
+      POSE.translation.X(), POSE.translation.Y(), POSE.translation.Z(),
+      POSE.scale.X(), POSE.scale.Y(), POSE.scale.Z()
+    };
+    times_[k].push_back(KEYS[k]->time);
+    for (int c = 0; c < POSE_COMPONENTS; ++c) {
+      poses_[k][c].push_back(COMPONENTS[c]);
+    }
+  }
+  return Size() - 1;
+}
+
+void PoseBatch::Evaluate(const float time) {
+  const size_t COUNT = Size();
+  t_.resize(COUNT);
+  affine_.resize(12 * COUNT);
+  if (COUNT == 0) {
+    return;
+  }
+
+  const float *START = times_[0].data();
+  const float *END   = times_[1].data();
+  for (size_t i = 0; i < COUNT; ++i) {
+    const float SPAN = END[i] - START[i];
+    const float T = (SPAN > 0) ? (time - START[i]) / SPAN : 0.0f;
+    t_[i] = (T < 0) ? 0.0f : ((T > 1) ? 1.0f : T);
+  }
+
+  KernelPoses poses[2];
+  for (int k = 0; k < 2; ++k) {
+    const std::vector<float> *P = poses_[k];
+    poses[k].qw = P[0].data();
+    poses[k].qx = P[1].data();
+    poses[k].qy = P[2].data();
+    poses[k].qz = P[3].data();
+    poses[k].tx = P[4].data();
+    poses[k].ty = P[5].data();
+    poses[k].tz = P[6].data();
+    poses[k].sx = P[7].data();
+    poses[k].sy = P[8].data();
+    poses[k].sz = P[9].data();
+  }
+  GetRenderKernels().blendPoses(poses[0], poses[1], t_.data(), COUNT, affine_.data());
+}
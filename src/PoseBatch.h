@@ -0,0 +1,103 @@
+#ifndef __POSE_BATCH_H_
+#define __POSE_BATCH_H_
+/*
+ * PoseBatch.h
+ *
+ * Per-frame transform update for many animated objects at once.  Each
+ * object moves between two keyframes; the keyframes are stored as a
+ * structure of arrays (one array per component), and Evaluate() blends
+ * every object's pose with the blendPoses render kernel, which works on
+ * several objects per instruction at the best level the CPU supports.
+ *
+ * Rotations are blended as quaternions (nlerp along the shorter arc), so
+ * an object turns about a single axis between its keyframes instead of
+ * interpolating each Euler angle separately like InterpolateKeyframes().
+ * At the keyframes themselves both give the same transform.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "AffineTransform.h"
+#include "Animation.h"
+#include "Quaternion.h"
+#include "Tuple.h"
+
+#include <vector>
+
+/**
+ * @brief  A keyframe's transform with the rotation as a quaternion.
+ */
+struct Pose {
+  Pose() : translation(Vector(0, 0, 0)), scale(Vector(1, 1, 1)) {
+  }
+
+  Pose(const Quaternion &rot, const Tuple &trans, const Tuple &scl) :
+    rotation(rot), translation(trans), scale(scl) {
+  }
+
+  Quaternion rotation;
+  Tuple translation;
+  Tuple scale;
+};
+
+class PoseBatch {
+public:
+  PoseBatch() {
+  }
+
+  /**
+   * @brief  Adds an object moving from one keyframe to the next.
+   * @return The object's index in the batch
+   */
+  size_t Add(const Keyframe &from, const Keyframe &to);
+
+  /**
+   * @brief  Computes every object's transform at a point in time.  Times
+   *         outside an object's keyframes hold the nearer keyframe's pose.
+   */
+  void Evaluate(const float time);
+
+  /**
+   * @brief  The transform of object i from the last Evaluate().
+   */
+  AffineTransform Transform(const size_t i) const {
+    const size_t COUNT = Size();
+    return AffineTransform(affine_[0 * COUNT + i], affine_[1 * COUNT + i],
+                           affine_[2 * COUNT + i], affine_[3 * COUNT + i],
+                           affine_[4 * COUNT + i], affine_[5 * COUNT + i],
+                           affine_[6 * COUNT + i], affine_[7 * COUNT + i],
+                           affine_[8 * COUNT + i], affine_[9 * COUNT + i],
+                           affine_[10 * COUNT + i], affine_[11 * COUNT + i]);
+  }
+
+  /**
+   * @brief  Transforms from the last Evaluate() as 12 arrays of Size()
+   *         floats: element (row, col) of object i is at
+   *         Transforms()[(4 * row + col) * Size() + i].
+   */
+  const float *Transforms() const { return affine_.data(); }
+
+  // Accessor functions
+  size_t Size() const { return times_[0].size(); }
+
+private:
+  // Disable copy constructor and assignment operator
+  PoseBatch(const PoseBatch &);
+  PoseBatch &operator=(const PoseBatch &);
+
+  // Components of a pose (quaternion w x y z, translation, scale)
+  enum { POSE_COMPONENTS = 10 };
+
+  // Keyframe times and poses, one array per component
+  std::vector<float> times_[2];
+  std::vector<float> poses_[2][POSE_COMPONENTS];
+
+  // Blend factor of each object, and the 12 transform planes
+  std::vector<float> t_;
+  std::vector<float> affine_;
+};
+
+// Function Prototypes
+Pose KeyframePose(const Keyframe &);
+AffineTransform PoseTransform(const Pose &);
+#endif
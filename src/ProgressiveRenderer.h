@@ -0,0 +1,330 @@
+#ifndef __PROGRESSIVE_RENDERER_H_
+#define __PROGRESSIVE_RENDERER_H_
+/*
+ * ProgressiveRenderer.h
+ *
+ * Time-budgeted progressive rendering.  Rather than rendering the exact
+ * image eventually, the renderer produces the best image it can within a
+ * deadline by refining the canvas in passes:
+ *
+ * 1) Block passes.  The first pass traces one pixel per coarse block (a
+ *    4x4 block by default, i.e. 1/16 of the pixels) and fills the whole
+ *    block with its color.  Each following pass halves the block size and
+ *    traces only the pixels that have not been traced yet, until every pixel
+ *    has one sample.
+ * 2) Sample passes.  Each pass adds one more jittered sample to every pixel.
+ *
+ * Passes run on a TileScheduler.  Once the deadline passes no new tiles are
+ * started, so the render stops cleanly within about one tile of the budget.
+ * The latest image can be copied out at any time with Snapshot().
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Color.h"
+#include "Canvas.h"
+#include "Camera.h"
+#include "World.h"
+#include "TileScheduler.h"
+#include "Random.h"
+#include "FrameTrace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief  Progressive rendering settings
+ */
+struct ProgressiveOptions {
+  ProgressiveOptions() : coarseBlockSize(4), maxSamples(16), tileSize(16), seed(0) {
+  }
+
+  /*
+   * Edge length of the blocks filled by the first pass.  Must be a power of
+   * two.  The first pass traces 1/(coarseBlockSize^2) of the pixels.
+   */
+  int coarseBlockSize;
+
+  // Stop refining once every pixel holds this many samples
+  int maxSamples;
+
+  // Edge length of a tile in pixels (rounded up to a multiple of the coarse block)
+  int tileSize;
+
+  // Seed used to jitter the sample passes
+  unsigned int seed;
+};
+
+/**
+ * @brief  Progress reported after every pass.
+ */
+struct ProgressiveUpdate {
+  // Index of the pass (starting at 0)
+  int pass;
+
+  // Block size of the pass (1 for full resolution and sample passes)
+  int blockSize;
+
+  // Samples held by every pixel once the pass is complete (0 for coarse passes)
+  int samplesPerPixel;
+
+  // False if the deadline stopped the pass part way through
+  bool complete;
+
+  // Time since the render started
+  double elapsedSeconds;
+};
+
+// Called on the rendering thread after every pass
+typedef std::function<void(const ProgressiveUpdate &)> ProgressCallback;
+
+/**
+ * @brief  Summary of a progressive render.
+ */
+struct ProgressiveResult {
+  ProgressiveResult() : passesCompleted(0), samplesPerPixel(0), finished(false), seconds(0.0) {
+  }
+
+  int passesCompleted;
+
+  // Samples held by every pixel (0 if the full resolution pass did not finish)
+  int samplesPerPixel;
+
+  // True if every pass up to maxSamples finished within the budget
+  bool finished;
+
+  double seconds;
+};
+
+/**
+ * @brief  ProgressiveRenderer class
+ */
+class ProgressiveRenderer {
+public:
+  /**
+   * @brief Constructor.  The world and scheduler must outlive the renderer.
+   */
+  ProgressiveRenderer(const World &world, const Camera &camera, TileScheduler &scheduler,
+                      const ProgressiveOptions &options = ProgressiveOptions()) :
+    world_(world),
+    camera_(camera),
+    scheduler_(scheduler),
+    options_(options),
+    sums_(camera.HSize() * camera.VSize() * 3, 0.0f),
+    counts_(camera.HSize() * camera.VSize(), 0),
+    image_(camera.HSize(), camera.VSize()) {
+    // Blocks must never straddle two tiles
+    const int C = std::max(1, options_.coarseBlockSize);
+    const int TILE = ((std::max(1, options_.tileSize) + C - 1) / C) * C;
+    tiles_ = MakeTiles(camera.HSize(), camera.VSize(), TILE);
+  }
+
+  /**
+   * @brief Destructor
+   */
+  ~ProgressiveRenderer() {
+  }
+
+  /**
+   * @brief Renders from scratch until every pass is finished or the budget
+   *        runs out.
+   * @param budgetSeconds: Time budget for the whole render
+   * @param callback: Optional function called after every pass
+   */
+  ProgressiveResult Render(const double budgetSeconds,
+                           const ProgressCallback &callback = ProgressCallback()) {
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point START = Clock::now();
+    const Clock::time_point DEADLINE = START +
+      std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(budgetSeconds));
+
+    Reset();
+
+    ProgressiveResult result;
+    int pass = 0;
+    bool complete = true;
+
+    // Block passes, from the coarse block size down to full resolution
+    for (int block = options_.coarseBlockSize; block >= 1 && complete; block /= 2, ++pass) {
+      const TileFunction FN = [this, block](const Tile &tile, const int) {
+        TraceBlocks(tile, block);
+      };
+      TRACE_SCOPE("ProgressiveRenderer block pass");
+      complete = scheduler_.RunUntil(tiles_, FN, DEADLINE);
+      if (complete) {
+        ++result.passesCompleted;
+        result.samplesPerPixel = (block == 1) ? 1 : 0;
+      }
+      Notify(callback, pass, block, result.samplesPerPixel, complete, START);
+    }
+
+    // Sample passes, one more sample per pixel each
+    for (int spp = 2; spp <= options_.maxSamples && complete; ++spp, ++pass) {
+      const TileFunction FN = [this](const Tile &tile, const int) {
+        AddSamples(tile);
+      };
+      TRACE_SCOPE("ProgressiveRenderer sample pass");
+      complete = scheduler_.RunUntil(tiles_, FN, DEADLINE);
+      if (complete) {
+        ++result.passesCompleted;
+        result.samplesPerPixel = spp;
+      }
+      Notify(callback, pass, 1, result.samplesPerPixel, complete, START);
+    }
+
+    result.finished = complete;
+    result.seconds  = std::chrono::duration<double>(Clock::now() - START).count();
+    return result;
+  }
+
+  /**
+   * @brief Copies the latest image onto the canvas.  Safe to call from any
+   *        thread while Render() is running.
+   */
+  void Snapshot(Canvas &canvas) const {
+    std::lock_guard<std::mutex> lock(imageMutex_);
+    for (int y = 0; y < image_.GetHeight(); ++y) {
+      for (int x = 0; x < image_.GetWidth(); ++x) {
+        canvas.WritePixel(x, y, image_.PixelAt(x, y));
+      }
+    }
+  }
+
+private:
+  /**
+   * @brief Clears the samples and the image.
+   */
+  void Reset() {
+    std::fill(sums_.begin(), sums_.end(), 0.0f);
+    std::fill(counts_.begin(), counts_.end(), 0);
+
+    std::lock_guard<std::mutex> lock(imageMutex_);
+    for (int y = 0; y < image_.GetHeight(); ++y) {
+      for (int x = 0; x < image_.GetWidth(); ++x) {
+        image_.WritePixel(x, y, Color(0, 0, 0));
+      }
+    }
+  }
+
+  /**
+   * @brief Traces the pixels of a tile that are new at this block size and
+   *        fills each pixel's block with its color.
+   */
+  void TraceBlocks(const Tile &tile, const int block) {
+    const bool IS_COARSEST = (block == options_.coarseBlockSize);
+    std::vector<std::pair<int, Color> > traced;
+
+    for (int y = tile.y0; y < tile.y1; y += block) {
+      for (int x = tile.x0; x < tile.x1; x += block) {
+        // Pixels on the coarser grid were traced by an earlier pass
+        if (!IS_COARSEST && (x % (2 * block) == 0) && (y % (2 * block) == 0)) {
+          continue;
+        }
+
+        const Color COLOR = ColorAt(world_, RayForPixel(camera_, x, y));
+        const int INDEX = y * camera_.HSize() + x;
+        AccumulateSample(INDEX, COLOR);
+        traced.push_back(std::make_pair(INDEX, COLOR));
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(imageMutex_);
+    for (size_t i = 0; i < traced.size(); ++i) {
+      const int X0 = traced[i].first % camera_.HSize();
+      const int Y0 = traced[i].first / camera_.HSize();
+      for (int y = Y0; y < std::min(Y0 + block, tile.y1); ++y) {
+        for (int x = X0; x < std::min(X0 + block, tile.x1); ++x) {
+          image_.WritePixel(x, y, traced[i].second);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Adds one jittered sample to every pixel of the tile.
+   */
+  void AddSamples(const Tile &tile) {
+    std::vector<Color> averages;
+    averages.reserve((tile.x1 - tile.x0) * (tile.y1 - tile.y0));
+
+    for (int y = tile.y0; y < tile.y1; ++y) {
+      for (int x = tile.x0; x < tile.x1; ++x) {
+        const int INDEX = y * camera_.HSize() + x;
+
+        // Sample 0 was the pixel center; later samples are stratified
+        float dx, dy;
+        Sobol2D(counts_[INDEX], HashCombine(HashCombine(options_.seed, x), y), dx, dy);
+        AccumulateSample(INDEX, ColorAt(world_, RayForPixel(camera_, x, y, dx, dy)));
+
+        const float SCALE = 1.0f / counts_[INDEX];
+        averages.push_back(Color(sums_[INDEX * 3] * SCALE,
+                                 sums_[INDEX * 3 + 1] * SCALE,
+                                 sums_[INDEX * 3 + 2] * SCALE));
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(imageMutex_);
+    size_t next = 0;
+    for (int y = tile.y0; y < tile.y1; ++y) {
+      for (int x = tile.x0; x < tile.x1; ++x) {
+        image_.WritePixel(x, y, averages[next++]);
+      }
+    }
+  }
+
+  /**
+   * @brief Adds a sample to the pixel's running sum.
+   */
+  void AccumulateSample(const int index, const Color &color) {
+    sums_[index * 3]     += color.Red();
+    sums_[index * 3 + 1] += color.Green();
+    sums_[index * 3 + 2] += color.Blue();
+    ++counts_[index];
+  }
+
+  /**
+   * @brief Reports a finished (or interrupted) pass to the callback.
+   */
+  void Notify(const ProgressCallback &callback, const int pass, const int block,
+              const int spp, const bool complete,
+              const std::chrono::steady_clock::time_point start) const {
+    if (!callback) {
+      return;
+    }
+
+    ProgressiveUpdate update;
+    update.pass            = pass;
+    update.blockSize       = block;
+    update.samplesPerPixel = spp;
+    update.complete        = complete;
+    update.elapsedSeconds  = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start).count();
+    callback(update);
+  }
+
+  // The renderer keeps a pointer to its scheduler, so it cannot be copied
+  ProgressiveRenderer(const ProgressiveRenderer &);
+  ProgressiveRenderer &operator=(const ProgressiveRenderer &);
+
+  // Scene being rendered
+  const World &world_;
+  Camera camera_;
+
+  // Worker pool and the tiles it renders
+  TileScheduler &scheduler_;
+  ProgressiveOptions options_;
+  std::vector<Tile> tiles_;
+
+  // Running RGB sums (3 floats per pixel) and sample counts per pixel
+  std::vector<float> sums_;
+  std::vector<int> counts_;
+
+  // Latest image, shared with Snapshot()
+  Canvas image_;
+  mutable std::mutex imageMutex_;
+};
+#endif
@@ -0,0 +1,163 @@
+/*
+ * Quaternion.cpp
+ *
+ * Quaternion and dual quaternion construction, interpolation, and
+ * conversion to affine transforms.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Quaternion.h"
+
+/**
+ * @brief  Rotation by theta radians about an axis.
+ * @param axis: Axis of rotation (need not be normalized)
+ * @param theta: Angle in radians
+ */
+Quaternion QuaternionAxisAngle(const Tuple &axis, const float theta) {
+  const Tuple AXIS = Normalize(Vector(axis.X(), axis.Y(), axis.Z()));
+  const float SIN = sinf(theta / 2);
+  return Quaternion(cosf(theta / 2), AXIS.X() * SIN, AXIS.Y() * SIN, AXIS.Z() * SIN);
+}
+
+/**
+ * @brief  Rotation about x, then y, then z (RotZ * RotY * RotX), like
+ *         the rotation of a Keyframe.
+ */
+Quaternion QuaternionFromEuler(const Tuple &rotation) {
+  const float CX = cosf(rotation.X() / 2), SX = sinf(rotation.X() / 2);
+  const float CY = cosf(rotation.Y() / 2), SY = sinf(rotation.Y() / 2);
+  const float CZ = cosf(rotation.Z() / 2), SZ = sinf(rotation.Z() / 2);
+  return Quaternion(CZ, 0, 0, SZ) * Quaternion(CY, 0, SY, 0) * Quaternion(CX, SX, 0, 0);
+}
+
+/**
+ * @brief  Conjugate (the inverse rotation of a unit quaternion).
+ */
+Quaternion Conjugate(const Quaternion &q) {
+  return Quaternion(q.W(), -q.X(), -q.Y(), -q.Z());
+}
+
+/**
+ * @brief  4D dot product.
+ */
+float Dot(const Quaternion &a, const Quaternion &b) {
+  return a.W() * b.W() + a.X() * b.X() + a.Y() * b.Y() + a.Z() * b.Z();
+}
+
+/**
+ * @brief  Scales a quaternion to unit length.
+ */
+Quaternion Normalize(const Quaternion &q) {
+  return q * (1.0f / sqrtf(Dot(q, q)));
+}
+
+/**
+ * @brief  Normalized linear interpolation along the shorter arc.  Cheaper
+ *         than Slerp(); the angular speed is not quite constant.
+ */
+Quaternion Nlerp(const Quaternion &a, const Quaternion &b, const float t) {
+  const float TB = (Dot(a, b) < 0) ? -t : t;
+  return Normalize(a * (1 - t) + b * TB);
+}
+
+/**
+ * @brief  Spherical linear interpolation along the shorter arc: constant
+ *         angular speed.
+ */
+Quaternion Slerp(const Quaternion &a, const Quaternion &b, const float t) {
+  float cosine = Dot(a, b);
+  const Quaternion B = (cosine < 0) ? -b : b;
+  cosine = std::fabs(cosine);
+
+  // Nearly the same rotation: sin(angle) is too small to divide by
+  if (cosine > 0.9995f) {
+    return Nlerp(a, B, t);
+  }
+
+  const float ANGLE = acosf(cosine);
+  const float INV_SIN = 1.0f / sinf(ANGLE);
+  return a * (sinf((1 - t) * ANGLE) * INV_SIN) + B * (sinf(t * ANGLE) * INV_SIN);
+}
+
+/**
+ * @brief  Rotates a point or vector by a unit quaternion.  w is unchanged.
+ */
+Tuple Rotate(const Quaternion &q, const Tuple &tuple) {
+  // v + w * t + cross(q, t), with t = 2 * cross(q, v)
+  const Tuple QV = Vector(q.X(), q.Y(), q.Z());
+  const Tuple V  = Vector(tuple.X(), tuple.Y(), tuple.Z());
+  const Tuple T  = Cross(QV, V) * 2;
+  const Tuple RESULT = V + T * q.W() + Cross(QV, T);
+  return Tuple(RESULT.X(), RESULT.Y(), RESULT.Z(), tuple.W());
+}
+
+/**
+ * @brief  Rotation matrix of a unit quaternion.
+ */
+AffineTransform ToAffine(const Quaternion &q) {
+  const float W = q.W(), X = q.X(), Y = q.Y(), Z = q.Z();
+  return AffineTransform(1 - 2 * (Y * Y + Z * Z), 2 * (X * Y - W * Z),     2 * (X * Z + W * Y),     0,
+                         2 * (X * Y + W * Z),     1 - 2 * (X * X + Z * Z), 2 * (Y * Z - W * X),     0,
+                         2 * (X * Z - W * Y),     2 * (Y * Z + W * X),     1 - 2 * (X * X + Y * Y), 0);
+}
+
+/**
+ * @brief  Rigid transform that rotates, then translates.
+ */
+DualQuaternion DualQuaternionFromPose(const Quaternion &rotation, const Tuple &translation) {
+  const Quaternion T(0, translation.X(), translation.Y(), translation.Z());
+  return DualQuaternion(rotation, T * rotation * 0.5f);
+}
+
+/**
+ * @brief  The rotation of a unit dual quaternion.
+ */
+Quaternion DualQuaternionRotation(const DualQuaternion &dq) {
+  return dq.Real();
+}
+
+/**
+ * @brief  The translation of a unit dual quaternion.
+ */
+Tuple DualQuaternionTranslation(const DualQuaternion &dq) {
+  const Quaternion T = dq.Dual() * Conjugate(dq.Real()) * 2;
+  return Vector(T.X(), T.Y(), T.Z());
+}
+
+/**
+ * @brief  Scales a dual quaternion so its rotation is a unit quaternion.
+ */
+DualQuaternion Normalize(const DualQuaternion &dq) {
+  const float INV_LENGTH = 1.0f / sqrtf(Dot(dq.Real(), dq.Real()));
+  return DualQuaternion(dq.Real() * INV_LENGTH, dq.Dual() * INV_LENGTH);
+}
+
+/**
+ * @brief  Dual quaternion linear blending along the shorter arc.  Blends
+ *         rotation and translation together as one rigid motion.
+ */
+DualQuaternion Nlerp(const DualQuaternion &a, const DualQuaternion &b, const float t) {
+  const float TB = (Dot(a.Real(), b.Real()) < 0) ? -t : t;
+  return Normalize(DualQuaternion(a.Real() * (1 - t) + b.Real() * TB,
+                                  a.Dual() * (1 - t) + b.Dual() * TB));
+}
+
+/**
+ * @brief  Applies a unit dual quaternion to a point.
+ */
+Tuple TransformPoint(const DualQuaternion &dq, const Tuple &pt) {
+  return Rotate(dq.Real(), pt) + DualQuaternionTranslation(dq);
+}
+
+/**
+ * @brief  Affine transform of a unit dual quaternion.
+ */
+AffineTransform ToAffine(const DualQuaternion &dq) {
+  AffineTransform result = ToAffine(dq.Real());
+  const Tuple TRANSLATION = DualQuaternionTranslation(dq);
+  result.SetValue(0, 3, TRANSLATION.X());
+  result.SetValue(1, 3, TRANSLATION.Y());
+  result.SetValue(2, 3, TRANSLATION.Z());
+  return result;
+}
@@ -0,0 +1,129 @@
+#ifndef __QUATERNION_H_
+#define __QUATERNION_H_
+/*
+ * Quaternion.h
+ *
+ * Rotation quaternions and dual quaternions (rotation plus translation)
+ * for animation.  Interpolating quaternions blends rotations smoothly
+ * without the gimbal problems of Euler angles, and converting one to a
+ * matrix takes no trigonometry at all: only the axis-angle and Euler
+ * constructors call sinf/cosf, once per half angle.
+ *
+ * Rotations follow the same convention as RotX, RotY, and RotZ.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "AffineTransform.h"
+
+#include <cmath>
+
+/**
+ * @brief  Quaternion w + xi + yj + zk.  Rotations are unit quaternions.
+ */
+class Quaternion {
+public:
+  /**
+   * @brief  Default constructor.  The identity rotation.
+   */
+  Quaternion() : w_(1), x_(0), y_(0), z_(0) {
+  }
+
+  Quaternion(const float w, const float x, const float y, const float z) :
+    w_(w), x_(x), y_(y), z_(z) {
+  }
+
+  // Comparison operator==
+  bool operator==(const Quaternion &rhs) const {
+    return IsEqual(w_, rhs.w_) && IsEqual(x_, rhs.x_) &&
+           IsEqual(y_, rhs.y_) && IsEqual(z_, rhs.z_);
+  }
+
+  // Hamilton product: (lhs * rhs) rotates by rhs, then by lhs
+  Quaternion operator*(const Quaternion &rhs) const {
+    return Quaternion(w_ * rhs.w_ - x_ * rhs.x_ - y_ * rhs.y_ - z_ * rhs.z_,
+                      w_ * rhs.x_ + x_ * rhs.w_ + y_ * rhs.z_ - z_ * rhs.y_,
+                      w_ * rhs.y_ - x_ * rhs.z_ + y_ * rhs.w_ + z_ * rhs.x_,
+                      w_ * rhs.z_ + x_ * rhs.y_ - y_ * rhs.x_ + z_ * rhs.w_);
+  }
+
+  Quaternion operator*(const float scalar) const {
+    return Quaternion(w_ * scalar, x_ * scalar, y_ * scalar, z_ * scalar);
+  }
+
+  Quaternion operator+(const Quaternion &rhs) const {
+    return Quaternion(w_ + rhs.w_, x_ + rhs.x_, y_ + rhs.y_, z_ + rhs.z_);
+  }
+
+  Quaternion operator-() const {
+    return Quaternion(-w_, -x_, -y_, -z_);
+  }
+
+  // Accessor functions
+  float W() const { return w_; }
+  float X() const { return x_; }
+  float Y() const { return y_; }
+  float Z() const { return z_; }
+
+private:
+  bool IsEqual(const float num1, const float num2) const {
+    return std::fabs(num1 - num2) <= 0.0001;
+  }
+
+  float w_, x_, y_, z_;
+};
+
+/**
+ * @brief  Dual quaternion real + dual * epsilon.  A unit dual quaternion is
+ *         a rigid transform: real is the rotation, and dual is half the
+ *         translation times the rotation.
+ */
+class DualQuaternion {
+public:
+  /**
+   * @brief  Default constructor.  The identity transform.
+   */
+  DualQuaternion() : real_(), dual_(0, 0, 0, 0) {
+  }
+
+  DualQuaternion(const Quaternion &real, const Quaternion &dual) :
+    real_(real), dual_(dual) {
+  }
+
+  // Comparison operator==
+  bool operator==(const DualQuaternion &rhs) const {
+    return real_ == rhs.real_ && dual_ == rhs.dual_;
+  }
+
+  // Composition: (lhs * rhs) applies rhs, then lhs
+  DualQuaternion operator*(const DualQuaternion &rhs) const {
+    return DualQuaternion(real_ * rhs.real_, real_ * rhs.dual_ + dual_ * rhs.real_);
+  }
+
+  // Accessor functions
+  const Quaternion &Real() const { return real_; }
+  const Quaternion &Dual() const { return dual_; }
+
+private:
+  Quaternion real_, dual_;
+};
+
+// Function Prototypes
+Quaternion QuaternionAxisAngle(const Tuple &, const float);
+Quaternion QuaternionFromEuler(const Tuple &);
+Quaternion Conjugate(const Quaternion &);
+float Dot(const Quaternion &, const Quaternion &);
+Quaternion Normalize(const Quaternion &);
+Quaternion Nlerp(const Quaternion &, const Quaternion &, const float);
+Quaternion Slerp(const Quaternion &, const Quaternion &, const float);
+Tuple Rotate(const Quaternion &, const Tuple &);
+AffineTransform ToAffine(const Quaternion &);
+DualQuaternion DualQuaternionFromPose(const Quaternion &, const Tuple &);
+Quaternion DualQuaternionRotation(const DualQuaternion &);
+Tuple DualQuaternionTranslation(const DualQuaternion &);
+DualQuaternion Normalize(const DualQuaternion &);
+DualQuaternion Nlerp(const DualQuaternion &, const DualQuaternion &, const float);
+Tuple TransformPoint(const DualQuaternion &, const Tuple &);
+AffineTransform ToAffine(const DualQuaternion &);
+#endif
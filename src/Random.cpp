@@ -0,0 +1,204 @@
+/*
+ * Random.cpp
+ *
+ * Hashing, random number generation, and low discrepancy sequences.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Random.h"
+
+/**
+ * @brief  Integer hash with good avalanche behaviour ("lowbias32").
+ */
+uint32_t Hash32(uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x7feb352dU;
+  x ^= x >> 15;
+  x *= 0x846ca68bU;
+  x ^= x >> 16;
+  return x;
+}
+
+/**
+ * @brief  Combines a hash with another value.
+ */
+uint32_t HashCombine(const uint32_t seed, const uint32_t value) {
+  return Hash32(seed ^ (value + 0x9e3779b9U + (seed << 6) + (seed >> 2)));
+}
+
+/**
+ * @brief  Converts 32 random bits to a float in [0, 1).
+ */
+float BitsToFloat(const uint32_t bits) {
+  // The top 24 bits fill the float mantissa exactly
+  return (bits >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief  Returns a generator for one sample of one pixel.  The sequence
+ *         depends only on its arguments, never on which thread or in which
+ *         order pixels are rendered.
+ * @param seed: Render-wide seed
+ * @param x, y: Pixel coordinates
+ * @param sample: Index of the sample within the pixel
+ */
+Pcg32 PixelRng(const uint32_t seed, const int x, const int y, const uint32_t sample) {
+  const uint32_t PIXEL = HashCombine(HashCombine(seed, static_cast<uint32_t>(x)),
+                                     static_cast<uint32_t>(y));
+  return Pcg32((static_cast<uint64_t>(Hash32(sample ^ seed)) << 32) | sample, PIXEL);
+}
+
+/**
+ * @brief  Stateless counter-based generator: two rounds of hashing mix the
+ *         key into the counter.  Returns 32 random bits.
+ */
+uint32_t CounterRandom(const uint64_t key, const uint32_t counter) {
+  const uint32_t KEY_LO = static_cast<uint32_t>(key);
+  const uint32_t KEY_HI = static_cast<uint32_t>(key >> 32);
+  return Hash32(Hash32(counter ^ KEY_LO) + KEY_HI);
+}
+
+/**
+ * @brief  Fills out[0..count) with uniform floats in [0, 1) for the counters
+ *         first, first+1, ...  Equivalent to calling CounterRandom() per
+ *         element.
+ *
+ *         There is no loop-carried state, so the compiler vectorizes the
+ *         blocks of 8 (the hash is only 32-bit multiplies, shifts and xors).
+ */
+void FillUniform(const uint64_t key, const uint32_t first, float *out, const size_t count) {
+  const uint32_t KEY_LO = static_cast<uint32_t>(key);
+  const uint32_t KEY_HI = static_cast<uint32_t>(key >> 32);
+  const size_t BLOCK = 8;
+
+  size_t i = 0;
+  for (; i + BLOCK <= count; i += BLOCK) {
+    for (size_t lane = 0; lane < BLOCK; ++lane) {
+      uint32_t x = (first + static_cast<uint32_t>(i + lane)) ^ KEY_LO;
+      x ^= x >> 16; x *= 0x7feb352dU; x ^= x >> 15; x *= 0x846ca68bU; x ^= x >> 16;
+      x += KEY_HI;
+      x ^= x >> 16; x *= 0x7feb352dU; x ^= x >> 15; x *= 0x846ca68bU; x ^= x >> 16;
+      out[i + lane] = (x >> 8) * (1.0f / 16777216.0f);
+    }
+  }
+
+  // Remainder
+  for (; i < count; ++i) {
+    out[i] = BitsToFloat(CounterRandom(key, first + static_cast<uint32_t>(i)));
+  }
+}
+
+/**
+ * @brief  Reverses the order of the bits in a 32-bit integer.
+ */
+uint32_t ReverseBits(uint32_t x) {
+  x = ((x >> 1) & 0x55555555U) | ((x & 0x55555555U) << 1);
+  x = ((x >> 2) & 0x33333333U) | ((x & 0x33333333U) << 2);
+  x = ((x >> 4) & 0x0f0f0f0fU) | ((x & 0x0f0f0f0fU) << 4);
+  x = ((x >> 8) & 0x00ff00ffU) | ((x & 0x00ff00ffU) << 8);
+  return (x >> 16) | (x << 16);
+}
+
+/**
+ * @brief  Base-2 Owen scrambling of a 0.32 fixed point value using the
+ *         hash-based nested uniform scramble of Laine and Karras (with
+ *         Burley's improved constants).  Each bit is flipped depending on a
+ *         hash of all the bits above it, which preserves the stratification
+ *         of (0,m,2)-nets.
+ */
+uint32_t OwenScramble(const uint32_t value, const uint32_t seed) {
+  uint32_t x = ReverseBits(value);
+  x += seed;
+  x ^= x * 0x6c50b47cU;
+  x ^= x * 0xb82f1e52U;
+  x ^= x * 0xc7afe638U;
+  x ^= x * 0x8d22f6e6U;
+  return ReverseBits(x);
+}
+
+/**
+ * @brief  Owen-scrambled 2D Sobol point.  The first two Sobol dimensions
+ *         form a (0,2)-sequence, so every power-of-two prefix of the
+ *         sequence is stratified in both dimensions.
+ * @param index: Index of the point in the sequence
+ * @param seed: Scrambling seed (for example, a hash of the pixel)
+ * @param u, v: Output coordinates in [0, 1)
+ */
+void Sobol2D(const uint32_t index, const uint32_t seed, float &u, float &v) {
+  // Shuffle the order of the points without breaking the stratification
+  const uint32_t I = OwenScramble(index, Hash32(seed));
+
+  // Dimension 0 is the van der Corput sequence
+  const uint32_t X = ReverseBits(I);
+
+  // Dimension 1 uses the direction numbers v_k = v_(k-1) ^ (v_(k-1) >> 1)
+  uint32_t y = 0;
+  uint32_t bits = I;
+  for (uint32_t dir = 1U << 31; bits; bits >>= 1, dir ^= dir >> 1) {
+    if (bits & 1) {
+      y ^= dir;
+    }
+  }
+
+  u = BitsToFloat(OwenScramble(X, HashCombine(seed, 0xa511e9b3U)));
+  v = BitsToFloat(OwenScramble(y, HashCombine(seed, 0x63d83595U)));
+}
+
+/**
+ * @brief  Radical inverse of index in the given base: mirrors the base-b
+ *         digits of index around the radix point.
+ */
+float RadicalInverse(const int base, uint32_t index) {
+  const float INV_BASE = 1.0f / base;
+  float invBaseN = 1.0f;
+  uint32_t reversed = 0;
+  while (index) {
+    const uint32_t NEXT = index / base;
+    reversed = reversed * base + (index - NEXT * base);
+    invBaseN *= INV_BASE;
+    index = NEXT;
+  }
+  const float RESULT = reversed * invBaseN;
+
+  // Guard against rounding up to exactly 1.0
+  return (RESULT < 1.0f) ? RESULT : 0.99999994f;
+}
+
+/**
+ * @brief  Owen-scrambled radical inverse.  Each digit is permuted by a
+ *         random permutation that depends on the seed and on all of the more
+ *         significant digits.  Digits are generated until they no longer
+ *         affect a float.
+ */
+float OwenScrambledRadicalInverse(const int base, uint32_t index, const uint32_t seed) {
+  const float INV_BASE = 1.0f / base;
+  float invBaseN = 1.0f;
+  float result = 0.0f;
+  uint32_t prefix = seed;
+
+  while (invBaseN * INV_BASE > 1e-7f) {
+    const uint32_t DIGIT = index % base;
+    index /= base;
+
+    // Random rotation of the digit, keyed on all previous digits
+    const uint32_t SCRAMBLED = (DIGIT + Hash32(prefix)) % base;
+    invBaseN *= INV_BASE;
+    result += SCRAMBLED * invBaseN;
+
+    prefix = HashCombine(prefix, DIGIT);
+  }
+
+  return (result < 1.0f) ? result : 0.99999994f;
+}
+
+/**
+ * @brief  Owen-scrambled Halton sequence.
+ * @param dimension: Dimension (0 to HALTON_MAX_DIMENSIONS-1) to sample
+ * @param index: Index of the point in the sequence
+ * @param seed: Scrambling seed
+ */
+float Halton(const int dimension, const uint32_t index, const uint32_t seed) {
+  const int BASE = HALTON_PRIMES[dimension % HALTON_MAX_DIMENSIONS];
+  return OwenScrambledRadicalInverse(BASE, index, HashCombine(seed, dimension));
+}
@@ -0,0 +1,97 @@
+#ifndef __RANDOM_H_
+#define __RANDOM_H_
+/*
+ * Random.h
+ *
+ * Fast random number generation for the stochastic renderers:
+ *
+ * - Pcg32: a small-state PCG32 generator that can be seeded
+ *   deterministically from a (pixel, sample) pair, so renders come out the
+ *   same no matter which thread traces which pixel.
+ * - CounterRandom/FillUniform: a stateless counter-based generator whose
+ *   batch form vectorizes across the output array.
+ * - Owen-scrambled Sobol and Halton low-discrepancy samplers.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include <cstddef>
+#include <stdint.h>
+
+// Function Prototypes
+uint32_t Hash32(uint32_t);
+uint32_t HashCombine(const uint32_t, const uint32_t);
+float BitsToFloat(const uint32_t);
+
+/**
+ * @brief  PCG32 random number generator (O'Neill, "PCG: A Family of Simple
+ *         Fast Space-Efficient Statistically Good Algorithms for Random
+ *         Number Generation").  64 bits of state, 32 bits of output.
+ */
+class Pcg32 {
+public:
+  /**
+   * @brief Constructor
+   * @param seed: Starting state
+   * @param stream: Selects one of 2^63 independent sequences
+   */
+  explicit Pcg32(const uint64_t seed = 0x853c49e6748fea9bULL,
+                 const uint64_t stream = 0xda3e39cb94b95bdbULL) {
+    Seed(seed, stream);
+  }
+
+  /**
+   * @brief Reseeds the generator.
+   */
+  void Seed(const uint64_t seed, const uint64_t stream) {
+    state_ = 0;
+    inc_   = (stream << 1) | 1;
+    NextUint();
+    state_ += seed;
+    NextUint();
+  }
+
+  /**
+   * @brief Returns the next 32 random bits.
+   */
+  uint32_t NextUint() {
+    const uint64_t OLD = state_;
+    state_ = OLD * 6364136223846793005ULL + inc_;
+    const uint32_t XORSHIFTED = static_cast<uint32_t>(((OLD >> 18) ^ OLD) >> 27);
+    const uint32_t ROT = static_cast<uint32_t>(OLD >> 59);
+    return (XORSHIFTED >> ROT) | (XORSHIFTED << ((32 - ROT) & 31));
+  }
+
+  /**
+   * @brief Returns a uniformly distributed float in [0, 1).
+   */
+  float NextFloat() { return BitsToFloat(NextUint()); }
+
+  /**
+   * @brief Required by the standard library's UniformRandomBitGenerator.
+   */
+  typedef uint32_t result_type;
+  static uint32_t min() { return 0; }
+  static uint32_t max() { return 0xffffffffU; }
+  uint32_t operator()() { return NextUint(); }
+
+private:
+  // Current state and (odd) stream increment
+  uint64_t state_, inc_;
+};
+
+// Function Prototypes
+Pcg32 PixelRng(const uint32_t, const int, const int, const uint32_t);
+uint32_t CounterRandom(const uint64_t, const uint32_t);
+void FillUniform(const uint64_t, const uint32_t, float *, const size_t);
+uint32_t ReverseBits(uint32_t);
+uint32_t OwenScramble(const uint32_t, const uint32_t);
+void Sobol2D(const uint32_t, const uint32_t, float &, float &);
+float RadicalInverse(const int, uint32_t);
+float OwenScrambledRadicalInverse(const int, uint32_t, const uint32_t);
+float Halton(const int, const uint32_t, const uint32_t);
+
+// The first 16 primes: the bases of the Halton dimensions
+const int HALTON_PRIMES[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+const int HALTON_MAX_DIMENSIONS = sizeof(HALTON_PRIMES) / sizeof(HALTON_PRIMES[0]);
+#endif
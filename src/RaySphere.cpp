@@ -0,0 +1,148 @@
+/*
+ * RaySphere.cpp
+ *
+ * Ray-sphere intersection and ray helpers.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "RaySphere.h"
+#include "kernels/Kernels.h"
+
+/**
+ * @brief  Computes the point that lies on the ray
+ *         at distance t away from the origin.
+ * @param ray: Input ray
+ * @param t: Distance away from origin
+ * @return Tuple: Point that lies on the ray.
+ */
+Tuple Position(const Ray &ray, const float t) {
+  return ray.Origin() + ray.Direction() * t;
+}
+
+/**
+ * @brief  Computes the reflection of a vector around the specified
+ *         surface normal.
+ */
+Tuple Reflect(const Tuple &vec, const Tuple &norm) {
+  return vec - norm * 2 * Dot(vec, norm);
+}
+
+/**
+ * @brief  Computes intersections between the specified
+ *         ray and sphere.
+ * @param sphere: Input sphere
+ * @param ray: Input ray
+ * @return std::vector<Intersection>: Intersections at distance t from the ray's origin
+ */
+std::vector<Intersection> Intersect(const Sphere &sphere, const Ray &ray) {
+
+  // Apply the sphere's transformation to the ray:
+  const Ray RAY_T = ObjectSpaceRay(sphere, ray);
+
+  std::vector<Intersection> intersections;
+
+  /*
+   * The intersectUnitSphere kernel solves the quadratic for the unit
+   * sphere.  A tangent ray gives one intersection, duplicated; the two
+   * come back in increasing order.
+   */
+  float origin[4], direction[4];
+  RAY_T.Origin().Store(origin);
+  RAY_T.Direction().Store(direction);
+  float t0, t1;
+  const size_t HITS = GetRenderKernels().intersectUnitSphere(origin, direction, 1, &t0, &t1);
+  COUNT_RENDER_STAT(STAT_INTERSECTION_TESTS, 1);
+
+  if (HITS > 0) {
+    COUNT_RENDER_STAT(STAT_HITS, 1);
+    intersections = Intersections(2, Intersection(t0, sphere), Intersection(t1, sphere));
+  }
+
+  return intersections;
+}
+
+/**
+ * @brief  Transforms a ray into the sphere's object space, where the sphere
+ *         is the unit sphere at the origin.
+ */
+Ray ObjectSpaceRay(const Sphere &sphere, const Ray &ray) {
+  return sphere.HasAffineTransform() ? Transform(ray, sphere.AffineInverse()) :
+                                       Transform(ray, Inverse(sphere.Transform()));
+}
+
+/**
+ * @brief  Collects any number of intersection objects
+ *         into a std::vector.
+ */
+std::vector<Intersection> Intersections(const int numArgs, ...) {
+  std::vector<Intersection> inters;
+
+  va_list vaList;
+  va_start(vaList, numArgs);
+  for (int i = 0; i < numArgs; ++i) {
+    inters.push_back(va_arg(vaList, Intersection));
+  }
+  va_end(vaList);
+
+  return inters;
+}
+
+/**
+ * @brief  Computes which intersection will be the first one
+ *         to hit the object.
+ */
+Intersection Hit(const std::vector<Intersection> &intersects) {
+  // If no hits found, return an Intersection with FLT_MAX.  The miss is
+  // built once (thread safe as a function local static) so a miss never
+  // constructs a Sphere, which would take a new ID.
+  static const Intersection MISS(FLT_MAX, Sphere());
+  Intersection hit = MISS;
+
+  float smallestT = FLT_MAX;
+
+  // Iterate through all intersections
+  for (size_t i = 0; i < intersects.size(); ++i) {
+    // The hit is the intersection with the smallest positive t_ value
+    if (intersects[i].T() >= 0.0 && intersects[i].T() < smallestT) {
+      smallestT = intersects[i].T();
+      hit = intersects[i];
+    }
+  }
+
+  return hit;
+}
+
+/**
+ * @brief  Applies the transformation matrix to the specified ray.
+ */
+Ray Transform(const Ray &ray, const Matrix &transform) {
+  if (transform.GetRows() != 4 || transform.GetCols() != 4) {
+    // Apply transformation to both the ray's origin and direction:
+    const Tuple TRANSFORMED_ORIGIN    = transform * ray.Origin();
+    const Tuple TRANSFORMED_DIRECTION = transform * ray.Direction();
+
+    return Ray(TRANSFORMED_ORIGIN, TRANSFORMED_DIRECTION);
+  }
+
+  // Transform the origin and direction together with the transformTuples kernel
+  float matrix[16];
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      matrix[4 * row + col] = transform.GetValue(row, col);
+    }
+  }
+  float in[8], out[8];
+  ray.Origin().Store(in);
+  ray.Direction().Store(in + 4);
+  GetRenderKernels().transformTuples(matrix, in, out, 2);
+
+  return Ray(Tuple(out[0], out[1], out[2], out[3]), Tuple(out[4], out[5], out[6], out[7]));
+}
+
+/**
+ * @brief  Applies an affine transformation to the specified ray.
+ */
+Ray Transform(const Ray &ray, const AffineTransform &transform) {
+  return Ray(TransformPoint(transform, ray.Origin()), TransformVector(transform, ray.Direction()));
+}
@@ -10,8 +10,12 @@
  */
 #include "Tuple.h"
 #include "Matrix.h"
+#include "AffineTransform.h"
+#include "TransformBuilder.h"
 #include "Material.h"
+#include "RenderStats.h"
 
+#include <atomic>
 #include <cfloat>
 #include <cmath>
 #include <cstdarg>
@@ -80,6 +84,8 @@ public:
              radius_(1.0),
              id_(GenerateUniqueID()),
              transform_(Identity(4)),
+             affine_(true),
+             inverse_(),
              material_(Material()) {
   }
 
@@ -97,6 +103,8 @@ public:
     radius_(rhs.radius_),
     id_(rhs.id_),
     transform_(rhs.transform_),
+    affine_(rhs.affine_),
+    inverse_(rhs.inverse_),
     material_(rhs.material_) {
   }
 
@@ -110,6 +118,8 @@ public:
       radius_    = rhs.radius_;
       id_        = rhs.id_;
       transform_ = rhs.transform_;
+      affine_    = rhs.affine_;
+      inverse_   = rhs.inverse_;
       material_  = rhs.material_;
     }
     return *this;
@@ -132,6 +142,11 @@ public:
    * @return Tuple: Normal vector to point
    */
   Tuple NormalAt(const Tuple &pt) const {
+    if (affine_) {
+      const Tuple OBJECT_NORMAL = TransformPoint(inverse_, pt) - Point(0, 0, 0);
+      return Normalize(TransformNormal(inverse_, OBJECT_NORMAL));
+    }
+
     const Tuple OBJECT_PT = Inverse(transform_) * pt;
     const Tuple OBJECT_NORMAL = OBJECT_PT - Point(0, 0, 0);
     Tuple worldNormal = Transpose(Inverse(transform_)) * OBJECT_NORMAL;
@@ -146,7 +161,22 @@ public:
   Matrix Transform() const { return transform_; }
   Material GetMaterial() const { return material_; }
 
-  void SetTransform(const Matrix &trans) { transform_ = trans; }
+  // Whether the transform is affine, in which case its inverse is cached
+  bool HasAffineTransform() const { return affine_; }
+  const AffineTransform &AffineInverse() const { return inverse_; }
+
+  void SetTransform(const Matrix &trans) {
+    transform_ = trans;
+    affine_    = IsAffine(trans);
+    inverse_   = affine_ ? Inverse(ToAffine(trans)) : AffineTransform();
+  }
+
+  // Takes the inverse the builder tracked instead of computing one
+  void SetTransform(const TransformBuilder &builder) {
+    transform_ = builder.ForwardMatrix();
+    affine_    = true;
+    inverse_   = builder.InverseAffine();
+  }
   void SetMaterial(const Material &mat) { material_ = mat; }
 private:
   // Floating comparison
@@ -154,11 +184,12 @@ private:
     return std::fabs(num1 - num2) <= 0.0001;
   }
 
-  // Helper function to generate a unique ID each time this is called
+  // Helper function to generate a unique ID each time this is called.
+  // Spheres may be built on several threads at once, so the counter is
+  // atomic.
   int GenerateUniqueID() const {
-    static int nextID = 0;
-    ++nextID;
-    return nextID - 1;
+    static std::atomic<int> nextID(0);
+    return nextID.fetch_add(1);
   }
 
   // A sphere is centered around an origin
@@ -173,6 +204,11 @@ private:
   // Transformation associated with the sphere
   Matrix transform_;
 
+  // Whether transform_ is affine, and if so its inverse (so intersecting
+  // and shading do not have to invert the full matrix every time)
+  bool affine_;
+  AffineTransform inverse_;
+
   // Material associated with the sphere
   Material material_;
 };
@@ -242,122 +278,9 @@ private:
 Tuple Position(const Ray &, const float);
 Tuple Reflect(const Tuple &, const Tuple &);
 std::vector<Intersection> Intersect(const Sphere &, const Ray &);
+Ray ObjectSpaceRay(const Sphere &, const Ray &);
 std::vector<Intersection> Intersections(const int, ...);
 Intersection Hit(const std::vector<Intersection> &);
 Ray Transform(const Ray &, const Matrix &);
-
-/**
- * @brief  Computes the point that lies on the ray
- *         at distance t away from the origin.
- * @param ray: Input ray
- * @param t: Distance away from origin
- * @return Tuple: Point that lies on the ray.
- */
-Tuple Position(const Ray &ray, const float t) {
-  return ray.Origin() + ray.Direction() * t;
-}
-
-/**
- * @brief  Computes the reflection of a vector around the specified
- *         surface normal.
- */
-Tuple Reflect(const Tuple &vec, const Tuple &norm) {
-  return vec - norm * 2 * Dot(vec, norm);
-}
-
-/**
- * @brief  Computes intersections between the specified
- *         ray and sphere.
- * @param sphere: Input sphere
- * @param ray: Input ray
- * @return std::vector<Intersection>: Intersections at distance t from the ray's origin
- */
-std::vector<Intersection> Intersect(const Sphere &sphere, const Ray &ray) {
-
-  // Apply the sphere's transformation to the ray:
-  const Ray RAY_T = Transform(ray, Inverse(sphere.Transform()));
-
-  std::vector<Intersection> intersections;
-
-  // Compute the discriminant to determine if the ray intersects the sphere
-  const Tuple SPHERE_TO_RAY = RAY_T.Origin() - Point(0, 0, 0);
-  const float A = Dot(RAY_T.Direction(), RAY_T.Direction());
-  const float B = 2 * Dot(RAY_T.Direction(), SPHERE_TO_RAY);
-  const float C = Dot(SPHERE_TO_RAY, SPHERE_TO_RAY) - 1;
-
-  const float DISCRIMINANT = (B*B) - (4*A*C);
-
-  /*
-   * If the discriminant < 0, no intersections
-   *                     = 0, one intersection
-   *                     > 0, two intersections
-   */
-  if (DISCRIMINANT >= 0.0) {
-    // For one intersection, duplicate it:
-    const float INTER1 = (-B - sqrt(DISCRIMINANT))/(2*A);
-    const float INTER2 = (-B + sqrt(DISCRIMINANT))/(2*A);
-
-    const Intersection IS1(INTER1, sphere);
-    const Intersection IS2(INTER2, sphere);
-
-    // Push intersections in increasing order:
-    if (INTER1 < INTER2) {
-      intersections = Intersections(2, IS1, IS2);
-    } else {
-      intersections = Intersections(2, IS2, IS1);
-    }
-  }
-
-  return intersections;
-}
-
-/**
- * @brief  Collects any number of intersection objects
- *         into a std::vector.
- */
-std::vector<Intersection> Intersections(const int numArgs, ...) {
-  std::vector<Intersection> inters;
-
-  va_list vaList;
-  va_start(vaList, numArgs);
-  for (int i = 0; i < numArgs; ++i) {
-    inters.push_back(va_arg(vaList, Intersection));
-  }
-  va_end(vaList);
-
-  return inters;
-}
-
-/**
- * @brief  Computes which intersection will be the first one
- *         to hit the object.
- */
-Intersection Hit(const std::vector<Intersection> &intersects) {
-  // If no hits found, return an Intersection with FLT_MAX
-  Intersection hit(FLT_MAX, Sphere());
-
-  float smallestT = FLT_MAX;
-
-  // Iterate through all intersections
-  for (size_t i = 0; i < intersects.size(); ++i) {
-    // The hit is the intersection with the smallest positive t_ value
-    if (intersects[i].T() >= 0.0 && intersects[i].T() < smallestT) {
-      smallestT = intersects[i].T();
-      hit = intersects[i];
-    }
-  }
-
-  return hit;
-}
-
-/**
- * @brief  Applies the transformation matrix to the specified ray.
- */
-Ray Transform(const Ray &ray, const Matrix &transform) {
-  // Apply transformation to both the ray's origin and direction:
-  const Tuple TRANSFORMED_ORIGIN    = transform * ray.Origin();
-  const Tuple TRANSFORMED_DIRECTION = transform * ray.Direction();
-
-  return Ray(TRANSFORMED_ORIGIN, TRANSFORMED_DIRECTION);
-}
+Ray Transform(const Ray &, const AffineTransform &);
 #endif
@@ -0,0 +1,81 @@
+/*
+ * RenderClient.cpp
+ *
+ * Client side of the render daemon protocol.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "RenderClient.h"
+
+/**
+ * @brief  Sends a job to the server and writes the tiles it streams back
+ *         onto the canvas, which must be at least job.width x job.height.
+ * @param error: Set to the reason if the render fails
+ * @param onTile: Optional function called as each tile arrives
+ * @return bool: True if every tile was received
+ */
+bool RequestRender(const std::string &socketPath, const RenderJob &job, Canvas &canvas,
+                   std::string &error, const TileReceivedFunction &onTile) {
+  const int FD = ConnectUnix(socketPath);
+  if (FD < 0) {
+    error = "cannot connect to " + socketPath;
+    return false;
+  }
+
+  if (!SendMessage(FD, MSG_JOB, SerializeJob(job))) {
+    close(FD);
+    error = "connection lost";
+    return false;
+  }
+
+  bool success = false;
+  error = "connection lost";
+
+  uint32_t type;
+  std::string payload;
+  while (ReceiveMessage(FD, type, payload)) {
+    if (type == MSG_TILE) {
+      Tile tile;
+      std::vector<Color> pixels;
+      if (!DecodeTile(payload, tile, pixels)) {
+        error = "malformed tile";
+        break;
+      }
+
+      size_t next = 0;
+      for (int y = tile.y0; y < tile.y1; ++y) {
+        for (int x = tile.x0; x < tile.x1; ++x) {
+          canvas.WritePixel(x, y, pixels[next++]);
+        }
+      }
+      if (onTile) {
+        onTile(tile);
+      }
+    } else if (type == MSG_DONE) {
+      success = true;
+      error.clear();
+      break;
+    } else {
+      error = (type == MSG_ERROR) ? payload : "unexpected message";
+      break;
+    }
+  }
+
+  close(FD);
+  return success;
+}
+
+/**
+ * @brief  Asks the server to stop serving.
+ */
+bool RequestShutdown(const std::string &socketPath) {
+  const int FD = ConnectUnix(socketPath);
+  if (FD < 0) {
+    return false;
+  }
+
+  const bool SENT = SendMessage(FD, MSG_SHUTDOWN, "");
+  close(FD);
+  return SENT;
+}
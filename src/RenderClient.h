@@ -0,0 +1,29 @@
+#ifndef __RENDER_CLIENT_H_
+#define __RENDER_CLIENT_H_
+/*
+ * RenderClient.h
+ *
+ * Client side of the render server protocol (see RenderServer.h).
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Color.h"
+#include "Canvas.h"
+#include "TileScheduler.h"
+#include "RenderProtocol.h"
+
+#include <unistd.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// Called as each tile arrives, after its pixels have been written to the canvas
+typedef std::function<void(const Tile &)> TileReceivedFunction;
+
+// Function Prototypes
+bool RequestRender(const std::string &, const RenderJob &, Canvas &, std::string &,
+                   const TileReceivedFunction & = TileReceivedFunction());
+bool RequestShutdown(const std::string &);
+#endif
@@ -0,0 +1,421 @@
+/*
+ * RenderProtocol.cpp
+ *
+ * Job and tile serialization and the socket helpers.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "RenderProtocol.h"
+
+/**
+ * @brief  Converts a job to its "key value" text form.
+ */
+std::string SerializeJob(const RenderJob &job) {
+  std::ostringstream out;
+  out.precision(9);
+  out << "scene " << job.scene << "\n"
+      << "width " << job.width << "\n"
+      << "height " << job.height << "\n"
+      << "tile " << job.tileSize << "\n";
+
+  if (job.overrideCamera) {
+    out << "from " << job.from.X() << " " << job.from.Y() << " " << job.from.Z() << "\n"
+        << "to "   << job.to.X()   << " " << job.to.Y()   << " " << job.to.Z()   << "\n"
+        << "up "   << job.up.X()   << " " << job.up.Y()   << " " << job.up.Z()   << "\n"
+        << "fov "  << job.fov << "\n";
+  }
+  return out.str();
+}
+
+/**
+ * @brief  Parses the text form of a job.  Missing keys keep their defaults;
+ *         any of from/to/up/fov turns on the camera override.
+ * @param error: Set to the reason if the job is rejected
+ * @return bool: False if a line is malformed or the image or tile size is
+ *               out of range
+ */
+bool ParseJob(const std::string &text, RenderJob &job, std::string &error) {
+  job = RenderJob();
+
+  std::istringstream in(text);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty()) {
+      continue;
+    }
+
+    std::istringstream fields(line);
+    std::string key;
+    fields >> key;
+
+    if (key == "scene") {
+      fields >> job.scene;
+    } else if (key == "width") {
+      fields >> job.width;
+    } else if (key == "height") {
+      fields >> job.height;
+    } else if (key == "tile") {
+      fields >> job.tileSize;
+    } else if (key == "from" || key == "to" || key == "up") {
+      float x, y, z;
+      fields >> x >> y >> z;
+      if (key == "from") {
+        job.from = Point(x, y, z);
+      } else if (key == "to") {
+        job.to = Point(x, y, z);
+      } else {
+        job.up = Vector(x, y, z);
+      }
+      job.overrideCamera = true;
+    } else if (key == "fov") {
+      fields >> job.fov;
+      job.overrideCamera = true;
+    } else {
+      error = "unknown job key: " + key;
+      return false;
+    }
+
+    if (fields.fail()) {
+      error = "malformed job line: " + line;
+      return false;
+    }
+  }
+
+  return ValidateJob(job, error);
+}
+
+/**
+ * @brief  Checks that a job's image and tile sizes are within the limits
+ *         every renderer accepts (see MAX_JOB_DIMENSION).
+ * @param error: Set to the reason if the job is rejected
+ */
+bool ValidateJob(const RenderJob &job, std::string &error) {
+  if (job.width <= 0 || job.height <= 0 ||
+      job.width > MAX_JOB_DIMENSION || job.height > MAX_JOB_DIMENSION ||
+      static_cast<int64_t>(job.width) * job.height > MAX_JOB_PIXELS) {
+    error = "image size " + std::to_string(job.width) + "x" + std::to_string(job.height) +
+            " is out of range (at most " + std::to_string(MAX_JOB_DIMENSION) + " per side and " +
+            std::to_string(MAX_JOB_PIXELS) + " pixels)";
+    return false;
+  }
+  if (job.tileSize <= 0 || job.tileSize > MAX_TILE_SIZE) {
+    error = "tile size " + std::to_string(job.tileSize) + " is out of range (1 to " +
+            std::to_string(MAX_TILE_SIZE) + ")";
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief  Parses the text form of a job, discarding the reason for a
+ *         rejection (see the three argument ParseJob()).
+ */
+bool ParseJob(const std::string &text, RenderJob &job) {
+  std::string error;
+  return ParseJob(text, job, error);
+}
+
+/**
+ * @brief  Encodes a tile and its pixels (scanline order) as a binary payload.
+ */
+std::string EncodeTile(const Tile &tile, const std::vector<Color> &pixels) {
+  std::vector<uint32_t> words;
+  words.reserve(4 + pixels.size() * 3);
+  words.push_back(tile.x0);
+  words.push_back(tile.y0);
+  words.push_back(tile.x1);
+  words.push_back(tile.y1);
+
+  for (size_t i = 0; i < pixels.size(); ++i) {
+    const float RGB[3] = {pixels[i].Red(), pixels[i].Green(), pixels[i].Blue()};
+    for (int c = 0; c < 3; ++c) {
+      uint32_t bits;
+      memcpy(&bits, &RGB[c], sizeof(bits));
+      words.push_back(bits);
+    }
+  }
+
+  for (size_t i = 0; i < words.size(); ++i) {
+    words[i] = htonl(words[i]);
+  }
+  return std::string(reinterpret_cast<const char *>(words.data()), words.size() * 4);
+}
+
+/**
+ * @brief  Decodes a tile payload.
+ * @return bool: False if the payload size does not match the tile bounds
+ */
+bool DecodeTile(const std::string &payload, Tile &tile, std::vector<Color> &pixels) {
+  if (payload.size() < 16 || payload.size() % 4 != 0) {
+    return false;
+  }
+
+  std::vector<uint32_t> words(payload.size() / 4);
+  memcpy(words.data(), payload.data(), payload.size());
+  for (size_t i = 0; i < words.size(); ++i) {
+    words[i] = ntohl(words[i]);
+  }
+
+  tile.x0    = words[0];
+  tile.y0    = words[1];
+  tile.x1    = words[2];
+  tile.y1    = words[3];
+  tile.index = 0;
+
+  if (tile.x1 < tile.x0 || tile.y1 < tile.y0) {
+    return false;
+  }
+  const size_t COUNT = static_cast<size_t>(tile.x1 - tile.x0) * (tile.y1 - tile.y0);
+  if (words.size() != 4 + COUNT * 3) {
+    return false;
+  }
+
+  pixels.resize(COUNT);
+  for (size_t i = 0; i < COUNT; ++i) {
+    float rgb[3];
+    for (int c = 0; c < 3; ++c) {
+      memcpy(&rgb[c], &words[4 + i * 3 + c], sizeof(float));
+    }
+    pixels[i] = Color(rgb[0], rgb[1], rgb[2]);
+  }
+  return true;
+}
+
+/**
+ * @brief  Writes the whole buffer to a socket.
+ * @return bool: False if the connection failed
+ */
+bool SendAll(const int fd, const char *data, const size_t size) {
+  size_t sent = 0;
+  while (sent < size) {
+    // MSG_NOSIGNAL: report a closed peer as an error instead of raising SIGPIPE
+    const ssize_t RESULT = send(fd, data + sent, size - sent, MSG_NOSIGNAL);
+    if (RESULT < 0 && errno == EINTR) {
+      continue;
+    }
+    if (RESULT <= 0) {
+      return false;
+    }
+    sent += RESULT;
+  }
+  return true;
+}
+
+/**
+ * @brief  Reads exactly size bytes from a socket.
+ * @return bool: False if the connection closed or failed first
+ */
+bool ReceiveAll(const int fd, char *data, const size_t size) {
+  size_t received = 0;
+  while (received < size) {
+    const ssize_t RESULT = recv(fd, data + received, size - received, 0);
+    if (RESULT < 0 && errno == EINTR) {
+      continue;
+    }
+    if (RESULT <= 0) {
+      return false;
+    }
+    received += RESULT;
+  }
+  return true;
+}
+
+/**
+ * @brief  Sends one message.
+ */
+bool SendMessage(const int fd, const uint32_t type, const std::string &payload) {
+  const uint32_t HEADER[2] = {htonl(type), htonl(static_cast<uint32_t>(payload.size()))};
+  return SendAll(fd, reinterpret_cast<const char *>(HEADER), sizeof(HEADER)) &&
+         SendAll(fd, payload.data(), payload.size());
+}
+
+/**
+ * @brief  Receives one message.
+ * @return bool: False if the connection closed or the header is invalid
+ */
+bool ReceiveMessage(const int fd, uint32_t &type, std::string &payload) {
+  uint32_t header[2];
+  if (!ReceiveAll(fd, reinterpret_cast<char *>(header), sizeof(header))) {
+    return false;
+  }
+
+  type = ntohl(header[0]);
+  const uint32_t SIZE = ntohl(header[1]);
+  if (SIZE > MAX_MESSAGE_SIZE) {
+    return false;
+  }
+
+  payload.resize(SIZE);
+  return SIZE == 0 || ReceiveAll(fd, &payload[0], SIZE);
+}
+
+/**
+ * @brief  Accepts a connection, retrying if a signal interrupts the wait.
+ * @return int: The connected socket, or -1 on failure (see errno)
+ */
+int AcceptConnection(const int listenFd) {
+  int fd;
+  do {
+    fd = accept(listenFd, NULL, NULL);
+  } while (fd < 0 && errno == EINTR);
+  return fd;
+}
+
+/**
+ * @brief  Creates a Unix domain socket listening at path, replacing any
+ *         stale socket left there.  Anything at path that is not a socket
+ *         (e.g. a regular file named by mistake) is left alone.
+ * @return int: The listening socket, or -1 on failure
+ */
+int ListenUnix(const std::string &path) {
+  sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(addr.sun_path)) {
+    return -1;
+  }
+  strcpy(addr.sun_path, path.c_str());
+
+  const int FD = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (FD < 0) {
+    return -1;
+  }
+
+  struct stat existing;
+  if (lstat(path.c_str(), &existing) == 0) {
+    if (!S_ISSOCK(existing.st_mode)) {
+      close(FD);
+      return -1;
+    }
+    unlink(path.c_str());
+  }
+
+  if (bind(FD, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 ||
+      listen(FD, 16) != 0) {
+    close(FD);
+    return -1;
+  }
+  return FD;
+}
+
+/**
+ * @brief  Connects to a Unix domain socket.
+ * @return int: The connected socket, or -1 on failure
+ */
+int ConnectUnix(const std::string &path) {
+  sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(addr.sun_path)) {
+    return -1;
+  }
+  strcpy(addr.sun_path, path.c_str());
+
+  const int FD = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (FD < 0) {
+    return -1;
+  }
+
+  if (connect(FD, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0) {
+    close(FD);
+    return -1;
+  }
+  return FD;
+}
+
+/**
+ * @brief  Checks if a numeric IPv4 address is a loopback address
+ *         (127.0.0.0/8), reachable only from this host.
+ */
+bool IsLoopbackAddress(const std::string &address) {
+  in_addr addr;
+  return inet_pton(AF_INET, address.c_str(), &addr) == 1 &&
+         (ntohl(addr.s_addr) >> 24) == 127;
+}
+
+/**
+ * @brief  Compares a token received from a peer with the expected one.
+ *         The time taken depends only on the expected token's length, so
+ *         a peer cannot guess the token a byte at a time.
+ */
+bool TokensMatch(const std::string &expected, const std::string &received) {
+  unsigned char difference = (expected.size() != received.size()) ? 1 : 0;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    const char RECEIVED = (i < received.size()) ? received[i] : 0;
+    difference |= static_cast<unsigned char>(expected[i] ^ RECEIVED);
+  }
+  return difference == 0;
+}
+
+/**
+ * @brief  Creates a TCP socket listening on one IPv4 address.
+ * @param address: Numeric address to bind, e.g. "127.0.0.1" for this host
+ *                 only or "0.0.0.0" for every interface
+ * @param port: Port to listen on, or 0 to pick any free port
+ * @param boundPort: Set to the port actually listened on
+ * @return int: The listening socket, or -1 on failure
+ */
+int ListenTcp(const std::string &address, const int port, int &boundPort) {
+  addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family   = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags    = AI_PASSIVE | AI_NUMERICHOST;
+
+  addrinfo *results = NULL;
+  if (getaddrinfo(address.c_str(), std::to_string(port).c_str(), &hints, &results) != 0) {
+    return -1;
+  }
+  sockaddr_in addr;
+  memcpy(&addr, results->ai_addr, sizeof(addr));
+  freeaddrinfo(results);
+
+  const int FD = socket(AF_INET, SOCK_STREAM, 0);
+  if (FD < 0) {
+    return -1;
+  }
+
+  const int REUSE = 1;
+  setsockopt(FD, SOL_SOCKET, SO_REUSEADDR, &REUSE, sizeof(REUSE));
+
+  socklen_t length = sizeof(addr);
+  if (bind(FD, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 ||
+      listen(FD, 64) != 0 ||
+      getsockname(FD, reinterpret_cast<sockaddr *>(&addr), &length) != 0) {
+    close(FD);
+    return -1;
+  }
+
+  boundPort = ntohs(addr.sin_port);
+  return FD;
+}
+
+/**
+ * @brief  Connects to a TCP server.
+ * @param host: Host name or address
+ * @return int: The connected socket, or -1 on failure
+ */
+int ConnectTcp(const std::string &host, const int port) {
+  addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family   = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+
+  addrinfo *results = NULL;
+  if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &results) != 0) {
+    return -1;
+  }
+
+  int fd = -1;
+  for (addrinfo *ai = results; ai != NULL && fd < 0; ai = ai->ai_next) {
+    fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+    if (fd >= 0 && connect(fd, ai->ai_addr, ai->ai_addrlen) != 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+
+  freeaddrinfo(results);
+  return fd;
+}
@@ -0,0 +1,103 @@
+#ifndef __RENDER_PROTOCOL_H_
+#define __RENDER_PROTOCOL_H_
+/*
+ * RenderProtocol.h
+ *
+ * Wire format shared by the render server and its clients.  Every message
+ * is an 8 byte header (type and payload length, both 32 bit big endian)
+ * followed by the payload.  Jobs are sent as "key value" text lines so that
+ * they are easy to inspect; tiles are sent as binary (tile bounds followed by
+ * the RGB floats of each pixel in scanline order).  The same messages are
+ * used over Unix domain sockets (render server) and TCP (distributed
+ * rendering).
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "Color.h"
+#include "TileScheduler.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cmath> // M_PI
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Message types
+enum MessageType {
+  MSG_JOB      = 1,  // Client to server: a RenderJob
+  MSG_TILE     = 2,  // Server to client: a finished tile
+  MSG_DONE     = 3,  // Server to client: every tile has been sent ("key value" stats)
+  MSG_ERROR    = 4,  // Server to client: the job was rejected (reason as text)
+  MSG_SHUTDOWN = 5,  // Client to server: stop serving
+  MSG_HELLO    = 6,  // Worker to coordinator: ready for work (payload is the job token)
+  MSG_ASSIGN   = 7   // Coordinator to worker: render tiles "first count" of the job
+};
+
+// Largest payload accepted, to guard against corrupt headers
+const uint32_t MAX_MESSAGE_SIZE = 64 * 1024 * 1024;
+
+/*
+ * Largest job accepted.  A job is rendered into a full canvas, so the size
+ * is limited both per side and in total pixels (16M pixels is 256 MB of
+ * Color).  A tile is sent as one message of 12 bytes per pixel, so tiles
+ * are limited to what fits in MAX_MESSAGE_SIZE.
+ */
+const int MAX_JOB_DIMENSION = 16384;
+const int64_t MAX_JOB_PIXELS = 4096 * 4096;
+const int MAX_TILE_SIZE = 2048;
+
+/**
+ * @brief  A request to render a frame of a named scene (see Scenes.h).
+ */
+struct RenderJob {
+  RenderJob() :
+    scene("default"), width(100), height(100), tileSize(16), overrideCamera(false),
+    from(Point(0, 0, -5)), to(Point(0, 0, 0)), up(Vector(0, 1, 0)), fov(M_PI/3) {
+  }
+
+  std::string scene;
+
+  // Size of the output image in pixels
+  int width, height;
+
+  // Edge length of the tiles streamed back to the client
+  int tileSize;
+
+  // If set, the camera below is used instead of the scene's own camera
+  bool overrideCamera;
+  Tuple from, to, up;
+  float fov;
+};
+
+// Function Prototypes
+std::string SerializeJob(const RenderJob &);
+bool ParseJob(const std::string &, RenderJob &);
+bool ParseJob(const std::string &, RenderJob &, std::string &);
+bool ValidateJob(const RenderJob &, std::string &);
+std::string EncodeTile(const Tile &, const std::vector<Color> &);
+bool DecodeTile(const std::string &, Tile &, std::vector<Color> &);
+bool SendAll(const int, const char *, const size_t);
+bool ReceiveAll(const int, char *, const size_t);
+bool SendMessage(const int, const uint32_t, const std::string &);
+bool ReceiveMessage(const int, uint32_t &, std::string &);
+int AcceptConnection(const int);
+int ListenUnix(const std::string &);
+int ConnectUnix(const std::string &);
+bool IsLoopbackAddress(const std::string &);
+bool TokensMatch(const std::string &, const std::string &);
+int ListenTcp(const std::string &, const int, int &);
+int ConnectTcp(const std::string &, const int);
+#endif
@@ -0,0 +1,38 @@
+/*
+ * RenderServer.cpp
+ *
+ * Tile tracing for the render daemon.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "RenderServer.h"
+
+/**
+ * @brief  Constructs the camera for a job: the job's own camera if it
+ *         overrides the scene's, otherwise the scene's.
+ */
+Camera JobCamera(const RenderJob &job, const Scene &scene) {
+  if (!job.overrideCamera) {
+    return SceneCamera(scene, job.width, job.height);
+  }
+
+  Camera camera(job.width, job.height, job.fov);
+  camera.SetTransform(ViewTransform(job.from, job.to, job.up));
+  return camera;
+}
+
+/**
+ * @brief  Traces every pixel of a tile.
+ * @return std::vector<Color>: The pixels in scanline order
+ */
+std::vector<Color> TraceTile(const World &world, const Camera &camera, const Tile &tile) {
+  std::vector<Color> pixels;
+  pixels.reserve((tile.x1 - tile.x0) * (tile.y1 - tile.y0));
+  for (int y = tile.y0; y < tile.y1; ++y) {
+    for (int x = tile.x0; x < tile.x1; ++x) {
+      pixels.push_back(ColorAt(world, RayForPixel(camera, x, y)));
+    }
+  }
+  return pixels;
+}
@@ -0,0 +1,185 @@
+#ifndef __RENDER_SERVER_H_
+#define __RENDER_SERVER_H_
+/*
+ * RenderServer.h
+ *
+ * A long-lived render server.  Scenes are built the first time a job
+ * references them and then kept, and the worker threads are started once,
+ * so the time to answer a job is just the time to trace it.  Jobs arrive
+ * over a Unix domain socket (see RenderProtocol.h) and each tile is streamed
+ * back to the client as soon as it is finished.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Color.h"
+#include "Camera.h"
+#include "World.h"
+#include "Scenes.h"
+#include "TileScheduler.h"
+#include "RenderProtocol.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Function Prototypes
+Camera JobCamera(const RenderJob &, const Scene &);
+std::vector<Color> TraceTile(const World &, const Camera &, const Tile &);
+
+/**
+ * @brief  RenderServer class
+ */
+class RenderServer {
+public:
+  /**
+   * @brief Constructor.  Starts the worker threads.
+   * @param socketPath: Path of the Unix domain socket to serve on
+   * @param numThreads: Number of worker threads.  0 uses one per hardware thread.
+   */
+  explicit RenderServer(const std::string &socketPath, const int numThreads = 0) :
+    socketPath_(socketPath),
+    listenFd_(-1),
+    scheduler_(numThreads),
+    jobsServed_(0) {
+  }
+
+  /**
+   * @brief Destructor.  Closes and removes the socket.
+   */
+  ~RenderServer() {
+    if (listenFd_ >= 0) {
+      close(listenFd_);
+      unlink(socketPath_.c_str());
+    }
+  }
+
+  /**
+   * @brief Creates the socket.  Clients may connect once this returns true,
+   *        even before Serve() is called.
+   */
+  bool Listen() {
+    listenFd_ = ListenUnix(socketPath_);
+    return listenFd_ >= 0;
+  }
+
+  /**
+   * @brief Serves clients, one connection at a time, until a client sends
+   *        MSG_SHUTDOWN.  A connection may submit any number of jobs.
+   *        If accepting keeps failing (e.g. out of file descriptors), waits
+   *        longer between attempts, up to a second, instead of spinning.
+   */
+  void Serve() {
+    bool running = true;
+    int backoffMs = 0;
+    while (running) {
+      const int CLIENT = AcceptConnection(listenFd_);
+      if (CLIENT < 0) {
+        backoffMs = std::min(std::max(2 * backoffMs, 10), 1000);
+        std::this_thread::sleep_for(std::chrono::milliseconds(backoffMs));
+        continue;
+      }
+      backoffMs = 0;
+      running = HandleConnection(CLIENT);
+      close(CLIENT);
+    }
+  }
+
+  // Accessor functions
+  int JobsServed() const { return jobsServed_; }
+  int NumThreads() const { return scheduler_.NumThreads(); }
+
+private:
+  /**
+   * @brief Runs the jobs sent over one connection.
+   * @return bool: False if the client asked the server to shut down
+   */
+  bool HandleConnection(const int fd) {
+    uint32_t type;
+    std::string payload;
+
+    while (ReceiveMessage(fd, type, payload)) {
+      if (type == MSG_SHUTDOWN) {
+        return false;
+      }
+
+      RenderJob job;
+      std::string error;
+      if (type != MSG_JOB) {
+        SendMessage(fd, MSG_ERROR, "malformed job");
+        continue;
+      }
+      if (!ParseJob(payload, job, error)) {
+        SendMessage(fd, MSG_ERROR, error);
+        continue;
+      }
+
+      const Scene *scene = scenes_.Find(job.scene);
+      if (!scene) {
+        SendMessage(fd, MSG_ERROR, "unknown scene: " + job.scene);
+        continue;
+      }
+
+      RunJob(fd, job, *scene);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Renders a job, sending each tile as it finishes followed by
+   *        MSG_DONE.
+   */
+  void RunJob(const int fd, const RenderJob &job, const Scene &scene) {
+    const std::chrono::steady_clock::time_point START = std::chrono::steady_clock::now();
+
+    const Camera CAMERA = JobCamera(job, scene);
+    const World &WORLD = scene.world;
+    const std::vector<Tile> TILES = MakeTiles(job.width, job.height, job.tileSize);
+    std::mutex sendMutex;
+    std::atomic<bool> disconnected(false);
+
+    scheduler_.Run(TILES, [&](const Tile &tile, const int) {
+      // Stop tracing once the client has gone away
+      if (disconnected) {
+        return;
+      }
+
+      const std::string PAYLOAD = EncodeTile(tile, TraceTile(WORLD, CAMERA, tile));
+      std::lock_guard<std::mutex> lock(sendMutex);
+      if (!SendMessage(fd, MSG_TILE, PAYLOAD)) {
+        disconnected = true;
+      }
+    });
+
+    const double SECONDS = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - START).count();
+    std::ostringstream stats;
+    stats << "tiles " << TILES.size() << "\n" << "seconds " << SECONDS << "\n";
+    SendMessage(fd, MSG_DONE, stats.str());
+    ++jobsServed_;
+  }
+
+  // The server owns a socket and threads, so it cannot be copied
+  RenderServer(const RenderServer &);
+  RenderServer &operator=(const RenderServer &);
+
+  // Socket the server listens on
+  std::string socketPath_;
+  int listenFd_;
+
+  // Worker threads shared by every job
+  TileScheduler scheduler_;
+
+  // Scenes built so far
+  SceneCache scenes_;
+
+  int jobsServed_;
+};
+#endif
@@ -0,0 +1,239 @@
+/*
+ * RenderStats.cpp
+ *
+ * Render statistic counters and reports.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "RenderStats.h"
+
+/**
+ * @brief  Name of a statistic, as used in the JSON report.
+ */
+const char *RenderStatName(const RenderStat stat) {
+  switch (stat) {
+    case STAT_PRIMARY_RAYS:       return "primaryRays";
+    case STAT_SHADOW_RAYS:        return "shadowRays";
+    case STAT_SECONDARY_RAYS:     return "secondaryRays";
+    case STAT_INTERSECTION_TESTS: return "intersectionTests";
+    case STAT_HITS:               return "hits";
+    case STAT_HEAP_ALLOCATIONS:   return "heapAllocations";
+    case STAT_HEAP_BYTES:         return "heapBytes";
+    case STAT_MATRIX_ALLOCATIONS: return "matrixAllocations";
+    default:                      return "unknown";
+  }
+}
+
+/**
+ * @brief  CPU time used so far by every thread in the process.
+ */
+double ProcessCpuSeconds() {
+  timespec now;
+  if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now) != 0) {
+    return 0.0;
+  }
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief  The process wide statistics state.
+ */
+RenderStatsRegistry &GetRenderStatsRegistry() {
+  // Placement new keeps the registry out of its own allocation count
+  static RenderStatsRegistry *registry = [] {
+    RenderStatsRegistry *created = new (malloc(sizeof(RenderStatsRegistry))) RenderStatsRegistry();
+    created->start    = std::chrono::steady_clock::now();
+    created->startCpu = ProcessCpuSeconds();
+    return created;
+  }();
+  return *registry;
+}
+
+/**
+ * @brief  The calling thread's counters, registered on first use.
+ */
+RenderStatCounters &ThreadRenderStats() {
+  static thread_local RenderStatCounters *counters = NULL;
+  if (!counters) {
+    // Set before registering: registering allocates, which counts again
+    counters = new (malloc(sizeof(RenderStatCounters))) RenderStatCounters();
+
+    RenderStatsRegistry &registry = GetRenderStatsRegistry();
+    std::lock_guard<std::mutex> lock(registry.threadsMutex);
+    registry.threads.push_back(counters);
+  }
+  return *counters;
+}
+
+/**
+ * @brief  Adds to one of the calling thread's counters.
+ */
+void CountRenderStat(const RenderStat stat, const uint64_t amount) {
+  std::atomic<uint64_t> &value = ThreadRenderStats().values[stat];
+  value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+/**
+ * @brief  Sums the counters of every thread.  Counts from threads that are
+ *         still running may be slightly behind.
+ */
+RenderStatTotals GatherRenderStats() {
+  RenderStatTotals totals;
+  RenderStatsRegistry &registry = GetRenderStatsRegistry();
+  std::lock_guard<std::mutex> lock(registry.threadsMutex);
+  for (size_t t = 0; t < registry.threads.size(); ++t) {
+    for (int i = 0; i < NUM_RENDER_STATS; ++i) {
+      totals.values[i] += registry.threads[t]->values[i].load(std::memory_order_relaxed);
+    }
+  }
+  return totals;
+}
+
+/**
+ * @brief  Zeroes every counter and phase and restarts the elapsed time.
+ *         Should not be called while other threads are counting.
+ */
+void ResetRenderStats() {
+  RenderStatsRegistry &registry = GetRenderStatsRegistry();
+  {
+    std::lock_guard<std::mutex> lock(registry.threadsMutex);
+    for (size_t t = 0; t < registry.threads.size(); ++t) {
+      for (int i = 0; i < NUM_RENDER_STATS; ++i) {
+        registry.threads[t]->values[i].store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+  std::lock_guard<std::mutex> lock(registry.phasesMutex);
+  registry.phases.clear();
+  registry.start    = std::chrono::steady_clock::now();
+  registry.startCpu = ProcessCpuSeconds();
+}
+
+/**
+ * @brief  Largest resident set size the process has had, in bytes.
+ */
+uint64_t PeakResidentBytes() {
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  // Linux reports kilobytes
+  return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+}
+
+/**
+ * @brief  Every phase timed so far, in the order they first finished.
+ */
+std::vector<RenderPhaseTiming> RenderPhases() {
+  RenderStatsRegistry &registry = GetRenderStatsRegistry();
+  std::lock_guard<std::mutex> lock(registry.phasesMutex);
+  return registry.phases;
+}
+
+/**
+ * @brief  Formats the statistics as a JSON object.
+ */
+std::string RenderStatsJson() {
+  const RenderStatTotals TOTALS = GatherRenderStats();
+  const std::vector<RenderPhaseTiming> PHASES = RenderPhases();
+
+  const RenderStatsRegistry &REGISTRY = GetRenderStatsRegistry();
+  const double ELAPSED = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - REGISTRY.start).count();
+  const double CPU = ProcessCpuSeconds() - REGISTRY.startCpu;
+
+  char line[256];
+  std::string json = "{\n  \"counters\": {";
+  for (int i = 0; i < NUM_RENDER_STATS; ++i) {
+    snprintf(line, sizeof(line), "%s\n    \"%s\": %llu", i ? "," : "",
+             RenderStatName(static_cast<RenderStat>(i)),
+             static_cast<unsigned long long>(TOTALS.values[i]));
+    json += line;
+  }
+  snprintf(line, sizeof(line),
+           "\n  },\n  \"heapCounted\": %s,\n  \"rays\": %llu,\n  \"raysPerSecond\": %.1f,\n"
+           "  \"peakResidentBytes\": %llu,\n  \"wallSeconds\": %.6f,\n  \"cpuSeconds\": %.6f,\n"
+           "  \"phases\": [",
+           REGISTRY.countsHeap ? "true" : "false",
+           static_cast<unsigned long long>(TOTALS.Rays()), ELAPSED > 0 ? TOTALS.Rays() / ELAPSED : 0.0,
+           static_cast<unsigned long long>(PeakResidentBytes()), ELAPSED, CPU);
+  json += line;
+
+  for (size_t i = 0; i < PHASES.size(); ++i) {
+    const RenderPhaseTiming &PHASE = PHASES[i];
+    json += (i ? ",\n    {\"name\": \"" : "\n    {\"name\": \"") + PHASE.name + "\"";
+    snprintf(line, sizeof(line),
+             ", \"wallSeconds\": %.6f, \"cpuSeconds\": %.6f, \"rays\": %llu, \"raysPerSecond\": %.1f}",
+             PHASE.wallSeconds, PHASE.cpuSeconds, static_cast<unsigned long long>(PHASE.rays),
+             PHASE.wallSeconds > 0 ? PHASE.rays / PHASE.wallSeconds : 0.0);
+    json += line;
+  }
+  json += PHASES.empty() ? "]\n}\n" : "\n  ]\n}\n";
+  return json;
+}
+
+/**
+ * @brief  Prints the statistics as a human readable table.
+ */
+void PrintRenderStats(FILE *output) {
+  const RenderStatTotals TOTALS = GatherRenderStats();
+  const std::vector<RenderPhaseTiming> PHASES = RenderPhases();
+
+  const RenderStatsRegistry &REGISTRY = GetRenderStatsRegistry();
+  const double ELAPSED = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - REGISTRY.start).count();
+  const double CPU = ProcessCpuSeconds() - REGISTRY.startCpu;
+  const uint64_t *V = TOTALS.values;
+  const double TESTS = static_cast<double>(V[STAT_INTERSECTION_TESTS]);
+
+  fprintf(output, "Render stats (%.3f s wall, %.3f s CPU):\n", ELAPSED, CPU);
+  fprintf(output, "  Rays:          %llu primary, %llu shadow, %llu secondary (%.0f rays/s)\n",
+          static_cast<unsigned long long>(V[STAT_PRIMARY_RAYS]),
+          static_cast<unsigned long long>(V[STAT_SHADOW_RAYS]),
+          static_cast<unsigned long long>(V[STAT_SECONDARY_RAYS]),
+          ELAPSED > 0 ? TOTALS.Rays() / ELAPSED : 0.0);
+  fprintf(output, "  Intersections: %llu tests, %llu hits (%.1f%%)\n",
+          static_cast<unsigned long long>(V[STAT_INTERSECTION_TESTS]),
+          static_cast<unsigned long long>(V[STAT_HITS]),
+          TESTS > 0 ? 100.0 * V[STAT_HITS] / TESTS : 0.0);
+  if (REGISTRY.countsHeap) {
+    fprintf(output, "  Heap:          %llu allocations (%.1f MB), %llu for Matrix\n",
+            static_cast<unsigned long long>(V[STAT_HEAP_ALLOCATIONS]),
+            V[STAT_HEAP_BYTES] / (1024.0 * 1024.0),
+            static_cast<unsigned long long>(V[STAT_MATRIX_ALLOCATIONS]));
+  } else {
+    fprintf(output, "  Heap:          not counted, %llu Matrix allocations\n",
+            static_cast<unsigned long long>(V[STAT_MATRIX_ALLOCATIONS]));
+  }
+  fprintf(output, "  Peak memory:   %.1f MB resident\n", PeakResidentBytes() / (1024.0 * 1024.0));
+
+  for (size_t i = 0; i < PHASES.size(); ++i) {
+    const RenderPhaseTiming &PHASE = PHASES[i];
+    fprintf(output, "  %-14s %8.3f s wall %8.3f s CPU %12.0f rays/s\n",
+            (PHASE.name + ":").c_str(), PHASE.wallSeconds, PHASE.cpuSeconds,
+            PHASE.wallSeconds > 0 ? PHASE.rays / PHASE.wallSeconds : 0.0);
+  }
+}
+
+/**
+ * @brief  Writes the statistics as JSON to the file named by the
+ *         RENDER_STATS_JSON environment variable, or prints them to stdout
+ *         if it is not set.
+ * @return bool: False if the JSON file could not be written
+ */
+bool ReportRenderStats() {
+  const char *PATH = getenv("RENDER_STATS_JSON");
+  if (!PATH || !*PATH) {
+    PrintRenderStats(stdout);
+    return true;
+  }
+
+  const std::string JSON = RenderStatsJson();
+  FILE *output = fopen(PATH, "wb");
+  if (!output) {
+    return false;
+  }
+  const bool WRITTEN = fwrite(JSON.data(), 1, JSON.size(), output) == JSON.size();
+  return (fclose(output) == 0) && WRITTEN;
+}
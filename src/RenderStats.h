@@ -0,0 +1,185 @@
+#ifndef __RENDER_STATS_H_
+#define __RENDER_STATS_H_
+/*
+ * RenderStats.h
+ *
+ * Render statistics: rays cast by kind, ray-sphere intersection tests and
+ * hits, heap allocations, peak resident memory, and wall/CPU time spent in
+ * named phases.  ReportRenderStats() prints them at the end of a render, or
+ * writes them as JSON to $RENDER_STATS_JSON if that is set.
+ *
+ * Counters are kept per thread and merged when read, so counting is an
+ * uncontended increment.  Matrix allocations are always counted.  All heap
+ * allocations (std::vector growth included) are only counted in binaries
+ * that link the counting allocator (CountingAllocator.cpp, the
+ * renderer_heap_stats objects), which replaces the global operator new;
+ * other users of the renderer library keep the normal allocator.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include <stdint.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+/**
+ * @brief  Events counted by the render statistics.
+ */
+enum RenderStat {
+  STAT_PRIMARY_RAYS,       // Camera rays (RayForPixel)
+  STAT_SHADOW_RAYS,        // Rays cast towards lights
+  STAT_SECONDARY_RAYS,     // Reflected, refracted, and path tracer bounce rays
+  STAT_INTERSECTION_TESTS, // Ray-sphere intersection tests
+  STAT_HITS,               // Intersection tests that hit the sphere
+  STAT_HEAP_ALLOCATIONS,   // Calls to operator new
+  STAT_HEAP_BYTES,         // Bytes requested from operator new
+  STAT_MATRIX_ALLOCATIONS, // Matrix element buffers allocated
+  NUM_RENDER_STATS
+};
+
+/**
+ * @brief  One thread's counters.  Only the owning thread writes them.
+ */
+struct RenderStatCounters {
+  RenderStatCounters() {
+    for (int i = 0; i < NUM_RENDER_STATS; ++i) {
+      values[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  std::atomic<uint64_t> values[NUM_RENDER_STATS];
+};
+
+/**
+ * @brief  Counters summed over every thread.
+ */
+struct RenderStatTotals {
+  RenderStatTotals() {
+    for (int i = 0; i < NUM_RENDER_STATS; ++i) {
+      values[i] = 0;
+    }
+  }
+
+  uint64_t Rays() const {
+    return values[STAT_PRIMARY_RAYS] + values[STAT_SHADOW_RAYS] + values[STAT_SECONDARY_RAYS];
+  }
+
+  uint64_t values[NUM_RENDER_STATS];
+};
+
+/**
+ * @brief  Time spent in a named phase, summed over every time it ran.
+ */
+struct RenderPhaseTiming {
+  RenderPhaseTiming() : wallSeconds(0), cpuSeconds(0), rays(0) {
+  }
+
+  std::string name;
+
+  // Wall clock time, and CPU time of every thread in the process
+  double wallSeconds, cpuSeconds;
+
+  // Rays cast by every thread while the phase was running
+  uint64_t rays;
+};
+
+/**
+ * @brief  Process wide statistics state.  Never destroyed, so threads that
+ *         start or allocate during static destruction can still count.
+ */
+struct RenderStatsRegistry {
+  RenderStatsRegistry() : countsHeap(false) {
+  }
+
+  /*
+   * Guard threads and phases.  They are separate because allocating while
+   * holding phasesMutex can register the calling thread (through the
+   * counting operator new), which takes threadsMutex.  Nothing allocates a
+   * new thread's counters while holding threadsMutex.
+   */
+  std::mutex threadsMutex;
+  std::vector<RenderStatCounters *> threads;
+  std::mutex phasesMutex;
+  std::vector<RenderPhaseTiming> phases;
+
+  // Whether the counting allocator is linked in
+  bool countsHeap;
+
+  // When the statistics were started or last reset
+  std::chrono::steady_clock::time_point start;
+  double startCpu;
+};
+
+// Per-event counting hook
+#define COUNT_RENDER_STAT(stat, amount) CountRenderStat(stat, amount)
+
+// Function Prototypes
+const char *RenderStatName(const RenderStat);
+double ProcessCpuSeconds();
+RenderStatsRegistry &GetRenderStatsRegistry();
+RenderStatCounters &ThreadRenderStats();
+void CountRenderStat(const RenderStat, const uint64_t);
+RenderStatTotals GatherRenderStats();
+void ResetRenderStats();
+uint64_t PeakResidentBytes();
+std::vector<RenderPhaseTiming> RenderPhases();
+std::string RenderStatsJson();
+void PrintRenderStats(FILE *);
+bool ReportRenderStats();
+
+/**
+ * @brief  Times the rest of the enclosing scope as part of a named phase.
+ *         Phases are meant for coarse stages (scene setup, render, output);
+ *         starting and ending one takes a lock.
+ */
+class RenderStatsPhase {
+public:
+  explicit RenderStatsPhase(const std::string &name) :
+    name_(name),
+    start_(std::chrono::steady_clock::now()),
+    startCpu_(ProcessCpuSeconds()),
+    startRays_(GatherRenderStats().Rays()) {
+  }
+
+  ~RenderStatsPhase() {
+    const double WALL = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    const double CPU  = ProcessCpuSeconds() - startCpu_;
+    const uint64_t RAYS = GatherRenderStats().Rays() - startRays_;
+
+    // Built before locking, so only the vector growth allocates under the lock
+    RenderPhaseTiming entry;
+    entry.name = name_;
+
+    RenderStatsRegistry &registry = GetRenderStatsRegistry();
+    std::lock_guard<std::mutex> lock(registry.phasesMutex);
+    size_t i = 0;
+    while (i < registry.phases.size() && registry.phases[i].name != name_) {
+      ++i;
+    }
+    if (i == registry.phases.size()) {
+      registry.phases.push_back(entry);
+    }
+    registry.phases[i].wallSeconds += WALL;
+    registry.phases[i].cpuSeconds  += CPU;
+    registry.phases[i].rays        += RAYS;
+  }
+
+private:
+  RenderStatsPhase(const RenderStatsPhase &);
+  RenderStatsPhase &operator=(const RenderStatsPhase &);
+
+  const std::string name_;
+  const std::chrono::steady_clock::time_point start_;
+  const double startCpu_;
+  const uint64_t startRays_;
+};
+#endif
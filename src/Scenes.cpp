@@ -0,0 +1,93 @@
+/*
+ * Scenes.cpp
+ *
+ * The named benchmark scenes.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Scenes.h"
+
+/**
+ * @brief  Builds the named scene.  Known scenes:
+ *
+ *         "default"      - the default world (two concentric spheres)
+ *         "glassspheres" - glass and mirrored spheres on a reflective floor
+ *
+ * @return bool: False if the name is not a known scene
+ */
+bool BuildScene(const std::string &name, Scene &scene) {
+  TRACE_SCOPE("BuildScene");
+  scene = Scene();
+
+  if (name == "default") {
+    scene.world = DefaultWorld();
+    return true;
+  }
+
+  if (name == "glassspheres") {
+    World &world = scene.world;
+    world.AddLight(PointLight(Point(-10, 10, -10), Color(1, 1, 1)));
+
+    // Follow at most 6 bounces; drop rays contributing less than 0.5% of a pixel
+    world.SetMaxDepth(6);
+    world.SetMinContribution(0.005);
+
+    // The floor is a very flat sphere
+    Sphere floor;
+    floor.SetTransform(Scaling(10, 0.01, 10));
+    Material floorMat;
+    floorMat.SetColor(Color(1, 0.9, 0.9));
+    floorMat.SetSpecular(0);
+    floorMat.SetReflective(0.2);
+    floor.SetMaterial(floorMat);
+    world.AddObject(floor);
+
+    // Glass sphere in the middle
+    Sphere glass;
+    glass.SetTransform(Translation(-0.5, 1, 0.5));
+    Material glassMat;
+    glassMat.SetColor(Color(0.1, 0.1, 0.1));
+    glassMat.SetDiffuse(0.1);
+    glassMat.SetShininess(300);
+    glassMat.SetReflective(0.9);
+    glassMat.SetTransparency(0.9);
+    glassMat.SetRefractiveIndex(1.5);
+    glass.SetMaterial(glassMat);
+    world.AddObject(glass);
+
+    // Mirrored sphere on the right
+    Sphere mirror;
+    mirror.SetTransform(Translation(1.5, 0.5, -0.5) * Scaling(0.5, 0.5, 0.5));
+    Material mirrorMat;
+    mirrorMat.SetColor(Color(0.2, 0.2, 0.2));
+    mirrorMat.SetReflective(0.8);
+    mirror.SetMaterial(mirrorMat);
+    world.AddObject(mirror);
+
+    // Matte sphere behind the glass sphere so refraction is visible
+    Sphere matte;
+    matte.SetTransform(Translation(-1.5, 0.33, 2.5) * Scaling(0.33, 0.33, 0.33));
+    Material matteMat;
+    matteMat.SetColor(Color(1, 0.8, 0.1));
+    matteMat.SetDiffuse(0.7);
+    matteMat.SetSpecular(0.3);
+    matte.SetMaterial(matteMat);
+    world.AddObject(matte);
+
+    scene.from = Point(0, 1.5, -5);
+    scene.to   = Point(0, 1, 0);
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief  Constructs a camera of the given size looking at the scene.
+ */
+Camera SceneCamera(const Scene &scene, const int width, const int height) {
+  Camera camera(width, height, scene.fov);
+  camera.SetTransform(ViewTransform(scene.from, scene.to, scene.up));
+  return camera;
+}
@@ -0,0 +1,68 @@
+#ifndef __SCENES_H_
+#define __SCENES_H_
+/*
+ * Scenes.h
+ *
+ * Built-in scenes shared by the applications, looked up by name.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "Transformations.h"
+#include "World.h"
+#include "Camera.h"
+#include "FrameTrace.h"
+
+#include <cmath> // M_PI
+#include <map>
+#include <string>
+
+/**
+ * @brief  A world plus where to look at it from.
+ */
+struct Scene {
+  Scene() : from(Point(0, 0, -5)), to(Point(0, 0, 0)), up(Vector(0, 1, 0)), fov(M_PI/3) {
+  }
+
+  World world;
+
+  // Camera placement and field of view (in radians)
+  Tuple from, to, up;
+  float fov;
+};
+
+// Function Prototypes
+bool BuildScene(const std::string &, Scene &);
+Camera SceneCamera(const Scene &, const int, const int);
+
+/**
+ * @brief  Builds scenes on first use and keeps them for later lookups.
+ */
+class SceneCache {
+public:
+  /**
+   * @brief Looks up a scene, building it if this is the first request.
+   * @return const Scene *: The scene, or NULL if the name is unknown
+   */
+  const Scene *Find(const std::string &name) {
+    std::map<std::string, Scene>::iterator found = scenes_.find(name);
+    if (found != scenes_.end()) {
+      return &found->second;
+    }
+
+    Scene scene;
+    if (!BuildScene(name, scene)) {
+      return NULL;
+    }
+    return &(scenes_[name] = scene);
+  }
+
+  // Accessor functions
+  int Size() const { return static_cast<int>(scenes_.size()); }
+
+private:
+  // Scenes built so far, by name
+  std::map<std::string, Scene> scenes_;
+};
+#endif
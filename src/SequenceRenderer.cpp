@@ -0,0 +1,42 @@
+/*
+ * SequenceRenderer.cpp
+ *
+ * Frame naming and output for sequence rendering.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "SequenceRenderer.h"
+
+/**
+ * @brief  Computes the animation time of a frame.  Frames are spread evenly
+ *         from startTime to endTime inclusive.
+ */
+float FrameTime(const SequenceOptions &options, const int frame) {
+  if (options.frames <= 1) {
+    return options.startTime;
+  }
+  return options.startTime +
+         (options.endTime - options.startTime) * frame / (options.frames - 1);
+}
+
+/**
+ * @brief  Formats the file name of a frame.
+ * @param pattern: printf pattern for the file name, given the frame number
+ *                 (e.g. "frame_%04d.ppm")
+ */
+std::string FrameFilename(const std::string &pattern, const int frame) {
+  char filename[1024];
+  snprintf(filename, sizeof(filename), pattern.c_str(), frame);
+  return filename;
+}
+
+/**
+ * @brief  Creates a sink that writes each frame to a PPM file on the
+ *         output stage's thread.
+ */
+FrameSink PPMFrameSink(const std::string &pattern) {
+  return [pattern](const int frame, const Canvas &canvas) {
+    canvas.WriteToPPM(FrameFilename(pattern, frame).c_str());
+  };
+}
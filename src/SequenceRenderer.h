@@ -0,0 +1,278 @@
+#ifndef __SEQUENCE_RENDERER_H_
+#define __SEQUENCE_RENDERER_H_
+/*
+ * SequenceRenderer.h
+ *
+ * Renders an animated sequence of frames as a three stage pipeline:
+ *
+ * 1) Setup: copies the world and poses it for frame N+1.
+ * 2) Trace: renders frame N on the tile scheduler.
+ * 3) Output: hands frame N-1 to a frame sink, or to an AsyncImageWriter
+ *    that writes it to disk.
+ *
+ * The stages run concurrently and are connected by bounded queues, so the
+ * setup and output stages work ahead/behind the tracer without buffering
+ * more than a few frames.  Throughput approaches that of tracing alone.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Color.h"
+#include "Canvas.h"
+#include "Camera.h"
+#include "World.h"
+#include "Animation.h"
+#include "AsyncImageWriter.h"
+#include "BoundedQueue.h"
+#include "TileScheduler.h"
+#include "FrameTrace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief  Sequence rendering settings
+ */
+struct SequenceOptions {
+  SequenceOptions() : frames(24), startTime(0.0), endTime(1.0), tileSize(16), queueDepth(2) {
+  }
+
+  int frames;
+
+  // Animation time of the first and last frames
+  float startTime, endTime;
+
+  // Edge length of a tile in pixels
+  int tileSize;
+
+  // Frames each queue holds before the stage feeding it waits
+  int queueDepth;
+};
+
+/**
+ * @brief  Time spent in each stage of a sequence render.
+ */
+struct SequenceStats {
+  SequenceStats() :
+    frames(0), seconds(0), setupSeconds(0), traceSeconds(0), outputSeconds(0),
+    outputWaitSeconds(0) {
+  }
+
+  int frames;
+
+  // Wall clock time for the whole sequence
+  double seconds;
+
+  // Busy time of each stage (output time is not known when using an AsyncImageWriter)
+  double setupSeconds, traceSeconds, outputSeconds;
+
+  // Time the trace stage spent waiting for the output stage to catch up
+  double outputWaitSeconds;
+
+  double FramesPerSecond() const { return (seconds > 0) ? frames / seconds : 0.0; }
+
+  // Fraction of the wall clock time spent tracing (1.0 = fully overlapped)
+  double TraceFraction() const { return (seconds > 0) ? traceSeconds / seconds : 0.0; }
+};
+
+/*
+ * Receives each finished frame, in order, on the output stage's thread.
+ * The first argument is the frame number.
+ */
+typedef std::function<void(const int, const Canvas &)> FrameSink;
+
+// Function Prototypes
+float FrameTime(const SequenceOptions &, const int);
+std::string FrameFilename(const std::string &, const int);
+FrameSink PPMFrameSink(const std::string &);
+
+/**
+ * @brief  SequenceRenderer class
+ */
+class SequenceRenderer {
+public:
+  /**
+   * @brief Constructor.  The world, animation, and scheduler must outlive the
+   *        renderer.  The world is copied for every frame, never modified.
+   */
+  SequenceRenderer(const World &world, const Animation &animation, const Camera &camera,
+                   TileScheduler &scheduler, const SequenceOptions &options = SequenceOptions()) :
+    world_(world),
+    animation_(animation),
+    camera_(camera),
+    scheduler_(scheduler),
+    options_(options),
+    tiles_(MakeTiles(camera.HSize(), camera.VSize(), std::max(1, options.tileSize))) {
+  }
+
+  /**
+   * @brief Destructor
+   */
+  ~SequenceRenderer() {
+  }
+
+  /**
+   * @brief Renders every frame of the sequence, passing each to the sink.
+   *        Returns once the sink has received the last frame.
+   */
+  SequenceStats Render(const FrameSink &sink) {
+    const std::chrono::steady_clock::time_point START = std::chrono::steady_clock::now();
+
+    SequenceStats stats;
+    BoundedQueue<std::unique_ptr<PosedFrame> > posed(options_.queueDepth);
+    BoundedQueue<std::unique_ptr<TracedFrame> > traced(options_.queueDepth);
+    std::thread setup(&SequenceRenderer::PoseFrames, this, std::ref(posed),
+                      std::ref(stats.setupSeconds));
+
+    // Output stage: hand finished frames to the sink behind the tracer
+    std::thread output([&]() {
+      std::unique_ptr<TracedFrame> frame;
+      while (traced.Pop(frame)) {
+        const std::chrono::steady_clock::time_point BEGIN = std::chrono::steady_clock::now();
+        sink(frame->index, *frame->canvas);
+        stats.outputSeconds += Seconds(BEGIN);
+      }
+    });
+
+    // Trace stage, on this thread plus the scheduler's workers
+    std::unique_ptr<PosedFrame> frame;
+    while (posed.Pop(frame)) {
+      std::unique_ptr<TracedFrame> result(new TracedFrame(frame->index, camera_));
+      TraceFrame(frame->world, *result->canvas, stats);
+
+      const std::chrono::steady_clock::time_point BEGIN = std::chrono::steady_clock::now();
+      traced.Push(std::move(result));
+      stats.outputWaitSeconds += Seconds(BEGIN);
+    }
+    traced.Close();
+
+    setup.join();
+    output.join();
+
+    stats.seconds = Seconds(START);
+    return stats;
+  }
+
+  /**
+   * @brief Renders every frame of the sequence into the writer's buffers and
+   *        submits each as a PPM file.  Returns once every file is written.
+   * @param pattern: printf pattern for the file names (see FrameFilename())
+   * @param success: Set to false if any file could not be written
+   */
+  SequenceStats Render(AsyncImageWriter &writer, const std::string &pattern, bool &success) {
+    const std::chrono::steady_clock::time_point START = std::chrono::steady_clock::now();
+
+    SequenceStats stats;
+    BoundedQueue<std::unique_ptr<PosedFrame> > posed(options_.queueDepth);
+    std::thread setup(&SequenceRenderer::PoseFrames, this, std::ref(posed),
+                      std::ref(stats.setupSeconds));
+
+    std::unique_ptr<PosedFrame> frame;
+    while (posed.Pop(frame)) {
+      std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+      Canvas *buffer = writer.Acquire();
+      stats.outputWaitSeconds += Seconds(begin);
+
+      TraceFrame(frame->world, *buffer, stats);
+      writer.Submit(buffer, FrameFilename(pattern, frame->index));
+    }
+    setup.join();
+
+    const std::chrono::steady_clock::time_point FLUSH = std::chrono::steady_clock::now();
+    success = writer.Flush();
+    stats.outputWaitSeconds += Seconds(FLUSH);
+
+    stats.seconds = Seconds(START);
+    return stats;
+  }
+
+private:
+  /**
+   * @brief  A world posed for one frame.
+   */
+  struct PosedFrame {
+    PosedFrame(const int frame, const World &base) : index(frame), world(base) {
+    }
+
+    int index;
+    World world;
+  };
+
+  /**
+   * @brief  A traced frame waiting for output.
+   */
+  struct TracedFrame {
+    TracedFrame(const int frame, const Camera &camera) :
+      index(frame), canvas(new Canvas(camera.HSize(), camera.VSize())) {
+    }
+
+    int index;
+    std::unique_ptr<Canvas> canvas;
+  };
+
+  /**
+   * @brief Setup stage: poses a copy of the world for each frame, ahead of
+   *        the tracer.
+   */
+  void PoseFrames(BoundedQueue<std::unique_ptr<PosedFrame> > &posed, double &seconds) {
+    SetTraceThreadName("SequenceRenderer setup");
+    for (int frame = 0; frame < options_.frames; ++frame) {
+      const std::chrono::steady_clock::time_point BEGIN = std::chrono::steady_clock::now();
+      std::unique_ptr<PosedFrame> next;
+      {
+        TRACE_SCOPE("PoseFrame");
+        next.reset(new PosedFrame(frame, world_));
+        animation_.Apply(next->world, FrameTime(options_, frame));
+      }
+      seconds += Seconds(BEGIN);
+
+      if (!posed.Push(std::move(next))) {
+        break;
+      }
+    }
+    posed.Close();
+  }
+
+  /**
+   * @brief Trace stage: renders one posed world onto the canvas.
+   */
+  void TraceFrame(const World &world, Canvas &canvas, SequenceStats &stats) {
+    TRACE_SCOPE("TraceFrame");
+    const std::chrono::steady_clock::time_point BEGIN = std::chrono::steady_clock::now();
+
+    scheduler_.Run(tiles_, [&](const Tile &tile, const int) {
+      for (int y = tile.y0; y < tile.y1; ++y) {
+        for (int x = tile.x0; x < tile.x1; ++x) {
+          canvas.WritePixel(x, y, ColorAt(world, RayForPixel(camera_, x, y)));
+        }
+      }
+    });
+
+    stats.traceSeconds += Seconds(BEGIN);
+    ++stats.frames;
+  }
+
+  /**
+   * @brief Seconds elapsed since the given time.
+   */
+  static double Seconds(const std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - since).count();
+  }
+
+  // The renderer keeps references to shared state, so it cannot be copied
+  SequenceRenderer(const SequenceRenderer &);
+  SequenceRenderer &operator=(const SequenceRenderer &);
+
+  const World &world_;
+  const Animation &animation_;
+  Camera camera_;
+  TileScheduler &scheduler_;
+  SequenceOptions options_;
+  std::vector<Tile> tiles_;
+};
+#endif
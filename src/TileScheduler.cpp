@@ -0,0 +1,56 @@
+/*
+ * TileScheduler.cpp
+ *
+ * Splitting an image into tiles and bands.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "TileScheduler.h"
+
+/**
+ * @brief  Splits a width x height canvas into tiles of tileSize x tileSize
+ *         pixels in scanline order.  Tiles along the right/bottom edges are
+ *         clipped to the canvas.  A tileSize below 1 yields no tiles.
+ */
+std::vector<Tile> MakeTiles(const int width, const int height, const int tileSize) {
+  std::vector<Tile> tiles;
+  if (tileSize <= 0) {
+    return tiles;
+  }
+  for (int y = 0; y < height; y += tileSize) {
+    for (int x = 0; x < width; x += tileSize) {
+      Tile tile;
+      tile.x0    = x;
+      tile.y0    = y;
+      tile.x1    = std::min(x + tileSize, width);
+      tile.y1    = std::min(y + tileSize, height);
+      tile.index = static_cast<int>(tiles.size());
+      tiles.push_back(tile);
+    }
+  }
+  return tiles;
+}
+
+/**
+ * @brief  Splits a width x height canvas into full width bands of rows
+ *         scanlines each, top to bottom.  The last band is clipped to the
+ *         canvas.  Bands suit passes over contiguous rows of pixels.  A rows
+ *         value below 1 yields no bands.
+ */
+std::vector<Tile> MakeBands(const int width, const int height, const int rows) {
+  std::vector<Tile> bands;
+  if (rows <= 0) {
+    return bands;
+  }
+  for (int y = 0; y < height; y += rows) {
+    Tile band;
+    band.x0    = 0;
+    band.y0    = y;
+    band.x1    = width;
+    band.y1    = std::min(y + rows, height);
+    band.index = static_cast<int>(bands.size());
+    bands.push_back(band);
+  }
+  return bands;
+}
@@ -0,0 +1,222 @@
+#ifndef __TILE_SCHEDULER_H_
+#define __TILE_SCHEDULER_H_
+/*
+ * TileScheduler.h
+ *
+ * Splits a canvas into rectangular tiles and renders them on a pool of
+ * persistent worker threads.  Workers pull tiles from a shared atomic
+ * counter, so faster threads naturally pick up more of the frame.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "FrameTrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief  A rectangular region of the canvas: [x0, x1) x [y0, y1).
+ */
+struct Tile {
+  int x0, y0, x1, y1;
+
+  // Position of this tile in the list of tiles it was generated in
+  int index;
+};
+
+/*
+ * Function executed for each tile.  The second argument is the index
+ * (0 to NumThreads()-1) of the worker thread running the tile, which can be
+ * used to look up per-thread state without locking.
+ */
+typedef std::function<void(const Tile &, const int)> TileFunction;
+
+// Function Prototypes
+std::vector<Tile> MakeTiles(const int, const int, const int);
+std::vector<Tile> MakeBands(const int, const int, const int);
+
+/**
+ * @brief  TileScheduler class
+ */
+class TileScheduler {
+public:
+  /**
+   * @brief Constructor.  Starts the worker threads.
+   * @param numThreads: Number of worker threads.  0 uses one per hardware thread.
+   */
+  explicit TileScheduler(const int numThreads = 0) :
+    tiles_(NULL),
+    function_(NULL),
+    hasDeadline_(false),
+    nextTile_(0),
+    completedTiles_(0),
+    busyWorkers_(0),
+    generation_(0),
+    shutdown_(false) {
+    int count = numThreads;
+    if (count <= 0) {
+      count = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (int i = 0; i < count; ++i) {
+      workers_.push_back(std::thread(&TileScheduler::WorkerLoop, this, i));
+    }
+  }
+
+  /**
+   * @brief Destructor.  Stops and joins the worker threads.
+   */
+  ~TileScheduler() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shutdown_ = true;
+    }
+    wake_.notify_all();
+
+    for (size_t i = 0; i < workers_.size(); ++i) {
+      workers_[i].join();
+    }
+  }
+
+  /**
+   * @brief Runs fn over every tile and blocks until all tiles are finished.
+   *        Must not be called concurrently from multiple threads.
+   */
+  void Run(const std::vector<Tile> &tiles, const TileFunction &fn) {
+    Dispatch(tiles, fn, false, std::chrono::steady_clock::time_point());
+  }
+
+  /**
+   * @brief Runs fn over the tiles until either every tile is finished or the
+   *        deadline passes.  Tiles that have already started are always
+   *        finished; no new tiles are started after the deadline.
+   * @return bool: True if every tile was run
+   */
+  bool RunUntil(const std::vector<Tile> &tiles, const TileFunction &fn,
+                const std::chrono::steady_clock::time_point deadline) {
+    return Dispatch(tiles, fn, true, deadline) == tiles.size();
+  }
+
+  // Accessor functions
+  int NumThreads() const { return static_cast<int>(workers_.size()); }
+
+private:
+  // The scheduler owns threads, so it cannot be copied
+  TileScheduler(const TileScheduler &);
+  TileScheduler &operator=(const TileScheduler &);
+
+  /**
+   * @brief Posts a job to the workers and blocks until they are finished.
+   * @return size_t: Number of tiles that were run
+   */
+  size_t Dispatch(const std::vector<Tile> &tiles, const TileFunction &fn,
+                  const bool hasDeadline,
+                  const std::chrono::steady_clock::time_point deadline) {
+    if (tiles.empty()) {
+      return 0;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    tiles_          = &tiles;
+    function_       = &fn;
+    hasDeadline_    = hasDeadline;
+    deadline_       = deadline;
+    nextTile_       = 0;
+    completedTiles_ = 0;
+    busyWorkers_    = static_cast<int>(workers_.size());
+    ++generation_;
+    wake_.notify_all();
+
+    // Wait for every worker to run out of tiles
+    done_.wait(lock, [this] { return busyWorkers_ == 0; });
+    tiles_    = NULL;
+    function_ = NULL;
+
+    return completedTiles_;
+  }
+
+  /**
+   * @brief Body of each worker thread.  Sleeps until a job is posted, then
+   *        claims tiles until none are left.
+   */
+  void WorkerLoop(const int threadIndex) {
+    SetTraceThreadName("TileScheduler worker " + std::to_string(threadIndex));
+    unsigned int seenGeneration = 0;
+
+    while (true) {
+      const std::vector<Tile> *tiles = NULL;
+      const TileFunction *fn = NULL;
+      bool hasDeadline = false;
+      std::chrono::steady_clock::time_point deadline;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [&] { return shutdown_ || generation_ != seenGeneration; });
+        if (shutdown_) {
+          return;
+        }
+        seenGeneration = generation_;
+        tiles       = tiles_;
+        fn          = function_;
+        hasDeadline = hasDeadline_;
+        deadline    = deadline_;
+      }
+
+      // Claim tiles until the job is exhausted or out of time
+      while (!hasDeadline || std::chrono::steady_clock::now() < deadline) {
+        const size_t NEXT = nextTile_.fetch_add(1);
+        if (NEXT >= tiles->size()) {
+          break;
+        }
+        {
+          TRACE_SCOPE("Tile");
+          (*fn)((*tiles)[NEXT], threadIndex);
+        }
+        ++completedTiles_;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --busyWorkers_;
+        if (busyWorkers_ == 0) {
+          done_.notify_all();
+        }
+      }
+    }
+  }
+
+  // Worker threads
+  std::vector<std::thread> workers_;
+
+  // Synchronizes job hand-off between Run() and the workers
+  std::mutex mutex_;
+  std::condition_variable wake_, done_;
+
+  // Current job.  Only valid while Run() is executing.
+  const std::vector<Tile> *tiles_;
+  const TileFunction *function_;
+
+  // Optional time after which no new tiles are started
+  bool hasDeadline_;
+  std::chrono::steady_clock::time_point deadline_;
+
+  // Index of the next unclaimed tile and the number of finished tiles
+  std::atomic<size_t> nextTile_, completedTiles_;
+
+  // Number of workers that have not yet finished the current job
+  int busyWorkers_;
+
+  // Incremented each time a job is posted so that workers can detect it
+  unsigned int generation_;
+
+  // Set by the destructor to stop the workers
+  bool shutdown_;
+};
+#endif
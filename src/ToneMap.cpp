@@ -0,0 +1,225 @@
+/*
+ * ToneMap.cpp
+ *
+ * Tone curves and conversion of HDR canvases to 8-bit images.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "ToneMap.h"
+
+/**
+ * @brief  Applies a tone curve to one channel.  The result is in [0, 1].
+ */
+float ApplyToneCurve(const float value, const ToneCurve curve) {
+  const float V = std::max(value, 0.0f);
+  float mapped = V;
+  if (curve == TONE_REINHARD) {
+    mapped = V / (1.0f + V);
+  } else if (curve == TONE_ACES) {
+    mapped = (V * (2.51f * V + 0.03f)) / (V * (2.43f * V + 0.59f) + 0.14f);
+  }
+  return std::min(mapped, 1.0f);
+}
+
+/**
+ * @brief  The exact sRGB transfer function for a value in [0, 1].
+ */
+float SrgbEncode(const float value) {
+  if (value <= 0.0031308f) {
+    return 12.92f * value;
+  }
+  return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+/**
+ * @brief  Offset added to a scaled value before truncating it to 8 bits:
+ *         the 4x4 Bayer threshold of the pixel, or 0.5 (rounding) without
+ *         dithering.
+ */
+float DitherOffset(const int x, const int y, const bool dither) {
+  static const int BAYER[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+  };
+  return dither ? (BAYER[y & 3][x & 3] + 0.5f) / 16.0f : 0.5f;
+}
+
+/**
+ * @brief  Maps one channel of pixel (x, y) with the exact sRGB curve.  This
+ *         is the reference the vectorized pass is checked against.
+ */
+uint8_t ToneMapValue(const float value, const int x, const int y,
+                     const ToneMapOptions &options) {
+  float mapped = ApplyToneCurve(value * std::exp2(options.exposure), options.curve);
+  if (options.srgb) {
+    mapped = SrgbEncode(mapped);
+  }
+  const float SCALED = mapped * 255.0f + DitherOffset(x, y, options.dither);
+  return static_cast<uint8_t>(std::min(std::max(SCALED, 0.0f), 255.0f));
+}
+
+#ifdef __SSE2__
+/**
+ * @brief  ApplyToneCurve() on four values.
+ */
+__m128 ApplyToneCurve4(const __m128 value, const ToneCurve curve) {
+  const __m128 ZERO = _mm_setzero_ps();
+  const __m128 ONE  = _mm_set1_ps(1.0f);
+  const __m128 V = _mm_max_ps(value, ZERO);
+
+  __m128 mapped = V;
+  if (curve == TONE_REINHARD) {
+    mapped = _mm_div_ps(V, _mm_add_ps(ONE, V));
+  } else if (curve == TONE_ACES) {
+    const __m128 NUMERATOR = _mm_mul_ps(V, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.51f), V),
+                                                      _mm_set1_ps(0.03f)));
+    const __m128 DENOMINATOR = _mm_add_ps(_mm_mul_ps(V, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.43f), V),
+                                                                   _mm_set1_ps(0.59f))),
+                                          _mm_set1_ps(0.14f));
+    mapped = _mm_div_ps(NUMERATOR, DENOMINATOR);
+  }
+  return _mm_min_ps(mapped, ONE);
+}
+
+/**
+ * @brief  Approximate sRGB transfer function on four values in [0, 1]:
+ *         x^(1/2.4) is fitted with the 2nd, 4th, and 8th roots of x.
+ */
+__m128 SrgbEncode4(const __m128 value) {
+  const __m128 ROOT2 = _mm_sqrt_ps(value);
+  const __m128 ROOT4 = _mm_sqrt_ps(ROOT2);
+  const __m128 ROOT8 = _mm_sqrt_ps(ROOT4);
+  const __m128 CURVE = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(0.585122381f), ROOT2),
+                                             _mm_mul_ps(_mm_set1_ps(0.783140355f), ROOT4)),
+                                  _mm_mul_ps(_mm_set1_ps(0.368262736f), ROOT8));
+  const __m128 LINEAR = _mm_mul_ps(_mm_set1_ps(12.92f), value);
+
+  // Select the linear segment near black
+  const __m128 DARK = _mm_cmple_ps(value, _mm_set1_ps(0.0031308f));
+  return _mm_or_ps(_mm_and_ps(DARK, LINEAR), _mm_andnot_ps(DARK, CURVE));
+}
+#endif
+
+/**
+ * @brief  Maps one row of pixels to 8 bit RGB.
+ * @param row: width pixels of row y
+ * @param out: Receives 3 * width bytes
+ */
+void ToneMapRow(const Color *row, const int width, const int y,
+                const ToneMapOptions &options, uint8_t *out) {
+#ifdef __SSE2__
+  const __m128 SCALE = _mm_set1_ps(std::exp2(options.exposure));
+  const __m128 MAX_CODE = _mm_set1_ps(255.0f);
+
+  // The dither pattern repeats every 4 pixels along the row
+  __m128 dither[4];
+  for (int i = 0; i < 4; ++i) {
+    dither[i] = _mm_set1_ps(DitherOffset(i, y, options.dither));
+  }
+  const __m128 DITHER_GROUP = _mm_setr_ps(DitherOffset(0, y, options.dither),
+                                          DitherOffset(1, y, options.dither),
+                                          DitherOffset(2, y, options.dither),
+                                          DitherOffset(3, y, options.dither));
+
+  /*
+   * Each Color is 4 packed floats: R, G, B, and w (ignored).  This layout is
+   * load-bearing: the loads below read Colors as raw floats, so a change to
+   * Tuple's members or their order breaks tone mapping.
+   */
+  static_assert(sizeof(Color) == 4 * sizeof(float),
+                "ToneMapRow() requires Color to be exactly 4 packed floats");
+  const float *pixels = reinterpret_cast<const float *>(row);
+  int x = 0;
+  for (; x + 4 <= width; x += 4) {
+    // Transpose 4 pixels into vectors of reds, greens, and blues so every
+    // lane does useful work
+    __m128 red   = _mm_loadu_ps(pixels + 4 * x);
+    __m128 green = _mm_loadu_ps(pixels + 4 * x + 4);
+    __m128 blue  = _mm_loadu_ps(pixels + 4 * x + 8);
+    __m128 w     = _mm_loadu_ps(pixels + 4 * x + 12);
+    _MM_TRANSPOSE4_PS(red, green, blue, w);
+
+    __m128 channels[3] = {red, green, blue};
+    __m128i codes[3];
+    for (int c = 0; c < 3; ++c) {
+      __m128 v = ApplyToneCurve4(_mm_mul_ps(channels[c], SCALE), options.curve);
+      if (options.srgb) {
+        v = SrgbEncode4(v);
+      }
+      codes[c] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(v, MAX_CODE), DITHER_GROUP));
+    }
+
+    // Saturate to bytes (RRRR GGGG BBBB) and interleave
+    uint8_t packed[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(packed),
+                     _mm_packus_epi16(_mm_packs_epi32(codes[0], codes[1]),
+                                      _mm_packs_epi32(codes[2], _mm_setzero_si128())));
+    for (int i = 0; i < 4; ++i) {
+      out[3 * (x + i)]     = packed[i];
+      out[3 * (x + i) + 1] = packed[4 + i];
+      out[3 * (x + i) + 2] = packed[8 + i];
+    }
+  }
+
+  // Leftover pixels
+  for (; x < width; ++x) {
+    __m128 v = ApplyToneCurve4(_mm_mul_ps(_mm_loadu_ps(pixels + 4 * x), SCALE), options.curve);
+    if (options.srgb) {
+      v = SrgbEncode4(v);
+    }
+    float mapped[4];
+    _mm_storeu_ps(mapped, _mm_min_ps(_mm_add_ps(_mm_mul_ps(v, MAX_CODE), dither[x & 3]),
+                                     MAX_CODE));
+    out[3 * x]     = static_cast<uint8_t>(mapped[0]);
+    out[3 * x + 1] = static_cast<uint8_t>(mapped[1]);
+    out[3 * x + 2] = static_cast<uint8_t>(mapped[2]);
+  }
+#else
+  for (int x = 0; x < width; ++x) {
+    out[3 * x]     = ToneMapValue(row[x].Red(), x, y, options);
+    out[3 * x + 1] = ToneMapValue(row[x].Green(), x, y, options);
+    out[3 * x + 2] = ToneMapValue(row[x].Blue(), x, y, options);
+  }
+#endif
+}
+
+/**
+ * @brief  Tone maps a whole canvas into an 8 bit image, one band of rows
+ *         per scheduler task.
+ */
+void ToneMap(const Canvas &canvas, const ToneMapOptions &options,
+             TileScheduler &scheduler, DisplayImage &image) {
+  TRACE_SCOPE("ToneMap");
+  image.width  = canvas.GetWidth();
+  image.height = canvas.GetHeight();
+  image.rgb.resize(static_cast<size_t>(image.width) * image.height * 3);
+
+  const std::vector<Tile> BANDS = MakeBands(image.width, image.height,
+                                            std::max(1, options.bandHeight));
+  scheduler.Run(BANDS, [&](const Tile &band, const int) {
+    for (int y = band.y0; y < band.y1; ++y) {
+      ToneMapRow(canvas.Row(y), image.width, y, options,
+                 &image.rgb[static_cast<size_t>(y) * image.width * 3]);
+    }
+  });
+}
+
+/**
+ * @brief  Writes an 8 bit image as a binary (P6) PPM file.
+ * @return bool: False if the file could not be written
+ */
+bool WriteDisplayPPM(const DisplayImage &image, const std::string &filename) {
+  TRACE_SCOPE("WriteDisplayPPM");
+  FILE *output = fopen(filename.c_str(), "wb");
+  if (!output) {
+    return false;
+  }
+
+  fprintf(output, "P6\n%d %d\n255\n", image.width, image.height);
+  const bool WRITTEN = image.rgb.empty() ||
+                       fwrite(image.rgb.data(), 1, image.rgb.size(), output) == image.rgb.size();
+  return (fclose(output) == 0) && WRITTEN;
+}
@@ -0,0 +1,92 @@
+#ifndef __TONE_MAP_H_
+#define __TONE_MAP_H_
+/*
+ * ToneMap.h
+ *
+ * Converts a linear, high dynamic range canvas into a displayable 8 bit
+ * sRGB image: exposure, a tone curve that rolls highlights off instead of
+ * clipping them, the sRGB transfer function, and an ordered dither, then
+ * quantization.
+ *
+ * The canvas rows are contiguous arrays of four float pixels (R, G, B, and
+ * an unused w).  The pass loads four pixels at a time and transposes them
+ * into SSE registers of reds, greens, and blues.  The sRGB curve uses a
+ * square root based approximation (within half a code value of the exact
+ * curve) instead of pow().  The canvas is split into bands of rows that are
+ * mapped in parallel on the tile scheduler.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Color.h"
+#include "Canvas.h"
+#include "TileScheduler.h"
+#include "FrameTrace.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief  Curves mapping scene brightness to display brightness.
+ */
+enum ToneCurve {
+  TONE_CLAMP,    // Clip to [0, 1] (what WriteToPPM() does)
+  TONE_REINHARD, // x / (1 + x)
+  TONE_ACES      // Filmic fit of the ACES reference rendering transform
+};
+
+/**
+ * @brief  Tone mapping settings
+ */
+struct ToneMapOptions {
+  ToneMapOptions() :
+    exposure(0.0f), curve(TONE_ACES), srgb(true), dither(true), bandHeight(16) {
+  }
+
+  // Exposure adjustment in stops (each stop doubles the brightness)
+  float exposure;
+
+  ToneCurve curve;
+
+  // Apply the sRGB transfer function; otherwise values are quantized linearly
+  bool srgb;
+
+  // Add a 4x4 ordered dither before quantizing to hide banding in gradients
+  bool dither;
+
+  // Rows per band mapped by each scheduler task
+  int bandHeight;
+};
+
+/**
+ * @brief  An 8 bit RGB image, 3 bytes per pixel in scanline order.
+ */
+struct DisplayImage {
+  DisplayImage() : width(0), height(0) {
+  }
+
+  int width, height;
+  std::vector<uint8_t> rgb;
+};
+
+// Function Prototypes
+float ApplyToneCurve(const float, const ToneCurve);
+float SrgbEncode(const float);
+float DitherOffset(const int, const int, const bool);
+uint8_t ToneMapValue(const float, const int, const int, const ToneMapOptions &);
+void ToneMapRow(const Color *, const int, const int, const ToneMapOptions &, uint8_t *);
+void ToneMap(const Canvas &, const ToneMapOptions &, TileScheduler &, DisplayImage &);
+bool WriteDisplayPPM(const DisplayImage &, const std::string &);
+#ifdef __SSE2__
+__m128 ApplyToneCurve4(const __m128, const ToneCurve);
+__m128 SrgbEncode4(const __m128);
+#endif
+#endif
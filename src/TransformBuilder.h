@@ -0,0 +1,109 @@
+#ifndef __TRANSFORM_BUILDER_H_
+#define __TRANSFORM_BUILDER_H_
+/*
+ * TransformBuilder.h
+ *
+ * Chainable transform construction that keeps the inverse alongside the
+ * forward transform:
+ *
+ *   sphere.SetTransform(TransformBuilder().RotX(M_PI / 2)
+ *                                         .Scale(5, 5, 5)
+ *                                         .Translate(10, 5, 7));
+ *
+ * Steps apply in the order they are written (rotate, then scale, then
+ * translate), so the forward transform is Translation * Scaling * RotX.
+ * Each step's inverse is known in closed form (negated translation,
+ * reciprocal scale, transposed rotation), so the inverse is composed step
+ * by step in the opposite order and never has to be computed from the
+ * finished matrix.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "AffineTransform.h"
+#include "FixedMatrix.h"
+#include "Transformations.h"
+
+class TransformBuilder {
+public:
+  /**
+   * @brief  Starts from the identity transform.
+   */
+  constexpr TransformBuilder() : forward_(), inverse_() {
+  }
+
+  /**
+   * @brief  Translates by (x, y, z).
+   */
+  constexpr TransformBuilder Translate(const float x, const float y, const float z) const {
+    return Then(ToAffine(Translation(x, y, z)), ToAffine(Translation(-x, -y, -z)));
+  }
+
+  /**
+   * @brief  Scales by (x, y, z).  None of the factors may be zero.
+   */
+  constexpr TransformBuilder Scale(const float x, const float y, const float z) const {
+    return Then(ToAffine(Scaling(x, y, z)), ToAffine(Scaling(1 / x, 1 / y, 1 / z)));
+  }
+
+  /**
+   * @brief  Rotates by theta radians around the X, Y, or Z axis.
+   */
+  constexpr TransformBuilder RotX(const float theta) const {
+    return ThenRotation(ToAffine(::RotX(theta)));
+  }
+
+  constexpr TransformBuilder RotY(const float theta) const {
+    return ThenRotation(ToAffine(::RotY(theta)));
+  }
+
+  constexpr TransformBuilder RotZ(const float theta) const {
+    return ThenRotation(ToAffine(::RotZ(theta)));
+  }
+
+  /**
+   * @brief  Shears (see Shearing()).  A general shear has no simpler
+   *         inverse, so this step's 3x3 block is inverted.
+   */
+  constexpr TransformBuilder Shear(const float xy, const float xz, const float yx,
+                                   const float yz, const float zx, const float zy) const {
+    const AffineTransform STEP = ToAffine(Shearing(xy, xz, yx, yz, zx, zy));
+    return Then(STEP, Inverse(STEP));
+  }
+
+  /**
+   * @brief  Applies any transform whose inverse the caller already has.
+   */
+  constexpr TransformBuilder Then(const AffineTransform &step,
+                                  const AffineTransform &stepInverse) const {
+    TransformBuilder result;
+    result.forward_ = step * forward_;
+    result.inverse_ = inverse_ * stepInverse;
+    return result;
+  }
+
+  // Accessor functions
+  constexpr const AffineTransform &Forward() const { return forward_; }
+  constexpr const AffineTransform &InverseAffine() const { return inverse_; }
+  constexpr Matrix4 ForwardMatrix() const { return ToMatrix4(forward_); }
+  constexpr Matrix4 InverseMatrix() const { return ToMatrix4(inverse_); }
+
+private:
+  /**
+   * @brief  A rotation's inverse is its transpose.
+   */
+  constexpr TransformBuilder ThenRotation(const AffineTransform &rotation) const {
+    AffineTransform transposed;
+    for (int y = 0; y < 3; ++y) {
+      for (int x = 0; x < 3; ++x) {
+        transposed.SetValue(y, x, rotation.GetValue(x, y));
+      }
+    }
+    return Then(rotation, transposed);
+  }
+
+  // The transform built so far, and its inverse
+  AffineTransform forward_;
+  AffineTransform inverse_;
+};
+#endif
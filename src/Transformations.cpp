@@ -0,0 +1,32 @@
+/*
+ * Transformations.cpp
+ *
+ * View transformation (the other builders are constexpr, in the header).
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Transformations.h"
+
+/**
+ * @brief  Constructs a view transformation that orients the world
+ *         relative to an eye looking from "from" towards "to".
+ * @param from: Position of the eye
+ * @param to: Point the eye is looking at
+ * @param up: Approximate up vector
+ * @return Matrix4: View transformation matrix
+ */
+Matrix4 ViewTransform(const Tuple &from, const Tuple &to, const Tuple &up) {
+  const Tuple FORWARD = Normalize(to - from);
+  const Tuple LEFT    = Cross(FORWARD, Normalize(up));
+
+  // Recompute up so that it is exactly perpendicular to forward/left
+  const Tuple TRUE_UP = Cross(LEFT, FORWARD);
+
+  const Matrix4 ORIENTATION( LEFT.X(),     LEFT.Y(),     LEFT.Z(),    0,
+                             TRUE_UP.X(),  TRUE_UP.Y(),  TRUE_UP.Z(), 0,
+                            -FORWARD.X(), -FORWARD.Y(), -FORWARD.Z(), 0,
+                             0,            0,            0,           1);
+
+  return ORIENTATION * Translation(-from.X(), -from.Y(), -from.Z());
+}
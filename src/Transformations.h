@@ -6,72 +6,114 @@
  * Collection of transformations that generate transformation
  * matrices.
  *
+ * The builders are constexpr and return a Matrix4, so a transform made of
+ * constants (Translation(0, 1, 0) * Scaling(2, 2, 2)) is computed by the
+ * compiler.  A Matrix4 converts to a Matrix wherever one is expected.
+ *
  * Bryant Pong
  * 9/17/18
  */
 #include "Matrix.h"
+#include "FixedMatrix.h"
 
 #include <cmath>
 
+// Function prototypes
+Matrix4 ViewTransform(const Tuple &, const Tuple &, const Tuple &);
+
 /**
- * @brief  Constructs a Translation matrix
- * @param x, y, z: amount to translate by
- * @return Matrix: Translation matrix
+ * @brief  sin() that can run at compile time.  Accurate to float precision.
  */
-Matrix Translation(const float x, const float y, const float z) {
-    Matrix temp = Identity(4);
+constexpr double ConstexprSin(const double theta) {
+  const double PI     = 3.14159265358979323846;
+  const double TWO_PI = 2 * PI;
 
-    // The rightmost column is (from top to bottom): x y z 1
-    temp.SetValue(0, 3, x);
-    temp.SetValue(1, 3, y);
-    temp.SetValue(2, 3, z);
+  // Reduce to [-pi, pi], then to [-pi/2, pi/2] with sin(pi - x) = sin(x)
+  double x = theta - TWO_PI * static_cast<long long>(theta / TWO_PI);
+  if (x > PI) {
+    x -= TWO_PI;
+  } else if (x < -PI) {
+    x += TWO_PI;
+  }
+  if (x > PI / 2) {
+    x = PI - x;
+  } else if (x < -PI / 2) {
+    x = -PI - x;
+  }
+
+  // Taylor series; the terms past x^21 are below double precision
+  const double X2 = x * x;
+  double term = x;
+  double sum  = x;
+  for (int n = 1; n <= 10; ++n) {
+    term *= -X2 / ((2 * n) * (2 * n + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+/**
+ * @brief  cos() that can run at compile time.
+ */
+constexpr double ConstexprCos(const double theta) {
+  return ConstexprSin(theta + 3.14159265358979323846 / 2);
+}
 
-    return temp;
+/**
+ * @brief  Constructs a Translation matrix
+ * @param x, y, z: amount to translate by
+ * @return Matrix4: Translation matrix
+ */
+constexpr Matrix4 Translation(const float x, const float y, const float z) {
+  // The rightmost column is (from top to bottom): x y z 1
+  return Matrix4(1, 0, 0, x,
+                 0, 1, 0, y,
+                 0, 0, 1, z,
+                 0, 0, 0, 1);
 }
 
 /**
  * @brief  Constructs a scaling matrix.
  *         Pass in values < 1 to shrink; > 1 to grow.
  * @param x, y, z: scaling factors
- * @return Matrix: Scaling matrix
+ * @return Matrix4: Scaling matrix
  */
-Matrix Scaling(const float x, const float y, const float z) {
-    Matrix temp = Identity(4);
-
-    // The main diagonal holds the scaling values
-    temp.SetValue( 0, 0, x );
-    temp.SetValue( 1, 1, y );
-    temp.SetValue( 2, 2, z );
-
-    return temp;
+constexpr Matrix4 Scaling(const float x, const float y, const float z) {
+  // The main diagonal holds the scaling values
+  return Matrix4(x, 0, 0, 0,
+                 0, y, 0, 0,
+                 0, 0, z, 0,
+                 0, 0, 0, 1);
 }
 
 /**
  * @brief  Computes rotation matrix around the X-Axis
  *         using the left-hand rule.
  * @param theta: Angle in radians to rotate
- * @return Matrix: X-Axis Rotation Matrix
+ * @return Matrix4: X-Axis Rotation Matrix
  */
-Matrix RotX(const float theta) {
-  float values[] = {1, 0,             0,            0,
-                    0, cosf(theta),  -sinf(theta),  0,
-                    0, sinf(theta),   cosf(theta),  0,
-                    0, 0,             0,            1};
-  return Matrix(4, 4, values); 
+constexpr Matrix4 RotX(const float theta) {
+  const float COS = static_cast<float>(ConstexprCos(theta));
+  const float SIN = static_cast<float>(ConstexprSin(theta));
+  return Matrix4(1, 0,    0,   0,
+                 0, COS, -SIN, 0,
+                 0, SIN,  COS, 0,
+                 0, 0,    0,   1);
 }
 
 /**
  * @brief  Computes rotation matrix around the Y-Axis
  *         using the left-hand rule.
  * @param theta: Angle in radians to rotate
- * @return Matrix: Y-Axis Rotation Matrix
+ * @return Matrix4: Y-Axis Rotation Matrix
  */
-Matrix RotY(const float theta) {
-  float values[] = {cosf(theta), 0, sinf(theta), 0,
-                    0,           1, 0,           0,
-                   -sinf(theta), 0, cosf(theta), 0,
-                    0,           0, 0,           1};
-  return Matrix(4, 4, values);
+constexpr Matrix4 RotY(const float theta) {
+  const float COS = static_cast<float>(ConstexprCos(theta));
+  const float SIN = static_cast<float>(ConstexprSin(theta));
+  return Matrix4( COS, 0, SIN, 0,
+                  0,   1, 0,   0,
+                 -SIN, 0, COS, 0,
+                  0,   0, 0,   1);
 }
 
 /**
@@ -79,29 +121,29 @@ Matrix RotY(const float theta) {
  *         using the left-hand rule.
  *
  * @param theta: Angle in radians to rotate
- * @return Matrix: Z-Axis Rotation Matrix
+ * @return Matrix4: Z-Axis Rotation Matrix
  */
-Matrix RotZ(const float theta) {
-  float values[] = {cosf(theta), -sinf(theta), 0, 0,
-                    sinf(theta),  cosf(theta), 0, 0,
-                    0,            0,           1, 0,
-                    0,            0,           0, 1};
-  return Matrix(4, 4, values);
+constexpr Matrix4 RotZ(const float theta) {
+  const float COS = static_cast<float>(ConstexprCos(theta));
+  const float SIN = static_cast<float>(ConstexprSin(theta));
+  return Matrix4(COS, -SIN, 0, 0,
+                 SIN,  COS, 0, 0,
+                 0,    0,   1, 0,
+                 0,    0,   0, 1);
 }
 
 /**
  * @brief  Constructs a shearing matrix.
  * @param xy, xz, yx, yz, zx, zy: Shearing parameters.  Moves first axis in
  *                                proportion to the second axis.
- * @return Matrix: Shearing matrix
+ * @return Matrix4: Shearing matrix
  */
-Matrix Shearing(const float xy, const float xz,
-                const float yx, const float yz,
-                const float zx, const float zy) {
-  float vals[] = {1,  xy, xz, 0,
-                  yx, 1,  yz, 0,
-                  zx, zy, 1,  0,
-                  0,  0,  0,  1};
-  return Matrix(4, 4, vals);
+constexpr Matrix4 Shearing(const float xy, const float xz,
+                           const float yx, const float yz,
+                           const float zx, const float zy) {
+  return Matrix4(1,  xy, xz, 0,
+                 yx, 1,  yz, 0,
+                 zx, zy, 1,  0,
+                 0,  0,  0,  1);
 }
 #endif
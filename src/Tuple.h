@@ -132,6 +132,14 @@ public:
     float Z() const { return z_; }
     float W() const { return w_; }
 
+    // Copies x, y, z, w into out[0..3] (the layout the render kernels use)
+    void Store(float *out) const {
+      out[0] = x_;
+      out[1] = y_;
+      out[2] = z_;
+      out[3] = w_;
+    }
+
     void SetX(const float x) { x_ = x; }
     void SetY(const float y) { y_ = y; }
     void SetZ(const float z) { z_ = z; }
@@ -156,78 +164,11 @@ protected:
     float w_;
 };
 
-/**
- * @brief  Constructs a Tuple object that is a point with
- *         the specified arguments.
- * @param x, y, z: (x, y, z) coordinates.
- * @return a Tuple representation of a point.
- */
-Tuple Point(const float x, const float y, const float z) {
-  return Tuple(x, y, z, 1.0);
-}
-
-/**
- * @brief  Constructs a Tuple object that is a vector with
- *         the specified arguments.
- *
- * @param x, y, z: (x, y, z) coordinates.
- * @return a Tuple representation of a vector.
- */
-Tuple Vector(const float x, const float y, const float z) {
-  return Tuple(x, y, z, 0.0);
-}
-
-/**
- * @brief  Computes the magnitude of a vector.
- *
- * @param vec: The vector to compute the magnitude of
- * @return float The magnitude of the input vector.
- */
-float Magnitude(const Tuple& vec) {
-  return sqrtf(vec.X() * vec.X() +
-               vec.Y() * vec.Y() +
-               vec.Z() * vec.Z() +
-               vec.W() * vec.W());
-}
-
-/**
- * @brief  Normalizes the given vector.
- *
- * @param vec: The vector to normalize
- * @return Tuple: The normalized vector.
- */
-Tuple Normalize(const Tuple& vec) {
-  // Compute vector's magnitude:
-  const float MAG = Magnitude(vec);
-
-  return Tuple(vec.X() / MAG,
-               vec.Y() / MAG,
-               vec.Z() / MAG,
-               vec.W() / MAG);
-}
-
-/**
- * @brief  Computes the dot product of two vectors.
- *
- * @param vec1, vec2: The two vectors to compute the dot product of.
- * @return float: Computed dot product.
- */
-float Dot(const Tuple &vec1, const Tuple &vec2) {
-  return vec1.X() * vec2.X() +
-         vec1.Y() * vec2.Y() +
-         vec1.Z() * vec2.Z() +
-         vec1.W() * vec2.W();
-}
-
-/**
- * @brief  Computes the cross product of two vectors.
- *
- * @param vec1, vec2: The two vectors to compute the cross product of.
- * @return Tuple: Cross product.
- */
-Tuple Cross(const Tuple &vec1, const Tuple &vec2) {
-  return Vector(vec1.Y() * vec2.Z() - vec1.Z() * vec2.Y(),
-                vec1.Z() * vec2.X() - vec1.X() * vec2.Z(),
-                vec1.X() * vec2.Y() - vec1.Y() * vec2.X());
-}
+// Function prototypes
+Tuple Point(const float, const float, const float);
+Tuple Vector(const float, const float, const float);
+float Magnitude(const Tuple &);
+Tuple Normalize(const Tuple &);
+float Dot(const Tuple &, const Tuple &);
+Tuple Cross(const Tuple &, const Tuple &);
 #endif
@@ -0,0 +1,92 @@
+/*
+ * TupleArrays.cpp
+ *
+ * In place transforms of structure of arrays points and vectors.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "TupleArrays.h"
+#include "kernels/Kernels.h"
+
+// Tuples per task when an array is split across threads: large enough
+// that each task outweighs the cost of handing it to a worker
+static const size_t TUPLES_PER_TASK = 1 << 16;
+
+/**
+ * @brief  Runs the transformSoA kernel.  w is 1 for points, 0 for vectors.
+ */
+static void TransformArrays(const AffineTransform &affine, const float w,
+                            float *x, float *y, float *z, const size_t count) {
+  float matrix[12];
+  for (int i = 0; i < 12; ++i) {
+    matrix[i] = affine.GetValue(i / 4, i % 4);
+  }
+  GetRenderKernels().transformSoA(matrix, w, x, y, z, count);
+}
+
+/**
+ * @brief  Splits the arrays into tasks for the scheduler's threads.  Each
+ *         task is a Tile covering elements [x0, x1).
+ */
+static void TransformArrays(const AffineTransform &affine, const float w,
+                            TupleArrays &tuples, TileScheduler &scheduler) {
+  const size_t COUNT = tuples.Size();
+  if (COUNT <= TUPLES_PER_TASK || scheduler.NumThreads() == 1) {
+    TransformArrays(affine, w, tuples.x.data(), tuples.y.data(), tuples.z.data(), COUNT);
+    return;
+  }
+
+  std::vector<Tile> tasks;
+  for (size_t start = 0; start < COUNT; start += TUPLES_PER_TASK) {
+    Tile task;
+    task.x0    = static_cast<int>(start);
+    task.y0    = 0;
+    task.x1    = static_cast<int>(std::min(start + TUPLES_PER_TASK, COUNT));
+    task.y1    = 1;
+    task.index = static_cast<int>(tasks.size());
+    tasks.push_back(task);
+  }
+
+  scheduler.Run(tasks, [&](const Tile &task, const int) {
+    TransformArrays(affine, w, tuples.x.data() + task.x0, tuples.y.data() + task.x0,
+                    tuples.z.data() + task.x0, task.x1 - task.x0);
+  });
+}
+
+/**
+ * @brief  Transforms count points, including the translation.
+ */
+void TransformPoints(const AffineTransform &affine, float *x, float *y, float *z,
+                     const size_t count) {
+  TransformArrays(affine, 1, x, y, z, count);
+}
+
+/**
+ * @brief  Transforms count vectors (the translation is ignored).
+ */
+void TransformVectors(const AffineTransform &affine, float *x, float *y, float *z,
+                      const size_t count) {
+  TransformArrays(affine, 0, x, y, z, count);
+}
+
+void TransformPoints(const AffineTransform &affine, TupleArrays &points) {
+  TransformPoints(affine, points.x.data(), points.y.data(), points.z.data(), points.Size());
+}
+
+void TransformVectors(const AffineTransform &affine, TupleArrays &vectors) {
+  TransformVectors(affine, vectors.x.data(), vectors.y.data(), vectors.z.data(), vectors.Size());
+}
+
+/**
+ * @brief  Multithreaded versions.  Small arrays run on the calling thread.
+ */
+void TransformPoints(const AffineTransform &affine, TupleArrays &points,
+                     TileScheduler &scheduler) {
+  TransformArrays(affine, 1, points, scheduler);
+}
+
+void TransformVectors(const AffineTransform &affine, TupleArrays &vectors,
+                      TileScheduler &scheduler) {
+  TransformArrays(affine, 0, vectors, scheduler);
+}
@@ -0,0 +1,54 @@
+#ifndef __TUPLE_ARRAYS_H_
+#define __TUPLE_ARRAYS_H_
+/*
+ * TupleArrays.h
+ *
+ * Many points or vectors stored as a structure of arrays (all x values,
+ * then all y values, then all z values), and transforms that update a
+ * whole array in place.  Applying one transform to a mesh or a particle
+ * system this way runs on the transformSoA render kernel, which handles
+ * 4-16 tuples per instruction, instead of one Matrix * Tuple at a time.
+ *
+ * Large arrays can also be split across the threads of a TileScheduler.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "AffineTransform.h"
+#include "TileScheduler.h"
+#include "Tuple.h"
+
+#include <vector>
+
+/**
+ * @brief  Points or vectors as separate x, y, and z arrays.  Whether the
+ *         elements are points or vectors is up to the caller (see
+ *         TransformPoints() and TransformVectors()).
+ */
+struct TupleArrays {
+  /**
+   * @brief  Appends a tuple's x, y, and z.
+   */
+  void Add(const Tuple &tuple) {
+    x.push_back(tuple.X());
+    y.push_back(tuple.Y());
+    z.push_back(tuple.Z());
+  }
+
+  // Element i as a point or a vector
+  Tuple PointAt(const size_t i) const { return Point(x[i], y[i], z[i]); }
+  Tuple VectorAt(const size_t i) const { return Vector(x[i], y[i], z[i]); }
+
+  size_t Size() const { return x.size(); }
+
+  std::vector<float> x, y, z;
+};
+
+// Function Prototypes
+void TransformPoints(const AffineTransform &, float *, float *, float *, const size_t);
+void TransformVectors(const AffineTransform &, float *, float *, float *, const size_t);
+void TransformPoints(const AffineTransform &, TupleArrays &);
+void TransformVectors(const AffineTransform &, TupleArrays &);
+void TransformPoints(const AffineTransform &, TupleArrays &, TileScheduler &);
+void TransformVectors(const AffineTransform &, TupleArrays &, TileScheduler &);
+#endif
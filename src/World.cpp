@@ -0,0 +1,305 @@
+/*
+ * World.cpp
+ *
+ * Ray-world intersection and shading.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "World.h"
+#include "kernels/Kernels.h"
+
+/**
+ * @brief  Constructs the default world: a white point light and two
+ *         concentric spheres.
+ */
+World DefaultWorld() {
+  World world;
+  world.AddLight(PointLight(Point(-10, 10, -10), Color(1, 1, 1)));
+
+  Sphere s1;
+  Material m1;
+  m1.SetColor(Color(0.8, 1.0, 0.6));
+  m1.SetDiffuse(0.7);
+  m1.SetSpecular(0.2);
+  s1.SetMaterial(m1);
+
+  Sphere s2;
+  s2.SetTransform(Scaling(0.5, 0.5, 0.5));
+
+  world.AddObject(s1);
+  world.AddObject(s2);
+  return world;
+}
+
+// Objects intersected per intersectUnitSphere call
+static const size_t INTERSECT_BATCH = 16;
+
+/**
+ * @brief  Intersects a ray with every object in the world.  The ray is
+ *         moved into each object's space and up to INTERSECT_BATCH objects
+ *         are tested per call of the intersectUnitSphere kernel.
+ * @return std::vector<Intersection>: Intersections sorted by increasing t
+ */
+std::vector<Intersection> IntersectWorld(const World &world, const Ray &ray) {
+  std::vector<Intersection> xs;
+
+  const std::vector<Sphere> &OBJECTS = world.Objects();
+  COUNT_PIXEL_EVENT(rays, 1);
+  COUNT_PIXEL_EVENT(intersects, OBJECTS.size());
+
+  const RenderKernels &KERNELS = GetRenderKernels();
+  float origins[4 * INTERSECT_BATCH], directions[4 * INTERSECT_BATCH];
+  float t0[INTERSECT_BATCH], t1[INTERSECT_BATCH];
+  for (size_t first = 0; first < OBJECTS.size(); first += INTERSECT_BATCH) {
+    const size_t COUNT = std::min(INTERSECT_BATCH, OBJECTS.size() - first);
+    for (size_t i = 0; i < COUNT; ++i) {
+      const Ray RAY_T = ObjectSpaceRay(OBJECTS[first + i], ray);
+      RAY_T.Origin().Store(&origins[4 * i]);
+      RAY_T.Direction().Store(&directions[4 * i]);
+    }
+
+    const size_t HITS = KERNELS.intersectUnitSphere(origins, directions, COUNT, t0, t1);
+    COUNT_RENDER_STAT(STAT_INTERSECTION_TESTS, COUNT);
+    COUNT_RENDER_STAT(STAT_HITS, HITS);
+
+    for (size_t i = 0; i < COUNT; ++i) {
+      if (t0[i] != FLT_MAX) {
+        xs.push_back(Intersection(t0[i], OBJECTS[first + i]));
+        xs.push_back(Intersection(t1[i], OBJECTS[first + i]));
+      }
+    }
+  }
+
+  std::sort(xs.begin(), xs.end(),
+            [](const Intersection &a, const Intersection &b) { return a.T() < b.T(); });
+  return xs;
+}
+
+/**
+ * @brief  Precomputes the shading state for the given hit.
+ * @param hit: The intersection being shaded
+ * @param ray: The ray that produced the intersection
+ * @param xs: Every intersection along the ray (used to find n1/n2)
+ */
+Computations PrepareComputations(const Intersection &hit, const Ray &ray,
+                                 const std::vector<Intersection> &xs) {
+  Computations comps(hit.T(), hit.Object());
+
+  comps.point   = Position(ray, comps.t);
+  comps.eyev    = -ray.Direction();
+  comps.normalv = comps.object.NormalAt(comps.point);
+
+  // If the normal points away from the eye, the hit is on the inside
+  if (Dot(comps.normalv, comps.eyev) < 0) {
+    comps.inside  = true;
+    comps.normalv = -comps.normalv;
+  }
+
+  comps.overPoint  = comps.point + comps.normalv * SURFACE_EPSILON;
+  comps.underPoint = comps.point - comps.normalv * SURFACE_EPSILON;
+  comps.reflectv   = Reflect(ray.Direction(), comps.normalv);
+
+  /*
+   * Walk the intersections in order, tracking which objects the ray is
+   * currently inside of.  n1 belongs to the innermost object before the hit;
+   * n2 to the innermost object after it.
+   */
+  std::vector<int> containerIDs;
+  std::vector<float> containerIndices;
+  for (size_t i = 0; i < xs.size(); ++i) {
+    const Sphere OBJ = xs[i].Object();
+    const bool IS_HIT = (std::fabs(xs[i].T() - hit.T()) <= 0.0001) &&
+                        (OBJ.ID() == hit.Object().ID());
+
+    if (IS_HIT) {
+      comps.n1 = containerIndices.empty() ? 1.0 : containerIndices.back();
+    }
+
+    // Entering an object adds it to the containers; exiting removes it
+    std::vector<int>::iterator found =
+      std::find(containerIDs.begin(), containerIDs.end(), OBJ.ID());
+    if (found != containerIDs.end()) {
+      containerIndices.erase(containerIndices.begin() + (found - containerIDs.begin()));
+      containerIDs.erase(found);
+    } else {
+      containerIDs.push_back(OBJ.ID());
+      containerIndices.push_back(OBJ.GetMaterial().RefractiveIndex());
+    }
+
+    if (IS_HIT) {
+      comps.n2 = containerIndices.empty() ? 1.0 : containerIndices.back();
+      break;
+    }
+  }
+
+  return comps;
+}
+
+/**
+ * @brief  Checks if the specified point is blocked from the light source
+ *         by any object in the world.
+ * @param record: Optional record of the shadow ray segment and the objects it hit
+ */
+bool IsShadowed(const World &world, const PointLight &light, const Tuple &pt,
+                TraceRecord *record) {
+  const Tuple TO_LIGHT = light.Position() - pt;
+  const float DISTANCE = Magnitude(TO_LIGHT);
+
+  const Ray SHADOW_RAY(pt, Normalize(TO_LIGHT));
+  COUNT_RENDER_STAT(STAT_SHADOW_RAYS, 1);
+  const std::vector<Intersection> XS = IntersectWorld(world, SHADOW_RAY);
+  const Intersection HIT = Hit(XS);
+  const bool IN_SHADOW = HIT.T() < DISTANCE;
+
+  if (record) {
+    record->AddIntersections(XS);
+    record->AddPoint(pt);
+    record->AddPoint(IN_SHADOW ? Position(SHADOW_RAY, HIT.T()) : light.Position());
+  }
+
+  return IN_SHADOW;
+}
+
+/**
+ * @brief  Schlick's approximation of the Fresnel equations.
+ * @return float: Fraction of light that is reflected (0.0-1.0)
+ */
+float Schlick(const Computations &comps) {
+  float cosI = Dot(comps.eyev, comps.normalv);
+
+  // Total internal reflection can only occur if n1 > n2
+  if (comps.n1 > comps.n2) {
+    const float N = comps.n1 / comps.n2;
+    const float SIN2_T = N * N * (1.0 - cosI * cosI);
+    if (SIN2_T > 1.0) {
+      return 1.0;
+    }
+
+    // When n1 > n2, use cos(theta_t) instead
+    cosI = sqrtf(1.0 - SIN2_T);
+  }
+
+  const float R0 = powf((comps.n1 - comps.n2) / (comps.n1 + comps.n2), 2);
+  return R0 + (1 - R0) * powf(1 - cosI, 5);
+}
+
+/**
+ * @brief  Computes the color at the intersection described by comps,
+ *         including reflected and refracted light.
+ * @param depth: Number of bounces already followed to reach this point
+ * @param throughput: Fraction of the final pixel color this point contributes
+ * @param record: Optional record of the rays traced while shading
+ */
+Color ShadeHit(const World &world, const Computations &comps,
+               const int depth, const float throughput, TraceRecord *record) {
+  const Material MAT = comps.object.GetMaterial();
+
+  // Direct lighting from every light source
+  Color surface;
+  const std::vector<PointLight> &LIGHTS = world.Lights();
+  COUNT_PIXEL_EVENT(shades, LIGHTS.size());
+  for (size_t i = 0; i < LIGHTS.size(); ++i) {
+    const bool IN_SHADOW = IsShadowed(world, LIGHTS[i], comps.overPoint, record);
+    surface += Lighting(MAT, LIGHTS[i], comps.overPoint, comps.eyev,
+                        comps.normalv, IN_SHADOW);
+  }
+
+  // Reflective and transparent surfaces split light between the two by Fresnel
+  if (MAT.Reflective() > 0 && MAT.Transparency() > 0) {
+    const float REFLECTANCE = Schlick(comps);
+    const Color REFLECTED = ReflectedColor(world, comps, depth, throughput * REFLECTANCE,
+                                           record);
+    const Color REFRACTED = RefractedColor(world, comps, depth,
+                                           throughput * (1 - REFLECTANCE), record);
+    return surface + REFLECTED * REFLECTANCE + REFRACTED * (1 - REFLECTANCE);
+  }
+
+  return surface +
+         ReflectedColor(world, comps, depth, throughput, record) +
+         RefractedColor(world, comps, depth, throughput, record);
+}
+
+/**
+ * @brief  Computes the color seen along the reflection vector.  Returns
+ *         black if the surface is not reflective, the bounce budget is
+ *         exhausted, or the reflected ray would contribute too little.
+ */
+Color ReflectedColor(const World &world, const Computations &comps,
+                     const int depth, const float throughput, TraceRecord *record) {
+  const float REFLECTIVE = comps.object.GetMaterial().Reflective();
+  const float CHILD_THROUGHPUT = throughput * REFLECTIVE;
+
+  if (REFLECTIVE <= 0 || depth >= world.MaxDepth() ||
+      CHILD_THROUGHPUT < world.MinContribution()) {
+    return Color(0, 0, 0);
+  }
+
+  const Ray REFLECT_RAY(comps.overPoint, comps.reflectv);
+  return ColorAt(world, REFLECT_RAY, depth + 1, CHILD_THROUGHPUT, record) * REFLECTIVE;
+}
+
+/**
+ * @brief  Computes the color seen through a transparent surface.  Returns
+ *         black if the surface is opaque, the bounce budget is exhausted,
+ *         the refracted ray would contribute too little, or the ray is
+ *         totally internally reflected.
+ */
+Color RefractedColor(const World &world, const Computations &comps,
+                     const int depth, const float throughput, TraceRecord *record) {
+  const float TRANSPARENCY = comps.object.GetMaterial().Transparency();
+  const float CHILD_THROUGHPUT = throughput * TRANSPARENCY;
+
+  if (TRANSPARENCY <= 0 || depth >= world.MaxDepth() ||
+      CHILD_THROUGHPUT < world.MinContribution()) {
+    return Color(0, 0, 0);
+  }
+
+  // Snell's Law
+  const float N_RATIO = comps.n1 / comps.n2;
+  const float COS_I = Dot(comps.eyev, comps.normalv);
+  const float SIN2_T = N_RATIO * N_RATIO * (1 - COS_I * COS_I);
+  if (SIN2_T > 1) {
+    // Total internal reflection
+    return Color(0, 0, 0);
+  }
+
+  const float COS_T = sqrtf(1.0 - SIN2_T);
+  const Tuple DIRECTION = comps.normalv * (N_RATIO * COS_I - COS_T) -
+                          comps.eyev * N_RATIO;
+
+  const Ray REFRACT_RAY(comps.underPoint, DIRECTION);
+  return ColorAt(world, REFRACT_RAY, depth + 1, CHILD_THROUGHPUT, record) * TRANSPARENCY;
+}
+
+/**
+ * @brief  Computes the color seen along a ray cast into the world.
+ * @param depth: Number of bounces already followed (0 for primary rays)
+ * @param throughput: Fraction of the final pixel color this ray contributes
+ * @param record: Optional record of every object and ray segment the color
+ *                depends on.  Primary ray segments are not recorded.
+ */
+Color ColorAt(const World &world, const Ray &ray,
+              const int depth, const float throughput, TraceRecord *record) {
+  if (depth > 0) {
+    COUNT_RENDER_STAT(STAT_SECONDARY_RAYS, 1);
+  }
+  const std::vector<Intersection> XS = IntersectWorld(world, ray);
+  const Intersection HIT = Hit(XS);
+
+  if (record) {
+    record->AddIntersections(XS);
+    if (depth > 0 && HIT.T() == FLT_MAX) {
+      record->escaped = true;
+    } else if (depth > 0) {
+      record->AddPoint(ray.Origin());
+      record->AddPoint(Position(ray, HIT.T()));
+    }
+  }
+
+  if (HIT.T() == FLT_MAX) {
+    return Color(0, 0, 0);
+  }
+
+  return ShadeHit(world, PrepareComputations(HIT, ray, XS), depth, throughput, record);
+}
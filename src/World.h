@@ -0,0 +1,190 @@
+#ifndef __WORLD_H_
+#define __WORLD_H_
+/*
+ * World.h
+ *
+ * Class definition for a World (a collection of objects and light sources)
+ * along with the recursive shading functions that follow reflected and
+ * refracted rays through it.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "Color.h"
+#include "RaySphere.h"
+#include "PointLight.h"
+#include "Lighting.h"
+#include "Transformations.h"
+#include "PixelCounters.h"
+#include "RenderStats.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+/*
+ * Distance to lift a point off of a surface before casting secondary rays
+ * from it.  Prevents the surface from shadowing/reflecting itself due to
+ * floating point error ("acne").
+ */
+const float SURFACE_EPSILON = 0.001;
+
+/**
+ * @brief  World class
+ */
+class World {
+public:
+  /**
+   * @brief Default Constructor.  An empty world with a maximum recursion
+   *        depth of 5 and rays contributing less than 1% of the final
+   *        color being dropped.
+   */
+  World() : maxDepth_(5), minContribution_(0.01) {
+  }
+
+  /**
+   * @brief Destructor
+   */
+  ~World() {
+  }
+
+  /**
+   * @brief Copy Constructor
+   */
+  World(const World &rhs) :
+    objects_(rhs.objects_),
+    lights_(rhs.lights_),
+    maxDepth_(rhs.maxDepth_),
+    minContribution_(rhs.minContribution_) {
+  }
+
+  /**
+   * @brief Assignment operator=
+   */
+  World &operator=(const World &rhs) {
+    // Check for self-assignment
+    if (this != &rhs) {
+      objects_         = rhs.objects_;
+      lights_          = rhs.lights_;
+      maxDepth_        = rhs.maxDepth_;
+      minContribution_ = rhs.minContribution_;
+    }
+    return *this;
+  }
+
+  // Modifier functions
+  void AddObject(const Sphere &obj) { objects_.push_back(obj); }
+  void AddLight(const PointLight &light) { lights_.push_back(light); }
+  void SetMaxDepth(const int depth) { maxDepth_ = depth; }
+  void SetMinContribution(const float contrib) { minContribution_ = contrib; }
+
+  // Accessor functions
+  const std::vector<Sphere> &Objects() const { return objects_; }
+  std::vector<Sphere> &Objects() { return objects_; }
+  const std::vector<PointLight> &Lights() const { return lights_; }
+  int MaxDepth() const { return maxDepth_; }
+  float MinContribution() const { return minContribution_; }
+
+private:
+  // Objects and light sources in the world
+  std::vector<Sphere> objects_;
+  std::vector<PointLight> lights_;
+
+  // Maximum number of reflection/refraction bounces to follow
+  int maxDepth_;
+
+  /*
+   * Secondary rays whose contribution to the final pixel (the product of
+   * every reflective/transparent weight along the path) falls below this
+   * threshold are not traced.
+   */
+  float minContribution_;
+};
+
+/**
+ * @brief  Precomputed state of a ray/object intersection used for shading.
+ */
+struct Computations {
+  Computations(const float hitT, const Sphere &obj) :
+    t(hitT), object(obj), inside(false), n1(1.0), n2(1.0) {
+  }
+
+  // Distance along the ray and the object that was hit
+  float t;
+  Sphere object;
+
+  // Point of intersection, plus copies lifted just above/below the surface
+  Tuple point, overPoint, underPoint;
+
+  // Eye, normal, and reflection vectors at the point of intersection
+  Tuple eyev, normalv, reflectv;
+
+  // True if the ray originated inside of the object
+  bool inside;
+
+  // Refractive indices of the materials being exited (n1) and entered (n2)
+  float n1, n2;
+};
+
+/**
+ * @brief  Record of the geometry that shading a ray depended on.  Renderers
+ *         that need to know which pixels an edit to the world can affect
+ *         pass one to ColorAt().
+ */
+struct TraceRecord {
+  TraceRecord() : hasBounds(false), escaped(false) {
+  }
+
+  // IDs of every object intersected by any ray (may contain duplicates)
+  std::vector<int> objectIDs;
+
+  // World space box enclosing every shadow and secondary ray segment
+  bool hasBounds;
+  Tuple boundsMin, boundsMax;
+
+  // True if a secondary ray missed everything, so its segment is unbounded
+  bool escaped;
+
+  /**
+   * @brief Records the IDs of the intersected objects.
+   */
+  void AddIntersections(const std::vector<Intersection> &xs) {
+    for (size_t i = 0; i < xs.size(); ++i) {
+      objectIDs.push_back(xs[i].Object().ID());
+    }
+  }
+
+  /**
+   * @brief Grows the segment bounds to include the point.
+   */
+  void AddPoint(const Tuple &pt) {
+    if (!hasBounds) {
+      boundsMin = boundsMax = pt;
+      hasBounds = true;
+      return;
+    }
+    boundsMin = Point(std::min(boundsMin.X(), pt.X()), std::min(boundsMin.Y(), pt.Y()),
+                      std::min(boundsMin.Z(), pt.Z()));
+    boundsMax = Point(std::max(boundsMax.X(), pt.X()), std::max(boundsMax.Y(), pt.Y()),
+                      std::max(boundsMax.Z(), pt.Z()));
+  }
+};
+
+// Function Prototypes
+World DefaultWorld();
+std::vector<Intersection> IntersectWorld(const World &, const Ray &);
+Computations PrepareComputations(const Intersection &, const Ray &,
+                                 const std::vector<Intersection> &);
+bool IsShadowed(const World &, const PointLight &, const Tuple &, TraceRecord * = NULL);
+float Schlick(const Computations &);
+Color ShadeHit(const World &, const Computations &, const int, const float,
+               TraceRecord * = NULL);
+Color ReflectedColor(const World &, const Computations &, const int, const float,
+                     TraceRecord * = NULL);
+Color RefractedColor(const World &, const Computations &, const int, const float,
+                     TraceRecord * = NULL);
+Color ColorAt(const World &, const Ray &, const int = 0, const float = 1.0,
+              TraceRecord * = NULL);
+#endif
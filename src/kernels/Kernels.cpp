@@ -0,0 +1,109 @@
+/*
+ * Kernels.cpp
+ *
+ * Picks the render kernels for the CPU the program is running on.  Built
+ * without any instruction set flags so it can run anywhere.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "kernels/Kernels.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+// Kernels in use (NULL until the first GetRenderKernels() or SelectCpuLevel())
+static std::atomic<const RenderKernels *> activeKernels(NULL);
+
+/**
+ * @brief  Name of a level, as accepted by ParseCpuLevel().
+ */
+const char *CpuLevelName(const CpuLevel level) {
+  switch (level) {
+    case CPU_SSE2:   return "sse2";
+    case CPU_SSE42:  return "sse4.2";
+    case CPU_AVX2:   return "avx2";
+    case CPU_AVX512: return "avx512";
+    default:         return "unknown";
+  }
+}
+
+/**
+ * @brief  Looks up a level by its CpuLevelName().
+ * @return bool: False if the name is not a level
+ */
+bool ParseCpuLevel(const char *name, CpuLevel &level) {
+  for (int i = 0; i < NUM_CPU_LEVELS; ++i) {
+    if (strcmp(name, CpuLevelName(static_cast<CpuLevel>(i))) == 0) {
+      level = static_cast<CpuLevel>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief  Highest level this CPU (and OS) supports.
+ */
+CpuLevel DetectCpuLevel() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") &&
+      __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq")) {
+    return CPU_AVX512;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return CPU_AVX2;
+  }
+  if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) {
+    return CPU_SSE42;
+  }
+#endif
+  return CPU_SSE2;
+}
+
+/**
+ * @brief  The kernels built for a level, whether or not this CPU can run them.
+ */
+const RenderKernels &KernelsForLevel(const CpuLevel level) {
+  switch (level) {
+    case CPU_SSE42:  return KernelsSse42();
+    case CPU_AVX2:   return KernelsAvx2();
+    case CPU_AVX512: return KernelsAvx512();
+    default:         return KernelsSse2();
+  }
+}
+
+/**
+ * @brief  Forces GetRenderKernels() to return the given level's kernels.
+ * @return bool: False (changing nothing) if this CPU does not support it
+ */
+bool SelectCpuLevel(const CpuLevel level) {
+  if (level < CPU_SSE2 || level >= NUM_CPU_LEVELS || level > DetectCpuLevel()) {
+    return false;
+  }
+  activeKernels.store(&KernelsForLevel(level), std::memory_order_release);
+  return true;
+}
+
+/**
+ * @brief  The kernels to use.  On the first call, selects the highest level
+ *         the CPU supports, or $RENDER_CPU_LEVEL if it is set to a lower one.
+ */
+const RenderKernels &GetRenderKernels() {
+  const RenderKernels *kernels = activeKernels.load(std::memory_order_acquire);
+  if (!kernels) {
+    CpuLevel level = DetectCpuLevel();
+    CpuLevel forced;
+    const char *OVERRIDE = getenv("RENDER_CPU_LEVEL");
+    if (OVERRIDE && ParseCpuLevel(OVERRIDE, forced) && forced <= level) {
+      level = forced;
+    }
+
+    // Racing first calls all pick the same level, so any of them may win
+    kernels = &KernelsForLevel(level);
+    activeKernels.store(kernels, std::memory_order_release);
+  }
+  return *kernels;
+}
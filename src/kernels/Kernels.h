@@ -0,0 +1,140 @@
+#ifndef __KERNELS_H_
+#define __KERNELS_H_
+/*
+ * Kernels.h
+ *
+ * Batched versions of the renderer's hot loops (tuple transforms, ray-sphere
+ * intersection, Phong shading, pixel quantization, animated pose blending,
+ * and particle simulation).  The kernels are compiled once per instruction set level in
+ * separate translation units (kernels_<level>.cpp), so one binary can run on
+ * any x86-64 CPU and still use AVX2/AVX-512 where they are available.  GetRenderKernels() picks the
+ * best level the CPU supports the first time it is called.
+ *
+ * Setting RENDER_CPU_LEVEL (sse2, sse4.2, avx2, or avx512) or calling
+ * SelectCpuLevel() forces a lower level, e.g. to test every code path on
+ * one machine.
+ *
+ * Unlike the rest of src/, these are declarations only: the definitions
+ * live in the RenderKernels library.
+ *
+ * Tuples, points, vectors, and colors are passed as arrays of 4 floats per
+ * element (x, y, z, w), the same layout as Tuple and Color.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief  Instruction set levels, lowest to highest.
+ */
+enum CpuLevel {
+  CPU_SSE2,   // Every x86-64 CPU
+  CPU_SSE42,  // SSE4.2 + POPCNT
+  CPU_AVX2,   // AVX2 + FMA
+  CPU_AVX512, // AVX-512 F/VL/BW/DQ
+  NUM_CPU_LEVELS
+};
+
+/**
+ * @brief  Phong material parameters (see Material).
+ */
+struct KernelMaterial {
+  float color[3];
+  float ambient, diffuse, specular, shininess;
+};
+
+/**
+ * @brief  Point light (see PointLight).
+ */
+struct KernelLight {
+  float position[3];
+  float intensity[3];
+};
+
+/**
+ * @brief  Object poses as a structure of arrays, so the kernels can work on
+ *         several objects at once: rotation quaternion (w, x, y, z),
+ *         translation (tx, ty, tz), and scale (sx, sy, sz).
+ */
+struct KernelPoses {
+  const float *qw, *qx, *qy, *qz;
+  const float *tx, *ty, *tz;
+  const float *sx, *sy, *sz;
+};
+
+/*
+ * One implementation of every kernel.  Input and output arrays must not
+ * overlap.
+ */
+struct RenderKernels {
+  // Level the kernels were compiled for
+  CpuLevel level;
+
+  // out[i] = matrix * in[i], with matrix stored row-major
+  void (*transformTuples)(const float *matrix, const float *in, float *out, size_t count);
+
+  /*
+   * Intersects rays (already in object space) with the unit sphere, like
+   * Intersect().  t0[i] <= t1[i] receive the two hits, or FLT_MAX for a
+   * miss.  Returns the number of rays that hit.
+   */
+  size_t (*intersectUnitSphere)(const float *origins, const float *directions, size_t count,
+                                float *t0, float *t1);
+
+  /*
+   * Phong shading of surface points, like Lighting().  inShadow may be
+   * NULL if no point is shadowed.
+   */
+  void (*shadePhong)(const KernelMaterial &material, const KernelLight &light,
+                     const float *points, const float *eyes, const float *normals,
+                     const uint8_t *inShadow, size_t count, float *colors);
+
+  // Clamps colors to 0.0-1.0 and scales them to 8 bit RGB like WriteToPPM()
+  void (*quantizePixels)(const float *colors, size_t count, uint8_t *rgb);
+
+  /*
+   * Blends from[i] toward to[i] by t[i] (nlerp of the unit rotations along
+   * the shorter arc, lerp of translation and scale) and writes the affine
+   * transform translate * rotate * scale.  affine holds 12 planes of count
+   * floats: element (row, col) of object i is affine[(4 * row + col) * count + i].
+   */
+  void (*blendPoses)(const KernelPoses &from, const KernelPoses &to, const float *t,
+                     size_t count, float *affine);
+
+  /*
+   * Transforms tuples stored as separate x, y, and z arrays in place.
+   * affine is the top three rows of the matrix (12 floats, row-major); w is
+   * 1 for points and 0 for vectors.  The three arrays must not overlap each
+   * other.
+   */
+  void (*transformSoA)(const float *affine, float w, float *x, float *y, float *z,
+                       size_t count);
+
+  /*
+   * Advances particles by steps Euler steps of dt under a constant
+   * acceleration (3 floats), like Cannon's Tick(): the position moves by
+   * the velocity, then the velocity changes by the acceleration.  Computed
+   * in closed form, so the cost does not depend on steps.  life[i] drops by
+   * steps * dt.  Returns the number of particles with no life left.
+   */
+  size_t (*tickParticles)(const float *acceleration, float dt, unsigned int steps,
+                          float *px, float *py, float *pz, float *vx, float *vy, float *vz,
+                          float *life, size_t count);
+};
+
+// Function Prototypes
+const char *CpuLevelName(const CpuLevel);
+bool ParseCpuLevel(const char *, CpuLevel &);
+CpuLevel DetectCpuLevel();
+bool SelectCpuLevel(const CpuLevel);
+const RenderKernels &GetRenderKernels();
+const RenderKernels &KernelsForLevel(const CpuLevel);
+
+// Per-level tables, one per kernels_<level>.cpp
+const RenderKernels &KernelsSse2();
+const RenderKernels &KernelsSse42();
+const RenderKernels &KernelsAvx2();
+const RenderKernels &KernelsAvx512();
+#endif
@@ -0,0 +1,264 @@
+#ifndef __KERNELS_IMPL_H_
+#define __KERNELS_IMPL_H_
+/*
+ * KernelsImpl.h
+ *
+ * Kernel bodies shared by every kernels_<level>.cpp.  Each translation unit
+ * defines KERNEL_LEVEL and KERNEL_TABLE (the name of its table function)
+ * and includes this file; the instruction set comes from that file's
+ * compile flags.  The loops are written so the compiler can vectorize them
+ * across elements at whatever width the level allows.
+ *
+ * Everything here except KERNEL_TABLE is static, so each level gets its own
+ * copy of the kernels.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "kernels/Kernels.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if !defined(KERNEL_LEVEL) || !defined(KERNEL_TABLE)
+#error "Define KERNEL_LEVEL and KERNEL_TABLE before including KernelsImpl.h"
+#endif
+
+/**
+ * @brief  out[i] = matrix * in[i].
+ */
+static void TransformTuplesKernel(const float *__restrict matrix, const float *__restrict in,
+                                  float *__restrict out, const size_t count) {
+  float m[16];
+  for (int i = 0; i < 16; ++i) {
+    m[i] = matrix[i];
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    const float X = in[4 * i], Y = in[4 * i + 1], Z = in[4 * i + 2], W = in[4 * i + 3];
+    for (int row = 0; row < 4; ++row) {
+      out[4 * i + row] = m[4 * row] * X + m[4 * row + 1] * Y + m[4 * row + 2] * Z +
+                         m[4 * row + 3] * W;
+    }
+  }
+}
+
+/**
+ * @brief  Ray-unit sphere intersection.  Branch free so it vectorizes.
+ */
+static size_t IntersectUnitSphereKernel(const float *__restrict origins,
+                                        const float *__restrict directions, const size_t count,
+                                        float *__restrict t0, float *__restrict t1) {
+  size_t hits = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const float OX = origins[4 * i], OY = origins[4 * i + 1], OZ = origins[4 * i + 2];
+    const float DX = directions[4 * i], DY = directions[4 * i + 1], DZ = directions[4 * i + 2];
+
+    const float A = DX * DX + DY * DY + DZ * DZ;
+    const float B = 2 * (DX * OX + DY * OY + DZ * OZ);
+    const float C = OX * OX + OY * OY + OZ * OZ - 1;
+    const float DISCRIMINANT = B * B - 4 * A * C;
+
+    const bool HIT = DISCRIMINANT >= 0;
+    const float ROOT = sqrtf(HIT ? DISCRIMINANT : 0.0f);
+    const float NEAR = (-B - ROOT) / (2 * A);
+    const float FAR  = (-B + ROOT) / (2 * A);
+    // A > 0, so NEAR <= FAR
+    t0[i] = HIT ? NEAR : FLT_MAX;
+    t1[i] = HIT ? FAR : FLT_MAX;
+    hits += HIT ? 1 : 0;
+  }
+  return hits;
+}
+
+/**
+ * @brief  Phong shading, matching Lighting().
+ */
+static void ShadePhongKernel(const KernelMaterial &material, const KernelLight &light,
+                             const float *__restrict points, const float *__restrict eyes,
+                             const float *__restrict normals, const uint8_t *__restrict inShadow,
+                             const size_t count, float *__restrict colors) {
+  float effective[3], ambient[3], specular[3];
+  for (int c = 0; c < 3; ++c) {
+    effective[c] = material.color[c] * light.intensity[c];
+    ambient[c]   = effective[c] * material.ambient;
+    specular[c]  = light.intensity[c] * material.specular;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    // Normalized direction to the light
+    float lx = light.position[0] - points[4 * i];
+    float ly = light.position[1] - points[4 * i + 1];
+    float lz = light.position[2] - points[4 * i + 2];
+    const float LENGTH = sqrtf(lx * lx + ly * ly + lz * lz);
+    lx /= LENGTH;
+    ly /= LENGTH;
+    lz /= LENGTH;
+
+    const float NX = normals[4 * i], NY = normals[4 * i + 1], NZ = normals[4 * i + 2];
+    const float LIGHT_DOT_NORMAL = lx * NX + ly * NY + lz * NZ;
+    const bool LIT = LIGHT_DOT_NORMAL >= 0 && !(inShadow && inShadow[i]);
+
+    // Reflect(-light, normal) dotted with the eye vector
+    const float RX = 2 * LIGHT_DOT_NORMAL * NX - lx;
+    const float RY = 2 * LIGHT_DOT_NORMAL * NY - ly;
+    const float RZ = 2 * LIGHT_DOT_NORMAL * NZ - lz;
+    const float REFLECT_DOT_EYE = RX * eyes[4 * i] + RY * eyes[4 * i + 1] + RZ * eyes[4 * i + 2];
+
+    const float DIFFUSE = LIT ? material.diffuse * LIGHT_DOT_NORMAL : 0.0f;
+    const float FACTOR = (LIT && REFLECT_DOT_EYE > 0) ?
+                         powf(REFLECT_DOT_EYE, material.shininess) : 0.0f;
+    for (int c = 0; c < 3; ++c) {
+      colors[4 * i + c] = ambient[c] + effective[c] * DIFFUSE + specular[c] * FACTOR;
+    }
+    colors[4 * i + 3] = 0.0f;
+  }
+}
+
+/**
+ * @brief  Clamp, scale to 0-255, and truncate, matching WriteToPPM().
+ */
+static void QuantizePixelsKernel(const float *__restrict colors, const size_t count,
+                                 uint8_t *__restrict rgb) {
+  for (size_t i = 0; i < count; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      const float CLAMPED = std::min(1.0f, std::max(0.0f, colors[4 * i + c]));
+      rgb[3 * i + c] = static_cast<uint8_t>(static_cast<int>(CLAMPED * 255));
+    }
+  }
+}
+
+/**
+ * @brief  Pose blending.  Every object is independent, so the loop
+ *         vectorizes across objects.
+ */
+static void BlendPosesKernel(const KernelPoses &from, const KernelPoses &to,
+                             const float *__restrict t, const size_t count,
+                             float *__restrict affine) {
+  const float *__restrict aw = from.qw, *__restrict ax = from.qx;
+  const float *__restrict ay = from.qy, *__restrict az = from.qz;
+  const float *__restrict bw = to.qw, *__restrict bx = to.qx;
+  const float *__restrict by = to.qy, *__restrict bz = to.qz;
+  const float *__restrict atx = from.tx, *__restrict aty = from.ty, *__restrict atz = from.tz;
+  const float *__restrict btx = to.tx, *__restrict bty = to.ty, *__restrict btz = to.tz;
+  const float *__restrict asx = from.sx, *__restrict asy = from.sy, *__restrict asz = from.sz;
+  const float *__restrict bsx = to.sx, *__restrict bsy = to.sy, *__restrict bsz = to.sz;
+
+  // One output plane per matrix element
+  float *__restrict m00 = affine,              *__restrict m01 = affine + count;
+  float *__restrict m02 = affine + 2 * count,  *__restrict m03 = affine + 3 * count;
+  float *__restrict m10 = affine + 4 * count,  *__restrict m11 = affine + 5 * count;
+  float *__restrict m12 = affine + 6 * count,  *__restrict m13 = affine + 7 * count;
+  float *__restrict m20 = affine + 8 * count,  *__restrict m21 = affine + 9 * count;
+  float *__restrict m22 = affine + 10 * count, *__restrict m23 = affine + 11 * count;
+
+  // gcc ignores restrict on locals, and there are too many arrays to check
+  // for overlap at runtime, so promise there is none (see RenderKernels)
+#if defined(__clang__)
+#pragma clang loop vectorize(assume_safety)
+#elif defined(__GNUC__)
+#pragma GCC ivdep
+#endif
+  for (size_t i = 0; i < count; ++i) {
+    const float T = t[i];
+
+    // Flip the second rotation if needed so the blend takes the shorter arc
+    const float DOT = aw[i] * bw[i] + ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+    const float TB = (DOT < 0) ? -T : T;
+    float w = (1 - T) * aw[i] + TB * bw[i];
+    float x = (1 - T) * ax[i] + TB * bx[i];
+    float y = (1 - T) * ay[i] + TB * by[i];
+    float z = (1 - T) * az[i] + TB * bz[i];
+    const float INV_LENGTH = 1.0f / sqrtf(w * w + x * x + y * y + z * z);
+    w *= INV_LENGTH;
+    x *= INV_LENGTH;
+    y *= INV_LENGTH;
+    z *= INV_LENGTH;
+
+    const float SX = asx[i] + (bsx[i] - asx[i]) * T;
+    const float SY = asy[i] + (bsy[i] - asy[i]) * T;
+    const float SZ = asz[i] + (bsz[i] - asz[i]) * T;
+
+    // Rotation matrix columns scaled by the scale factors
+    m00[i] = (1 - 2 * (y * y + z * z)) * SX;
+    m01[i] = 2 * (x * y - w * z) * SY;
+    m02[i] = 2 * (x * z + w * y) * SZ;
+    m03[i] = atx[i] + (btx[i] - atx[i]) * T;
+    m10[i] = 2 * (x * y + w * z) * SX;
+    m11[i] = (1 - 2 * (x * x + z * z)) * SY;
+    m12[i] = 2 * (y * z - w * x) * SZ;
+    m13[i] = aty[i] + (bty[i] - aty[i]) * T;
+    m20[i] = 2 * (x * z - w * y) * SX;
+    m21[i] = 2 * (y * z + w * x) * SY;
+    m22[i] = (1 - 2 * (x * x + y * y)) * SZ;
+    m23[i] = atz[i] + (btz[i] - atz[i]) * T;
+  }
+}
+
+/**
+ * @brief  In place SoA transform.  Each element is read before it is
+ *         written, so in place is safe; the arrays only need to be distinct.
+ */
+static void TransformSoAKernel(const float *__restrict affine, const float w,
+                               float *__restrict x, float *__restrict y, float *__restrict z,
+                               const size_t count) {
+  const float M00 = affine[0], M01 = affine[1], M02 = affine[2],  M03 = affine[3] * w;
+  const float M10 = affine[4], M11 = affine[5], M12 = affine[6],  M13 = affine[7] * w;
+  const float M20 = affine[8], M21 = affine[9], M22 = affine[10], M23 = affine[11] * w;
+
+  for (size_t i = 0; i < count; ++i) {
+    const float X = x[i], Y = y[i], Z = z[i];
+    x[i] = M00 * X + M01 * Y + M02 * Z + M03;
+    y[i] = M10 * X + M11 * Y + M12 * Z + M13;
+    z[i] = M20 * X + M21 * Y + M22 * Z + M23;
+  }
+}
+
+/**
+ * @brief  Particle tick.  After n steps of p += v * dt, v += a * dt:
+ *
+ *           p = p + n * dt * v + a * dt^2 * n * (n - 1) / 2
+ *           v = v + n * dt * a
+ */
+static size_t TickParticlesKernel(const float *__restrict acceleration, const float dt,
+                                  const unsigned int steps,
+                                  float *__restrict px, float *__restrict py, float *__restrict pz,
+                                  float *__restrict vx, float *__restrict vy, float *__restrict vz,
+                                  float *__restrict life, const size_t count) {
+  const float N = static_cast<float>(steps);
+  const float TIME = N * dt;
+  const float DRIFT = dt * dt * N * (N - 1) / 2;
+  const float AX = acceleration[0], AY = acceleration[1], AZ = acceleration[2];
+
+  size_t expired = 0;
+  for (size_t i = 0; i < count; ++i) {
+    px[i] += TIME * vx[i] + DRIFT * AX;
+    py[i] += TIME * vy[i] + DRIFT * AY;
+    pz[i] += TIME * vz[i] + DRIFT * AZ;
+    vx[i] += TIME * AX;
+    vy[i] += TIME * AY;
+    vz[i] += TIME * AZ;
+    life[i] -= TIME;
+    expired += (life[i] <= 0) ? 1 : 0;
+  }
+  return expired;
+}
+
+/**
+ * @brief  This translation unit's kernel table.
+ */
+const RenderKernels &KERNEL_TABLE() {
+  static const RenderKernels KERNELS = {
+    KERNEL_LEVEL,
+    TransformTuplesKernel,
+    IntersectUnitSphereKernel,
+    ShadePhongKernel,
+    QuantizePixelsKernel,
+    BlendPosesKernel,
+    TransformSoAKernel,
+    TickParticlesKernel
+  };
+  return KERNELS;
+}
+#endif
@@ -0,0 +1,12 @@
+/*
+ * kernels_avx2.cpp
+ *
+ * Render kernels for the CPU_AVX2 level, built with
+ * -mavx2 -mfma (see CMakeLists.txt).
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#define KERNEL_LEVEL CPU_AVX2
+#define KERNEL_TABLE KernelsAvx2
+#include "kernels/KernelsImpl.h"
@@ -0,0 +1,12 @@
+/*
+ * kernels_avx512.cpp
+ *
+ * Render kernels for the CPU_AVX512 level, built with
+ * -mavx512f -mavx512vl -mavx512bw -mavx512dq (see CMakeLists.txt).
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#define KERNEL_LEVEL CPU_AVX512
+#define KERNEL_TABLE KernelsAvx512
+#include "kernels/KernelsImpl.h"
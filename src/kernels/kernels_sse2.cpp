@@ -0,0 +1,12 @@
+/*
+ * kernels_sse2.cpp
+ *
+ * Render kernels for the CPU_SSE2 level: the x86-64 baseline, built
+ * without any extra instruction set flags.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#define KERNEL_LEVEL CPU_SSE2
+#define KERNEL_TABLE KernelsSse2
+#include "kernels/KernelsImpl.h"
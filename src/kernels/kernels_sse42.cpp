@@ -0,0 +1,12 @@
+/*
+ * kernels_sse42.cpp
+ *
+ * Render kernels for the CPU_SSE42 level, built with
+ * -msse4.2 -mpopcnt (see CMakeLists.txt).
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#define KERNEL_LEVEL CPU_SSE42
+#define KERNEL_TABLE KernelsSse42
+#include "kernels/KernelsImpl.h"
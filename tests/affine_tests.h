@@ -0,0 +1,100 @@
+#ifndef __AFFINE_TESTS_H_
+#define __AFFINE_TESTS_H_
+/*
+ * affine_tests.h
+ *
+ * Unit tests for AffineTransform, checked against the 4x4 matrices it
+ * specializes.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "Matrix.h"
+#include "FixedMatrix.h"
+#include "AffineTransform.h"
+#include "Transformations.h"
+#include "RaySphere.h"
+
+#include <cmath>
+
+static_assert(sizeof(AffineTransform) == 3 * sizeof(Matrix4) / 4,
+              "An affine transform is three quarters of a 4x4 matrix");
+static_assert(Inverse(ToAffine(Translation(1, 2, 3))) == ToAffine(Translation(-1, -2, -3)),
+              "Affine inverses are evaluated at compile time");
+
+SCENARIO("affine transforms match their 4x4 matrices") {
+  GIVEN("two composite transforms") {
+    const Matrix4 A = Translation(1, -2, 3) * RotY(0.7f) * Scaling(2, 0.5f, 3);
+    const Matrix4 B = Shearing(0.5f, 0, 0.2f, 0, 0, 1) * RotX(-1.2f) * Translation(-4, 0, 2);
+
+    THEN("they are affine, and a projection is not") {
+      REQUIRE(IsAffine(A));
+      REQUIRE(IsAffine(Matrix(A)));
+      Matrix projection = Identity(4);
+      projection.SetValue(3, 2, 1);
+      REQUIRE_FALSE(IsAffine(projection));
+    }
+
+    THEN("round trips through AffineTransform preserve them") {
+      REQUIRE(ToMatrix4(ToAffine(A)) == A);
+      REQUIRE(ToAffine(Matrix(B)) == ToAffine(B));
+    }
+
+    THEN("composition, determinant, and inverse match") {
+      REQUIRE(ToMatrix4(ToAffine(A) * ToAffine(B)) == A * B);
+      REQUIRE(std::fabs(Determinant(ToAffine(A)) - Determinant(A)) < 0.0001);
+      REQUIRE(ToMatrix4(Inverse(ToAffine(A))) == Inverse(A));
+      REQUIRE(ToMatrix4(Inverse(ToAffine(B))) == Inverse(B));
+      REQUIRE(ToAffine(A) * Inverse(ToAffine(A)) == AffineTransform());
+    }
+
+    THEN("points, vectors, and normals transform the same way") {
+      const Tuple PT  = Point(0.3f, -1.5f, 2);
+      const Tuple VEC = Vector(-1, 0.25f, 4);
+      REQUIRE(TransformPoint(ToAffine(A), PT) == A * PT);
+      REQUIRE(TransformVector(ToAffine(A), VEC) == A * VEC);
+      REQUIRE(ToAffine(A) * PT == A * PT);
+      REQUIRE(ToAffine(A) * VEC == A * VEC);
+
+      const Tuple NORMAL = Transpose(Inverse(A)) * VEC;
+      REQUIRE(TransformNormal(Inverse(ToAffine(A)), VEC) == Vector(NORMAL.X(), NORMAL.Y(), NORMAL.Z()));
+    }
+  }
+
+  GIVEN("a sphere with an affine transform and one without") {
+    Sphere affine;
+    affine.SetTransform(Translation(0, 1, 0) * Scaling(2, 2, 2));
+
+    // The same transform, with a scaled bottom row (a projective matrix
+    // that maps to the same points)
+    Matrix scaled = Translation(0, 1, 0) * Scaling(2, 2, 2);
+    for (int y = 0; y < 4; ++y) {
+      for (int x = 0; x < 4; ++x) {
+        scaled.SetValue(y, x, scaled.GetValue(y, x) * 2);
+      }
+    }
+    Sphere projective;
+    projective.SetTransform(scaled);
+
+    THEN("only the affine one caches its inverse") {
+      REQUIRE(affine.HasAffineTransform());
+      REQUIRE_FALSE(projective.HasAffineTransform());
+      REQUIRE(affine.AffineInverse() == ToAffine(Inverse(Translation(0, 1, 0) * Scaling(2, 2, 2))));
+    }
+
+    THEN("the affine sphere is intersected at the expected distances") {
+      const Ray RAY(Point(0.5f, 1, -5), Vector(0, 0, 1));
+      const std::vector<Intersection> AFFINE_HITS = Intersect(affine, RAY);
+      REQUIRE(AFFINE_HITS.size() == 2);
+      REQUIRE(std::fabs(AFFINE_HITS[0].T() - (5 - std::sqrt(3.75f))) < 0.0001);
+      REQUIRE(std::fabs(AFFINE_HITS[1].T() - (5 + std::sqrt(3.75f))) < 0.0001);
+    }
+
+    THEN("the affine sphere's normal is correct") {
+      const Tuple PT = Point(0, 1 + std::sqrt(2.0f), std::sqrt(2.0f));
+      REQUIRE(affine.NormalAt(PT) == Vector(0, std::sqrt(2.0f) / 2, std::sqrt(2.0f) / 2));
+    }
+  }
+}
+#endif
@@ -0,0 +1,72 @@
+#ifndef __ANIMATION_TESTS_H_
+#define __ANIMATION_TESTS_H_
+/*
+ * animation_tests.h
+ *
+ * Unit tests for keyframed transforms.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Animation.h"
+#include "Transformations.h"
+
+#include <cmath>
+
+SCENARIO("keyframes are composed into transforms", "[Animation]") {
+  GIVEN("a keyframe with a translation, rotation, and scale") {
+    const Keyframe KEY(0, Vector(1, 2, 3), Vector(0, M_PI/2, 0), Vector(2, 2, 2));
+
+    THEN("the point is scaled, then rotated, then translated") {
+      const Tuple PT = KeyframeTransform(KEY) * Point(1, 0, 0);
+      REQUIRE(PT == Point(1, 2, 1));
+    }
+  }
+
+  GIVEN("two keyframes") {
+    const Keyframe A(1, Vector(0, 0, 0), Vector(0, 0, 0), Vector(1, 1, 1));
+    const Keyframe B(3, Vector(4, 0, 0), Vector(0, 1, 0), Vector(3, 1, 1));
+
+    THEN("the pose halfway between them is interpolated") {
+      const Keyframe MID = InterpolateKeyframes(A, B, 2);
+      REQUIRE(FloatCompare(MID.time, 2) == true);
+      REQUIRE(MID.translation == Vector(2, 0, 0));
+      REQUIRE(MID.rotation    == Vector(0, 0.5, 0));
+      REQUIRE(MID.scale       == Vector(2, 1, 1));
+    }
+  }
+}
+
+SCENARIO("objects follow transform tracks", "[Animation]") {
+  TransformTrack track;
+  track.AddKey(Keyframe(1, Vector(2, 0, 0), Vector(0, 0, 0), Vector(1, 1, 1)));
+  track.AddKey(Keyframe(0, Vector(0, 0, 0), Vector(0, 0, 0), Vector(1, 1, 1)));
+
+  GIVEN("a track with keys added out of order") {
+    THEN("the keys are evaluated in time order") {
+      REQUIRE(track.NumKeys() == 2);
+      REQUIRE(track.Evaluate(0.25).translation == Vector(0.5, 0, 0));
+    }
+
+    THEN("times outside of the track hold the nearest key") {
+      REQUIRE(track.Evaluate(-1).translation == Vector(0, 0, 0));
+      REQUIRE(track.Evaluate(5).translation  == Vector(2, 0, 0));
+    }
+  }
+
+  GIVEN("an animation of the second object in the default world") {
+    World world = DefaultWorld();
+    Animation animation;
+    animation.AddTrack(1, track);
+
+    WHEN("it is applied halfway through") {
+      animation.Apply(world, 0.5);
+
+      THEN("only the animated object moves") {
+        REQUIRE(world.Objects()[1].Transform() == Translation(1, 0, 0));
+        REQUIRE(world.Objects()[0].Transform() == DefaultWorld().Objects()[0].Transform());
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,169 @@
+#ifndef __ANTIALIASING_TESTS_H_
+#define __ANTIALIASING_TESTS_H_
+/*
+ * antialiasing_tests.h
+ *
+ * Unit tests for adaptive supersampling.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "AntiAliasing.h"
+#include "Transformations.h"
+
+#include <atomic>
+#include <cmath>
+
+SCENARIO("an image is rendered with adaptive anti-aliasing", "[AntiAliasing]") {
+  TileScheduler scheduler(2);
+  AntiAliasOptions options;
+  options.tileSize = 4;
+
+  GIVEN("an image with no edges") {
+    const SampleFunction FLAT = [](const float, const float, int &id) {
+      id = 1;
+      return Color(0.5, 0.5, 0.5);
+    };
+    Canvas canvas(10, 10);
+
+    WHEN("it is rendered") {
+      const AntiAliasStats STATS = RenderAdaptive(FLAT, canvas, options, scheduler);
+
+      THEN("no pixel is refined") {
+        REQUIRE(STATS.pixels        == 100);
+        REQUIRE(STATS.refinedPixels == 0);
+        REQUIRE(STATS.samples       == 400);
+        REQUIRE(FloatCompare(STATS.AverageSamplesPerPixel(), 4.0) == true);
+        REQUIRE(canvas.PixelAt(5, 5) == Color(0.5, 0.5, 0.5));
+      }
+    }
+  }
+
+  GIVEN("an image where every sample hits a different object") {
+    std::atomic<int> calls(0);
+    const SampleFunction NOISE = [&calls](const float, const float, int &id) {
+      id = calls++;
+      return Color(0.5, 0.5, 0.5);
+    };
+    Canvas canvas(6, 5);
+
+    WHEN("it is rendered") {
+      const AntiAliasStats STATS = RenderAdaptive(NOISE, canvas, options, scheduler);
+
+      THEN("every pixel takes exactly 4^(maxSubdivisions+1) samples") {
+        REQUIRE(STATS.refinedPixels == 30);
+        REQUIRE(STATS.samples == calls.load());
+        REQUIRE(STATS.samples == 30 * 64);
+      }
+    }
+  }
+
+  GIVEN("a tile size below one") {
+    const SampleFunction FLAT = [](const float, const float, int &id) {
+      id = 1;
+      return Color(0.5, 0.5, 0.5);
+    };
+    AntiAliasOptions badOptions;
+    badOptions.tileSize = 0;
+    Canvas canvas(6, 6);
+
+    WHEN("it is rendered") {
+      const AntiAliasStats STATS = RenderAdaptive(FLAT, canvas, badOptions, scheduler);
+
+      THEN("every pixel is still rendered") {
+        REQUIRE(STATS.pixels == 36);
+        REQUIRE(canvas.PixelAt(5, 5) == Color(0.5, 0.5, 0.5));
+      }
+    }
+  }
+
+  GIVEN("a vertical edge between two objects") {
+    const SampleFunction EDGE = [](const float x, const float, int &id) {
+      id = (x < 5.3f) ? 1 : 2;
+      return (x < 5.3f) ? Color(1, 1, 1) : Color(0, 0, 0);
+    };
+    Canvas canvas(12, 8);
+
+    WHEN("it is rendered") {
+      const AntiAliasStats STATS = RenderAdaptive(EDGE, canvas, options, scheduler);
+
+      THEN("only pixels along the edge are refined") {
+        REQUIRE(STATS.refinedPixels > 0);
+        REQUIRE(STATS.refinedPixels <= 3 * 8);
+        REQUIRE(STATS.AverageSamplesPerPixel() > 4.0);
+        REQUIRE(STATS.AverageSamplesPerPixel() < 16.0);
+      }
+
+      THEN("the edge pixel holds the area covered by each side") {
+        REQUIRE(std::fabs(canvas.PixelAt(5, 3).Red() - 0.3) < 0.07);
+        REQUIRE(canvas.PixelAt(2, 3)  == Color(1, 1, 1));
+        REQUIRE(canvas.PixelAt(9, 3)  == Color(0, 0, 0));
+      }
+    }
+  }
+
+  GIVEN("two objects of the same color") {
+    const SampleFunction SAME_COLOR = [](const float x, const float, int &id) {
+      id = (x < 4.5f) ? 1 : 2;
+      return Color(0.2, 0.2, 0.2);
+    };
+    Canvas canvas(8, 8);
+
+    WHEN("it is rendered") {
+      const AntiAliasStats STATS = RenderAdaptive(SAME_COLOR, canvas, options, scheduler);
+
+      THEN("the object ID discontinuity is refined") {
+        REQUIRE(STATS.refinedPixels > 0);
+      }
+    }
+  }
+
+  GIVEN("refinement is disabled") {
+    options.maxSubdivisions = 0;
+    const SampleFunction EDGE = [](const float x, const float, int &id) {
+      id = (x < 5.3f) ? 1 : 2;
+      return (x < 5.3f) ? Color(1, 1, 1) : Color(0, 0, 0);
+    };
+    Canvas canvas(12, 8);
+
+    WHEN("it is rendered") {
+      const AntiAliasStats STATS = RenderAdaptive(EDGE, canvas, options, scheduler);
+
+      THEN("every pixel takes exactly four samples") {
+        REQUIRE(FloatCompare(STATS.AverageSamplesPerPixel(), 4.0) == true);
+      }
+    }
+  }
+
+  GIVEN("the default world and a camera") {
+    const World WORLD = DefaultWorld();
+    Camera camera(11, 11, M_PI/2);
+    camera.SetTransform(ViewTransform(Point(0, 0, -5), Point(0, 0, 0), Vector(0, 1, 0)));
+
+    WHEN("the world is rendered") {
+      Canvas canvas(11, 11);
+      const AntiAliasStats STATS = RenderAdaptive(camera, WORLD, canvas, options, scheduler);
+
+      THEN("the sphere's silhouette is refined and its center is shaded") {
+        // The center pixel's average color, from 32x32 evenly spaced samples
+        Color expected;
+        for (int i = 0; i < 32; ++i) {
+          for (int j = 0; j < 32; ++j) {
+            int id;
+            expected += TraceSample(WORLD, RayForPixel(camera, 5, 5, (i + 0.5f) / 32,
+                                                       (j + 0.5f) / 32), id);
+          }
+        }
+        expected = expected * (1.0f / (32 * 32));
+
+        const Color CENTER = canvas.PixelAt(5, 5);
+        REQUIRE(STATS.refinedPixels > 0);
+        REQUIRE(STATS.refinedPixels < 121);
+        REQUIRE(std::fabs(CENTER.Red()   - expected.Red())   < 0.01);
+        REQUIRE(std::fabs(CENTER.Green() - expected.Green()) < 0.01);
+        REQUIRE(std::fabs(CENTER.Blue()  - expected.Blue())  < 0.01);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,97 @@
+#ifndef __ASYNC_WRITER_TESTS_H_
+#define __ASYNC_WRITER_TESTS_H_
+/*
+ * async_writer_tests.h
+ *
+ * Unit tests for the asynchronous image writer.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "AsyncImageWriter.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+// Reads the first line of a file (empty if it cannot be opened)
+std::string FirstLine(const std::string &filename) {
+  char line[64] = {0};
+  FILE *input = fopen(filename.c_str(), "rb");
+  if (input) {
+    if (!fgets(line, sizeof(line), input)) {
+      line[0] = '\0';
+    }
+    fclose(input);
+  }
+  return line;
+}
+
+SCENARIO("canvases are written in the background", "[AsyncImageWriter]") {
+  const std::string PREFIX = "/tmp/async_writer_test_" + std::to_string(getpid()) + "_";
+
+  AsyncWriterOptions options;
+  options.buffers = 2;
+
+  GIVEN("a writer with two buffers") {
+    AsyncImageWriter writer(4, 3, options);
+    REQUIRE(writer.NumBuffers() == 2);
+
+    WHEN("more frames than buffers are submitted") {
+      for (int i = 0; i < 5; ++i) {
+        Canvas *buffer = writer.Acquire();
+        buffer->WritePixel(0, 0, Color(1, 0, 0));
+        writer.Submit(buffer, PREFIX + std::to_string(i) + ".ppm");
+      }
+      const bool FLUSHED = writer.Flush();
+
+      THEN("every file is written once flushed") {
+        REQUIRE(FLUSHED == true);
+        REQUIRE(writer.FilesWritten() == 5);
+        for (int i = 0; i < 5; ++i) {
+          const std::string NAME = PREFIX + std::to_string(i) + ".ppm";
+          REQUIRE(FirstLine(NAME) == "P3\n");
+          remove(NAME.c_str());
+        }
+      }
+    }
+
+    WHEN("every buffer is in use") {
+      Canvas *first  = writer.Acquire();
+      Canvas *second = writer.Acquire();
+
+      std::atomic<bool> acquired(false);
+      std::thread renderer([&]() {
+        writer.Release(writer.Acquire());
+        acquired = true;
+      });
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      const bool ACQUIRED_WHILE_FULL = acquired;
+      writer.Release(first);
+      renderer.join();
+      writer.Release(second);
+
+      THEN("Acquire() waits for a buffer to be returned") {
+        REQUIRE(ACQUIRED_WHILE_FULL == false);
+        REQUIRE(acquired == true);
+        REQUIRE(writer.StallSeconds() > 0.0);
+      }
+    }
+
+    WHEN("a file cannot be created") {
+      writer.Submit(writer.Acquire(), "/nonexistent_directory/frame.ppm");
+
+      THEN("the failure is reported by Flush()") {
+        REQUIRE(writer.Flush() == false);
+        REQUIRE(writer.Flush() == true);
+        REQUIRE(writer.FilesWritten() == 0);
+      }
+    }
+  }
+}
+#endif
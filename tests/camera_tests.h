@@ -0,0 +1,102 @@
+#ifndef __CAMERA_TESTS_H_
+#define __CAMERA_TESTS_H_
+/*
+ * camera_tests.h
+ *
+ * Unit tests for the Camera class and the view transformation.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Camera.h"
+#include "Transformations.h"
+
+#include <cmath>
+
+SCENARIO("a view transformation is constructed", "[Camera]") {
+  GIVEN("the default orientation") {
+    const Matrix T = ViewTransform(Point(0, 0, 0), Point(0, 0, -1), Vector(0, 1, 0));
+    THEN("the transformation is the identity matrix") {
+      REQUIRE(T == Identity(4));
+    }
+  }
+
+  GIVEN("an eye looking in the positive z direction") {
+    const Matrix T = ViewTransform(Point(0, 0, 0), Point(0, 0, 1), Vector(0, 1, 0));
+    THEN("the world is mirrored") {
+      REQUIRE(T == Scaling(-1, 1, -1));
+    }
+  }
+
+  GIVEN("an eye that has moved") {
+    const Matrix T = ViewTransform(Point(0, 0, 8), Point(0, 0, 0), Vector(0, 1, 0));
+    THEN("the world is moved") {
+      REQUIRE(T == Translation(0, 0, -8));
+    }
+  }
+}
+
+SCENARIO("a camera is used", "[Camera]") {
+  GIVEN("a camera is constructed") {
+    const Camera CAMERA(160, 120, M_PI/2);
+    THEN("it is initialized correctly") {
+      REQUIRE(CAMERA.HSize() == 160);
+      REQUIRE(CAMERA.VSize() == 120);
+      REQUIRE(FloatCompare(CAMERA.FieldOfView(), M_PI/2) == true);
+      REQUIRE(CAMERA.Transform() == Identity(4));
+    }
+  }
+
+  GIVEN("horizontal and vertical canvases") {
+    const Camera HORIZONTAL(200, 125, M_PI/2);
+    const Camera VERTICAL(125, 200, M_PI/2);
+    THEN("the pixel sizes are correct") {
+      REQUIRE(FloatCompare(HORIZONTAL.PixelSize(), 0.01) == true);
+      REQUIRE(FloatCompare(VERTICAL.PixelSize(), 0.01)   == true);
+    }
+  }
+
+  GIVEN("a camera") {
+    Camera camera(201, 101, M_PI/2);
+
+    WHEN("a ray is constructed through the center of the canvas") {
+      const Ray RAY = RayForPixel(camera, 100, 50);
+      THEN("it points straight ahead") {
+        REQUIRE(RAY.Origin()    == Point(0, 0, 0));
+        REQUIRE(RAY.Direction() == Vector(0, 0, -1));
+      }
+    }
+
+    WHEN("a ray is constructed through a corner of the canvas") {
+      const Ray RAY = RayForPixel(camera, 0, 0);
+      THEN("it points towards the corner") {
+        REQUIRE(RAY.Origin()    == Point(0, 0, 0));
+        REQUIRE(RAY.Direction() == Vector(0.66519, 0.33259, -0.66851));
+      }
+    }
+
+    WHEN("the camera is transformed") {
+      camera.SetTransform(RotY(M_PI/4) * Translation(0, -2, 5));
+      const Ray RAY = RayForPixel(camera, 100, 50);
+      THEN("the ray is transformed") {
+        REQUIRE(RAY.Origin()    == Point(0, 2, -5));
+        REQUIRE(RAY.Direction() == Vector(sqrt(2)/2, 0, -sqrt(2)/2));
+      }
+    }
+  }
+
+  GIVEN("the default world and a camera") {
+    const World WORLD = DefaultWorld();
+    Camera camera(11, 11, M_PI/2);
+    camera.SetTransform(ViewTransform(Point(0, 0, -5), Point(0, 0, 0), Vector(0, 1, 0)));
+
+    WHEN("the world is rendered") {
+      Canvas canvas(11, 11);
+      Render(camera, WORLD, canvas);
+      THEN("the center pixel is shaded") {
+        REQUIRE(canvas.PixelAt(5, 5) == Color(0.38066, 0.47583, 0.2855));
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,169 @@
+#ifndef __CANVAS_DIFF_TESTS_H_
+#define __CANVAS_DIFF_TESTS_H_
+/*
+ * canvas_diff_tests.h
+ *
+ * Unit tests for comparing canvases, and regression checks of every
+ * optimized render path against the reference scalar renderer.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "CanvasDiff.h"
+#include "Camera.h"
+#include "Scenes.h"
+#include "TileScheduler.h"
+#include "RenderServer.h"
+#include "IncrementalRenderer.h"
+#include "SequenceRenderer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+SCENARIO("canvases are compared", "[CanvasDiff]") {
+  Canvas a(4, 2), b(4, 2);
+  for (int y = 0; y < 2; ++y) {
+    for (int x = 0; x < 4; ++x) {
+      a.WritePixel(x, y, Color(0.25, 0.5, 0.75));
+      b.WritePixel(x, y, Color(0.25, 0.5, 0.75));
+    }
+  }
+
+  GIVEN("identical canvases") {
+    CanvasDiffStats stats;
+    REQUIRE(CompareCanvases(a, b, stats) == true);
+
+    THEN("there is no difference") {
+      REQUIRE(stats.maxError == 0.0f);
+      REQUIRE(stats.meanError == 0.0);
+      REQUIRE(std::isinf(stats.psnr));
+      REQUIRE(stats.visiblePixels == 0);
+      REQUIRE(stats.worstX == -1);
+    }
+  }
+
+  GIVEN("canvases differing in one pixel") {
+    b.WritePixel(3, 1, Color(0.25, 0.0, 0.75));
+    CanvasDiffStats stats;
+    Canvas heatmap(4, 2);
+    REQUIRE(CompareCanvases(a, b, stats, &heatmap, 0.5) == true);
+
+    THEN("the difference is measured and located") {
+      REQUIRE(std::fabs(stats.maxError - 0.5) < 0.0001);
+      REQUIRE(std::fabs(stats.meanError - 0.5 / 24) < 0.0001);
+      REQUIRE(std::fabs(stats.rmse - std::sqrt(0.25 / 24)) < 0.0001);
+      REQUIRE(std::fabs(stats.psnr - 10 * std::log10(24 / 0.25)) < 0.001);
+      REQUIRE(stats.visiblePixels == 1);
+      REQUIRE(stats.worstX == 3);
+      REQUIRE(stats.worstY == 1);
+    }
+
+    THEN("the heatmap is white at the difference and black elsewhere") {
+      REQUIRE(heatmap.PixelAt(3, 1) == Color(1, 1, 1));
+      REQUIRE(heatmap.PixelAt(0, 0) == Color(0, 0, 0));
+    }
+  }
+
+  GIVEN("values outside of the displayable range") {
+    a.WritePixel(0, 0, Color(2, 0.5, 0.75));
+    b.WritePixel(0, 0, Color(5, 0.5, 0.75));
+    CanvasDiffStats stats;
+    REQUIRE(CompareCanvases(a, b, stats) == true);
+
+    THEN("differences that cannot be displayed are ignored") {
+      REQUIRE(stats.maxError == 0.0f);
+    }
+  }
+
+  GIVEN("canvases of different sizes") {
+    Canvas c(3, 2);
+    CanvasDiffStats stats;
+
+    THEN("they cannot be compared") {
+      REQUIRE(CompareCanvases(a, c, stats) == false);
+    }
+  }
+}
+
+SCENARIO("optimized render paths match the reference renderer", "[CanvasDiff]") {
+  // Largest difference allowed in any channel.  The optimized paths run the
+  // same math today; this leaves room for approximations such as fast math.
+  const float TOLERANCE = 0.0001f;
+
+  Scene scene;
+  REQUIRE(BuildScene("glassspheres", scene) == true);
+  const Camera CAMERA = SceneCamera(scene, 40, 20);
+
+  // The reference: single threaded, pixel by pixel
+  Canvas reference(CAMERA.HSize(), CAMERA.VSize());
+  Render(CAMERA, scene.world, reference);
+
+  TileScheduler scheduler(3);
+  CanvasDiffStats stats;
+
+  GIVEN("tiles traced on the scheduler") {
+    Canvas canvas(CAMERA.HSize(), CAMERA.VSize());
+    scheduler.Run(MakeTiles(CAMERA.HSize(), CAMERA.VSize(), 8), [&](const Tile &tile, const int) {
+      const std::vector<Color> PIXELS = TraceTile(scene.world, CAMERA, tile);
+      for (int y = tile.y0; y < tile.y1; ++y) {
+        for (int x = tile.x0; x < tile.x1; ++x) {
+          canvas.WritePixel(x, y, PIXELS[(y - tile.y0) * (tile.x1 - tile.x0) + (x - tile.x0)]);
+        }
+      }
+    });
+
+    THEN("they match the reference") {
+      REQUIRE(CompareCanvases(reference, canvas, stats) == true);
+      REQUIRE(stats.maxError <= TOLERANCE);
+    }
+  }
+
+  GIVEN("the incremental renderer") {
+    World world = scene.world;
+    IncrementalRenderer renderer(world, CAMERA, scheduler, 8);
+    Canvas canvas(CAMERA.HSize(), CAMERA.VSize());
+    renderer.Update(canvas);
+
+    THEN("its first frame matches the reference") {
+      REQUIRE(CompareCanvases(reference, canvas, stats) == true);
+      REQUIRE(stats.maxError <= TOLERANCE);
+    }
+  }
+
+  GIVEN("the pipelined sequence renderer") {
+    const Animation ANIMATION;
+    SequenceOptions options;
+    options.frames = 1;
+    SequenceRenderer renderer(scene.world, ANIMATION, CAMERA, scheduler, options);
+
+    Canvas canvas(CAMERA.HSize(), CAMERA.VSize());
+    renderer.Render([&](const int, const Canvas &frame) {
+      for (int y = 0; y < frame.GetHeight(); ++y) {
+        for (int x = 0; x < frame.GetWidth(); ++x) {
+          canvas.WritePixel(x, y, frame.PixelAt(x, y));
+        }
+      }
+    });
+
+    THEN("its frame matches the reference") {
+      REQUIRE(CompareCanvases(reference, canvas, stats) == true);
+      REQUIRE(stats.maxError <= TOLERANCE);
+    }
+  }
+
+  GIVEN("the reference saved as a PPM file") {
+    reference.WriteToPPM("regression_reference.ppm");
+    Canvas saved(1, 1);
+    const bool READ = saved.ReadFromPPM("regression_reference.ppm");
+    remove("regression_reference.ppm");
+
+    THEN("it reads back within 8 bit precision") {
+      REQUIRE(READ == true);
+      REQUIRE(CompareCanvases(reference, saved, stats) == true);
+      REQUIRE(stats.maxError <= 1.0f / 255);
+      REQUIRE(stats.psnr > 45);
+    }
+  }
+}
+#endif
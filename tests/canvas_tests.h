@@ -12,6 +12,10 @@
 
 #include "Canvas.h"
 
+#include <cmath>
+#include <cstdio>
+#include <string>
+
 // Canvas tests
 SCENARIO("a canvas is needed", "[Canvas]") {
   GIVEN("a canvas is constructed") {
@@ -41,6 +45,18 @@ SCENARIO("a canvas is needed", "[Canvas]") {
     } 
   }
 
+  GIVEN("pixels are written onto the edges of the canvas") {
+    Canvas canvas(10, 20);
+    canvas.WritePixel(0, 0, Color(0, 1, 0));
+    canvas.WritePixel(9, 19, Color(0, 0, 1));
+    canvas.WritePixel(10, 20, Color(1, 1, 1));
+
+    THEN("pixels inside the canvas are written and pixels outside are ignored") {
+      REQUIRE(canvas.PixelAt(0, 0)  == Color(0, 1, 0));
+      REQUIRE(canvas.PixelAt(9, 19) == Color(0, 0, 1));
+    }
+  }
+
   GIVEN("an empty PPM image is written") {
     Canvas canvas(5, 3);
     canvas.WriteToPPM("output.ppm");
@@ -60,4 +76,80 @@ SCENARIO("a canvas is needed", "[Canvas]") {
     }
   }
 }
+
+// Writes text to a file
+void WriteTextFile(const char *filename, const std::string &text) {
+  FILE *output = fopen(filename, "wb");
+  if(output) {
+    fwrite(text.data(), 1, text.size(), output);
+    fclose(output);
+  }
+}
+
+SCENARIO("a canvas is read from a PPM file", "[Canvas]") {
+  GIVEN("a canvas written as a PPM file") {
+    Canvas canvas(4, 3);
+    canvas.WritePixel(0, 0, Color(1, 0, 0));
+    canvas.WritePixel(3, 2, Color(0.5, 1, 0.25));
+    canvas.WriteToPPM("read_test.ppm");
+
+    WHEN("it is read back into a canvas of another size") {
+      Canvas read(1, 1);
+      const bool READ = read.ReadFromPPM("read_test.ppm");
+      remove("read_test.ppm");
+
+      THEN("the size and pixels match to 8 bit precision") {
+        REQUIRE(READ == true);
+        REQUIRE(read.GetWidth() == 4);
+        REQUIRE(read.GetHeight() == 3);
+        for(int y = 0; y < 3; ++y) {
+          for(int x = 0; x < 4; ++x) {
+            const Color WRITTEN = canvas.PixelAt(x, y);
+            const Color PIXEL = read.PixelAt(x, y);
+            REQUIRE(std::fabs(PIXEL.Red() - WRITTEN.Red()) <= 1.0 / 255);
+            REQUIRE(std::fabs(PIXEL.Green() - WRITTEN.Green()) <= 1.0 / 255);
+            REQUIRE(std::fabs(PIXEL.Blue() - WRITTEN.Blue()) <= 1.0 / 255);
+          }
+        }
+      }
+    }
+  }
+
+  GIVEN("binary PPM files with comments and 16 bit samples") {
+    WriteTextFile("read_test_8.ppm", std::string("P6\n# comment\n2 1\n255\n\xff\x00\x33\x00\x80\xff", 27));
+    WriteTextFile("read_test_16.ppm", std::string("P6 1 1 65535\n\xff\xff\x80\x00\x00\x00", 19));
+
+    WHEN("they are read") {
+      Canvas eight(1, 1), sixteen(1, 1);
+      const bool READ_8  = eight.ReadFromPPM("read_test_8.ppm");
+      const bool READ_16 = sixteen.ReadFromPPM("read_test_16.ppm");
+      remove("read_test_8.ppm");
+      remove("read_test_16.ppm");
+
+      THEN("samples are scaled by the maximum value") {
+        REQUIRE(READ_8 == true);
+        REQUIRE(eight.GetWidth() == 2);
+        REQUIRE(eight.PixelAt(0, 0) == Color(1, 0, 0.2));
+        REQUIRE(eight.PixelAt(1, 0) == Color(0, 128 / 255.0, 1));
+
+        REQUIRE(READ_16 == true);
+        REQUIRE(sixteen.PixelAt(0, 0) == Color(1, 32768 / 65535.0, 0));
+      }
+    }
+  }
+
+  GIVEN("malformed PPM files") {
+    WriteTextFile("read_test_bad.ppm", "P3\n2 2\n255\n1 2 3 4 5 6\n");
+    Canvas canvas(3, 1);
+    canvas.WritePixel(0, 0, Color(1, 1, 1));
+
+    THEN("reading fails and the canvas is unchanged") {
+      REQUIRE(canvas.ReadFromPPM("read_test_bad.ppm") == false);
+      REQUIRE(canvas.ReadFromPPM("read_test_missing.ppm") == false);
+      REQUIRE(canvas.GetWidth() == 3);
+      REQUIRE(canvas.PixelAt(0, 0) == Color(1, 1, 1));
+      remove("read_test_bad.ppm");
+    }
+  }
+}
 #endif
@@ -0,0 +1,101 @@
+#ifndef __COUNTERS_TESTS_H_
+#define __COUNTERS_TESTS_H_
+/*
+ * counters_tests.h
+ *
+ * Unit tests for per-pixel cost counters and heatmaps.  The tests are
+ * built with RENDER_COUNTERS defined.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "CostHeatmap.h"
+#include "CanvasDiff.h"
+#include "Transformations.h"
+
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+SCENARIO("pixel costs are counted while rendering", "[PixelCounters]") {
+  const World WORLD = DefaultWorld();
+  Camera camera(11, 11, M_PI/2);
+  camera.SetTransform(ViewTransform(Point(0, 0, -5), Point(0, 0, 0), Vector(0, 1, 0)));
+
+  REQUIRE(PixelCountersEnabled() == true);
+
+  GIVEN("a frame rendered with counters") {
+    Canvas canvas(11, 11);
+    TileScheduler scheduler(2);
+    std::vector<PixelCounters> counters;
+    const PixelCounters TOTAL = RenderWithCounters(camera, WORLD, canvas, scheduler, counters);
+
+    THEN("the frame matches the uninstrumented renderer") {
+      Canvas reference(11, 11);
+      Render(camera, WORLD, reference);
+      CanvasDiffStats stats;
+      REQUIRE(CompareCanvases(reference, canvas, stats) == true);
+      REQUIRE(stats.maxError == 0.0f);
+    }
+
+    THEN("a pixel that misses everything casts only its primary ray") {
+      const PixelCounters &CORNER = counters[0];
+      REQUIRE(CORNER.rays == 1);
+      REQUIRE(CORNER.intersects == 2);
+      REQUIRE(CORNER.shades == 0);
+    }
+
+    THEN("a pixel on the sphere also shades and casts a shadow ray") {
+      const PixelCounters &CENTER = counters[5 * 11 + 5];
+      REQUIRE(CENTER.rays == 2);
+      REQUIRE(CENTER.intersects == 4);
+      REQUIRE(CENTER.shades == 1);
+      REQUIRE(CENTER.cycles > 0);
+    }
+
+    THEN("the totals add up the pixels") {
+      uint64_t rays = 0;
+      for (size_t i = 0; i < counters.size(); ++i) {
+        rays += counters[i].rays;
+      }
+      REQUIRE(TOTAL.rays == rays);
+      REQUIRE(TOTAL.intersects == 2 * rays);
+    }
+
+    THEN("no counters are charged outside of the render") {
+      REQUIRE(ActivePixelCounters() == NULL);
+    }
+
+    WHEN("the counters are drawn as heatmaps") {
+      Canvas heatmap(11, 11);
+      CounterHeatmap(counters, COUNTER_RAYS, heatmap);
+
+      THEN("pixels with more rays are brighter") {
+        REQUIRE(heatmap.PixelAt(0, 0).Green() < heatmap.PixelAt(5, 5).Green());
+        REQUIRE(heatmap.PixelAt(5, 5) == Color(1, 1, 1));
+      }
+    }
+
+    WHEN("the heatmaps are written") {
+      const std::string PREFIX = "/tmp/counters_test_" + std::to_string(getpid());
+      const bool WRITTEN = WriteCounterHeatmaps(counters, 11, 11, PREFIX);
+
+      THEN("one image is written per counter") {
+        REQUIRE(WRITTEN == true);
+        const char *NAMES[] = {"rays", "intersects", "shades", "cycles"};
+        for (int i = 0; i < 4; ++i) {
+          const std::string NAME = PREFIX + "_" + NAMES[i] + ".ppm";
+          Canvas read(1, 1);
+          REQUIRE(read.ReadFromPPM(NAME.c_str()) == true);
+          REQUIRE(read.GetWidth() == 11);
+          remove(NAME.c_str());
+        }
+        REQUIRE(WriteCounterHeatmaps(counters, 10, 11, PREFIX) == false);
+      }
+    }
+  }
+}
+#endif
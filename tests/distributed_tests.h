@@ -0,0 +1,252 @@
+#ifndef __DISTRIBUTED_TESTS_H_
+#define __DISTRIBUTED_TESTS_H_
+/*
+ * distributed_tests.h
+ *
+ * Unit tests for distributed rendering.  Workers run as separate processes
+ * forked from the test.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "DistributedRender.h"
+#include "Scenes.h"
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+
+// Forks a worker process that connects to the coordinator after a delay
+pid_t StartWorkerProcess(const int port, const int delayMs, const std::string &token = "") {
+  const pid_t PID = fork();
+  if (PID == 0) {
+    usleep(delayMs * 1000);
+    RenderWorker worker(1);
+    _exit(worker.Run("127.0.0.1", port, token) ? 0 : 1);
+  }
+  return PID;
+}
+
+/*
+ * Forks a worker process that takes its first range and then either exits
+ * (crash) or never answers (stall)
+ */
+pid_t StartFaultyWorkerProcess(const int port, const bool stall) {
+  const pid_t PID = fork();
+  if (PID == 0) {
+    const int FD = ConnectTcp("127.0.0.1", port);
+    SendMessage(FD, MSG_HELLO, "");
+
+    uint32_t type = 0;
+    std::string payload;
+    while (type != MSG_ASSIGN && ReceiveMessage(FD, type, payload)) {
+    }
+    if (stall) {
+      sleep(60);
+    }
+    _exit(1);
+  }
+  return PID;
+}
+
+// Checks that a canvas matches a local render of the job
+bool MatchesLocalRender(const RenderJob &job, const Canvas &canvas) {
+  Scene scene;
+  BuildScene(job.scene, scene);
+  Canvas expected(job.width, job.height);
+  Render(SceneCamera(scene, job.width, job.height), scene.world, expected);
+
+  for (int y = 0; y < job.height; ++y) {
+    for (int x = 0; x < job.width; ++x) {
+      if (!(canvas.PixelAt(x, y) == expected.PixelAt(x, y))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+SCENARIO("a frame is rendered by worker processes", "[DistributedRender]") {
+  RenderJob job;
+  job.width    = 24;
+  job.height   = 16;
+  job.tileSize = 4;
+
+  CoordinatorOptions options;
+  options.rangeSize      = 2;
+  options.timeoutSeconds = 20;
+
+  RenderCoordinator coordinator;
+  REQUIRE(coordinator.Listen() == true);
+  Canvas canvas(job.width, job.height);
+  DistributedStats stats;
+
+  GIVEN("two healthy workers") {
+    const pid_t FIRST  = StartWorkerProcess(coordinator.Port(), 0);
+    const pid_t SECOND = StartWorkerProcess(coordinator.Port(), 0);
+
+    WHEN("the frame is rendered") {
+      const bool SUCCESS = coordinator.Render(job, canvas, options, stats);
+      coordinator.Shutdown();
+
+      int firstStatus = -1, secondStatus = -1;
+      waitpid(FIRST, &firstStatus, 0);
+      waitpid(SECOND, &secondStatus, 0);
+
+      THEN("every tile is assembled into the canvas") {
+        REQUIRE(SUCCESS == true);
+        REQUIRE(stats.tiles == 24);
+        REQUIRE(stats.workersLost == 0);
+        REQUIRE(MatchesLocalRender(job, canvas) == true);
+      }
+
+      THEN("the workers exit cleanly when shut down") {
+        REQUIRE(WIFEXITED(firstStatus));
+        REQUIRE(WEXITSTATUS(firstStatus) == 0);
+        REQUIRE(WIFEXITED(secondStatus));
+        REQUIRE(WEXITSTATUS(secondStatus) == 0);
+      }
+    }
+  }
+
+  GIVEN("a worker that dies holding a range") {
+    const pid_t CRASHING = StartFaultyWorkerProcess(coordinator.Port(), false);
+    const pid_t HEALTHY  = StartWorkerProcess(coordinator.Port(), 200);
+
+    WHEN("the frame is rendered") {
+      const bool SUCCESS = coordinator.Render(job, canvas, options, stats);
+      coordinator.Shutdown();
+      waitpid(CRASHING, NULL, 0);
+      waitpid(HEALTHY, NULL, 0);
+
+      THEN("its range is rendered by the other worker") {
+        REQUIRE(SUCCESS == true);
+        REQUIRE(stats.workersLost == 1);
+        REQUIRE(MatchesLocalRender(job, canvas) == true);
+      }
+    }
+  }
+
+  GIVEN("a worker that stalls holding a range") {
+    options.reissueAfterSeconds = 0.3;
+    const pid_t STALLED = StartFaultyWorkerProcess(coordinator.Port(), true);
+    const pid_t HEALTHY = StartWorkerProcess(coordinator.Port(), 200);
+
+    WHEN("the frame is rendered") {
+      const bool SUCCESS = coordinator.Render(job, canvas, options, stats);
+      coordinator.Shutdown();
+      kill(STALLED, SIGKILL);
+      waitpid(STALLED, NULL, 0);
+      waitpid(HEALTHY, NULL, 0);
+
+      THEN("its range is re-issued to the other worker") {
+        REQUIRE(SUCCESS == true);
+        REQUIRE(stats.reissuedRanges >= 1);
+        REQUIRE(stats.workers == 1);
+        REQUIRE(MatchesLocalRender(job, canvas) == true);
+      }
+    }
+  }
+
+  GIVEN("no workers") {
+    options.timeoutSeconds = 0.2;
+
+    WHEN("the frame is rendered") {
+      const bool SUCCESS = coordinator.Render(job, canvas, options, stats);
+
+      THEN("the render times out") {
+        REQUIRE(SUCCESS == false);
+      }
+    }
+  }
+}
+
+SCENARIO("a coordinator only accepts workers with its job token", "[DistributedRender]") {
+  RenderJob job;
+  job.width    = 16;
+  job.height   = 8;
+  job.tileSize = 4;
+
+  CoordinatorOptions options;
+  options.timeoutSeconds = 20;
+
+  RenderCoordinator coordinator(0, "127.0.0.1", "secret");
+  REQUIRE(coordinator.Listen() == true);
+  Canvas canvas(job.width, job.height);
+  DistributedStats stats;
+
+  GIVEN("a worker with the wrong token and one with the right token") {
+    const pid_t WRONG = StartWorkerProcess(coordinator.Port(), 0, "guess");
+    const pid_t RIGHT = StartWorkerProcess(coordinator.Port(), 200, "secret");
+
+    WHEN("the frame is rendered") {
+      const bool SUCCESS = coordinator.Render(job, canvas, options, stats);
+      coordinator.Shutdown();
+
+      int wrongStatus = -1, rightStatus = -1;
+      waitpid(WRONG, &wrongStatus, 0);
+      waitpid(RIGHT, &rightStatus, 0);
+
+      THEN("only the worker with the right token renders tiles") {
+        REQUIRE(SUCCESS == true);
+        REQUIRE(stats.workers == 1);
+        REQUIRE(MatchesLocalRender(job, canvas) == true);
+        REQUIRE(WIFEXITED(wrongStatus));
+        REQUIRE(WEXITSTATUS(wrongStatus) == 1);
+        REQUIRE(WIFEXITED(rightStatus));
+        REQUIRE(WEXITSTATUS(rightStatus) == 0);
+      }
+    }
+  }
+}
+
+SCENARIO("a coordinator listens on its bind address", "[DistributedRender]") {
+  GIVEN("no bind address") {
+    THEN("the coordinator accepts connections on loopback") {
+      RenderCoordinator coordinator;
+      REQUIRE(coordinator.Listen() == true);
+      const int FD = ConnectTcp("127.0.0.1", coordinator.Port());
+      REQUIRE(FD >= 0);
+      close(FD);
+    }
+  }
+
+  GIVEN("a bind address that is not an IPv4 address") {
+    THEN("the coordinator cannot listen") {
+      RenderCoordinator coordinator(0, "not an address", "secret");
+      REQUIRE(coordinator.Listen() == false);
+    }
+  }
+
+  GIVEN("a bind address other than loopback") {
+    THEN("the coordinator only listens if it has a job token") {
+      RenderCoordinator open(0, "0.0.0.0");
+      REQUIRE(open.Listen() == false);
+      RenderCoordinator guarded(0, "0.0.0.0", "secret");
+      REQUIRE(guarded.Listen() == true);
+    }
+  }
+
+  GIVEN("addresses and tokens") {
+    THEN("only 127.0.0.0/8 counts as loopback") {
+      REQUIRE(IsLoopbackAddress("127.0.0.1") == true);
+      REQUIRE(IsLoopbackAddress("127.8.9.10") == true);
+      REQUIRE(IsLoopbackAddress("0.0.0.0") == false);
+      REQUIRE(IsLoopbackAddress("10.0.0.1") == false);
+      REQUIRE(IsLoopbackAddress("localhost") == false);
+    }
+
+    THEN("tokens match only if they are identical") {
+      REQUIRE(TokensMatch("secret", "secret") == true);
+      REQUIRE(TokensMatch("", "") == true);
+      REQUIRE(TokensMatch("secret", "secreT") == false);
+      REQUIRE(TokensMatch("secret", "secret!") == false);
+      REQUIRE(TokensMatch("secret", "secre") == false);
+      REQUIRE(TokensMatch("secret", "") == false);
+      REQUIRE(TokensMatch("", "secret") == false);
+    }
+  }
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,210 @@
+#ifndef __EXR_TESTS_H_
+#define __EXR_TESTS_H_
+/*
+ * exr_tests.h
+ *
+ * Unit tests for half floats and EXR image output.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Half.h"
+#include "ExrImage.h"
+
+#include <unistd.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+SCENARIO("floats convert to and from halves", "[Half]") {
+  GIVEN("values exactly representable as halves") {
+    THEN("they have the expected bit patterns") {
+      REQUIRE(FloatToHalf(0.0f) == 0x0000);
+      REQUIRE(FloatToHalf(-0.0f) == 0x8000);
+      REQUIRE(FloatToHalf(1.0f) == 0x3c00);
+      REQUIRE(FloatToHalf(-2.0f) == 0xc000);
+      REQUIRE(FloatToHalf(0.5f) == 0x3800);
+      REQUIRE(FloatToHalf(65504.0f) == 0x7bff);
+      REQUIRE(FloatToHalf(std::ldexp(1.0f, -24)) == 0x0001);
+    }
+
+    THEN("every half survives a round trip through a float") {
+      for (int bits = 0; bits < 0x10000; ++bits) {
+        const uint16_t HALF = static_cast<uint16_t>(bits);
+        const float VALUE = HalfToFloat(HALF);
+        if (VALUE == VALUE) {
+          REQUIRE(FloatToHalf(VALUE) == HALF);
+        }
+      }
+    }
+  }
+
+  GIVEN("values outside of the half range") {
+    THEN("large values become infinity and tiny values become zero") {
+      REQUIRE(FloatToHalf(1e6f) == 0x7c00);
+      REQUIRE(FloatToHalf(-1e6f) == 0xfc00);
+      REQUIRE(FloatToHalf(1e-10f) == 0x0000);
+      REQUIRE(std::isinf(HalfToFloat(0x7c00)));
+      REQUIRE(std::isnan(HalfToFloat(FloatToHalf(NAN))));
+    }
+  }
+
+  GIVEN("values between two halves") {
+    THEN("they round to the nearest half, ties to even") {
+      // Halves near 1.0 are 2^-10 apart
+      const float STEP = std::ldexp(1.0f, -10);
+      REQUIRE(FloatToHalf(1.0f + 0.4f * STEP) == 0x3c00);
+      REQUIRE(FloatToHalf(1.0f + 0.6f * STEP) == 0x3c01);
+      REQUIRE(FloatToHalf(1.0f + 0.5f * STEP) == 0x3c00);
+      REQUIRE(FloatToHalf(1.0f + 1.5f * STEP) == 0x3c02);
+    }
+  }
+}
+
+SCENARIO("canvases are written as EXR images", "[ExrImage]") {
+  // An HDR gradient: values well above 1.0 must survive
+  Canvas canvas(37, 21);
+  for (int y = 0; y < canvas.GetHeight(); ++y) {
+    for (int x = 0; x < canvas.GetWidth(); ++x) {
+      canvas.WritePixel(x, y, Color(x * 0.5f, y * 0.25f, (x + y) / 64.0f));
+    }
+  }
+
+  TileScheduler scheduler(2);
+
+  GIVEN("an encoded image") {
+    std::string data;
+    REQUIRE(EncodeExr(canvas, ExrOptions(), scheduler, data) == true);
+
+    THEN("it starts with the EXR magic number and version") {
+      REQUIRE(static_cast<unsigned char>(data[0]) == 0x76);
+      REQUIRE(static_cast<unsigned char>(data[1]) == 0x2f);
+      REQUIRE(static_cast<unsigned char>(data[2]) == 0x31);
+      REQUIRE(static_cast<unsigned char>(data[3]) == 0x01);
+      REQUIRE(ExrGetUint32(data, 4) == 2);
+    }
+
+    THEN("the offset table points at each block of 16 scanlines") {
+      const size_t TABLE = ExrHeader(37, 21, ExrOptions()).size();
+      REQUIRE(ExrGetUint32(data, ExrGetUint64(data, TABLE)) == 0);
+      REQUIRE(ExrGetUint32(data, ExrGetUint64(data, TABLE + 8)) == 16);
+    }
+  }
+
+  GIVEN("every pixel type and compression method") {
+    const ExrPixelType TYPES[] = {EXR_HALF, EXR_FLOAT};
+    const ExrCompression COMPRESSIONS[] = {EXR_NO_COMPRESSION, EXR_ZIPS_COMPRESSION,
+                                           EXR_ZIP_COMPRESSION};
+
+    THEN("decoding preserves the pixels to the precision of the pixel type") {
+      for (int t = 0; t < 2; ++t) {
+        for (int c = 0; c < 3; ++c) {
+          ExrOptions options;
+          options.pixelType   = TYPES[t];
+          options.compression = COMPRESSIONS[c];
+
+          std::string data;
+          REQUIRE(EncodeExr(canvas, options, scheduler, data) == true);
+
+          int width = 0, height = 0;
+          std::vector<Color> pixels;
+          REQUIRE(DecodeExr(data, width, height, pixels) == true);
+          REQUIRE(width == 37);
+          REQUIRE(height == 21);
+
+          for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+              const Color EXPECTED = canvas.PixelAt(x, y);
+              const Color ACTUAL = pixels[y * width + x];
+              if (options.pixelType == EXR_FLOAT) {
+                REQUIRE(ACTUAL.Red() == EXPECTED.Red());
+                REQUIRE(ACTUAL.Green() == EXPECTED.Green());
+                REQUIRE(ACTUAL.Blue() == EXPECTED.Blue());
+              } else {
+                REQUIRE(ACTUAL.Red() == HalfToFloat(FloatToHalf(EXPECTED.Red())));
+                REQUIRE(ACTUAL.Green() == HalfToFloat(FloatToHalf(EXPECTED.Green())));
+                REQUIRE(ACTUAL.Blue() == HalfToFloat(FloatToHalf(EXPECTED.Blue())));
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  GIVEN("a smooth image") {
+    Canvas flat(64, 64);
+    for (int y = 0; y < 64; ++y) {
+      for (int x = 0; x < 64; ++x) {
+        flat.WritePixel(x, y, Color(0.5, 0.5, 0.5));
+      }
+    }
+
+    WHEN("it is written with and without compression") {
+      ExrOptions raw, zip;
+      raw.compression = EXR_NO_COMPRESSION;
+      std::string rawData, zipData;
+      REQUIRE(EncodeExr(flat, raw, scheduler, rawData) == true);
+      REQUIRE(EncodeExr(flat, zip, scheduler, zipData) == true);
+
+      THEN("ZIP compression makes it much smaller") {
+        REQUIRE(zipData.size() * 10 < rawData.size());
+      }
+    }
+  }
+
+  GIVEN("a file on disk") {
+    const std::string NAME = "/tmp/exr_test_" + std::to_string(getpid()) + ".exr";
+
+    WHEN("the canvas is written and read back") {
+      REQUIRE(WriteExr(canvas, NAME, ExrOptions(), scheduler) == true);
+      int width = 0, height = 0;
+      std::vector<Color> pixels;
+      const bool READ = ReadExr(NAME, width, height, pixels);
+      remove(NAME.c_str());
+
+      THEN("the HDR values are kept") {
+        REQUIRE(READ == true);
+        REQUIRE(pixels[20 * width + 36].Red() == 18.0f);
+      }
+    }
+
+    THEN("corrupt data is rejected") {
+      std::string data;
+      REQUIRE(EncodeExr(canvas, ExrOptions(), scheduler, data) == true);
+      data.resize(data.size() / 2);
+
+      int width = 0, height = 0;
+      std::vector<Color> pixels;
+      REQUIRE(DecodeExr(data, width, height, pixels) == false);
+      REQUIRE(DecodeExr("not an image", width, height, pixels) == false);
+    }
+
+    THEN("data windows too large for the file are rejected") {
+      ExrOptions options;
+      options.compression = EXR_NO_COMPRESSION;
+      std::string data;
+      REQUIRE(EncodeExr(canvas, options, scheduler, data) == true);
+      const std::string WINDOW("dataWindow\0box2i\0", 17);
+      const size_t AT = data.find(WINDOW) + WINDOW.size() + 4;
+
+      // xMin/xMax at the extremes of int, and a width that fits in an int
+      // but whose scanlines are far larger than the file
+      const int32_t WINDOWS[2][4] = {{INT32_MIN, 0, INT32_MAX, 0}, {0, 0, 1 << 25, 0}};
+      for (int w = 0; w < 2; ++w) {
+        std::string corrupt = data;
+        for (int i = 0; i < 4; ++i) {
+          for (int b = 0; b < 4; ++b) {
+            corrupt[AT + 4 * i + b] = static_cast<char>((static_cast<uint32_t>(WINDOWS[w][i]) >> (8 * b)) & 0xff);
+          }
+        }
+        int width = 0, height = 0;
+        std::vector<Color> pixels;
+        REQUIRE(DecodeExr(corrupt, width, height, pixels) == false);
+        REQUIRE(pixels.empty());
+      }
+    }
+  }
+}
+#endif
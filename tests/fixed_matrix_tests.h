@@ -0,0 +1,125 @@
+#ifndef __FIXED_MATRIX_TESTS_H_
+#define __FIXED_MATRIX_TESTS_H_
+/*
+ * fixed_matrix_tests.h
+ *
+ * Unit tests for the compile-time sized FixedMatrix and the constexpr
+ * transform builders.  Results are checked against the heap backed Matrix.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Tuple.h"
+#include "Matrix.h"
+#include "FixedMatrix.h"
+#include "Transformations.h"
+
+#include <cmath>
+
+// Constant transforms are folded by the compiler
+constexpr Matrix4 FIXED_TEST_TRANSFORM = Translation(1, 2, 3) * Scaling(2, 4, 8);
+static_assert(FIXED_TEST_TRANSFORM.GetValue(0, 0) == 2 && FIXED_TEST_TRANSFORM.GetValue(2, 2) == 8,
+              "Scaling is folded at compile time");
+static_assert(FIXED_TEST_TRANSFORM.GetValue(1, 3) == 2, "Translation is folded at compile time");
+static_assert(Inverse(Translation(1, 2, 3)) == Translation(-1, -2, -3),
+              "Inverse is evaluated at compile time");
+static_assert(Determinant(Scaling(2, 3, 4)) == 24, "Determinant is evaluated at compile time");
+static_assert(Transpose(FixedMatrix<2, 3>(1, 2, 3, 4, 5, 6)).Rows() == 3,
+              "Transpose swaps the dimensions");
+static_assert(RotZ(0) == FixedIdentity<4>(), "Rotating by zero is the identity");
+
+SCENARIO("fixed size matrices match Matrix") {
+  GIVEN("an invertible 4x4 matrix") {
+    const Matrix4 FIXED(-5,  2,  6, -8,
+                         1, -5,  1,  8,
+                         7,  7, -6, -7,
+                         1, -3,  7,  4);
+    float values[] = {-5,  2,  6, -8,
+                       1, -5,  1,  8,
+                       7,  7, -6, -7,
+                       1, -3,  7,  4};
+    const Matrix DYNAMIC(4, 4, values);
+
+    THEN("it converts to the same Matrix") {
+      const Matrix CONVERTED = FIXED;
+      REQUIRE(CONVERTED == DYNAMIC);
+      REQUIRE(FIXED == DYNAMIC);
+    }
+
+    THEN("the determinant and cofactors match") {
+      REQUIRE(std::fabs(Determinant(FIXED) - Determinant(DYNAMIC)) < 0.001);
+      REQUIRE(std::fabs(Determinant(FIXED) - 532) < 0.001);
+      for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+          REQUIRE(std::fabs(Cofactor(FIXED, y, x) - Cofactor(DYNAMIC, y, x)) < 0.001);
+        }
+      }
+    }
+
+    THEN("the inverse matches") {
+      REQUIRE(Inverse(FIXED) == Inverse(DYNAMIC));
+      REQUIRE(FIXED * Inverse(FIXED) == FixedIdentity<4>());
+    }
+
+    THEN("the transpose and products match") {
+      REQUIRE(Transpose(FIXED) == Transpose(DYNAMIC));
+      REQUIRE(FIXED * FIXED == DYNAMIC * DYNAMIC);
+      REQUIRE(FIXED * DYNAMIC == DYNAMIC * DYNAMIC);
+      REQUIRE(FIXED * Point(1, 2, 3) == DYNAMIC * Point(1, 2, 3));
+    }
+  }
+
+  GIVEN("square matrices of other sizes") {
+    const FixedMatrix<2, 2> TWO(1, 5, -3, 2);
+    const FixedMatrix<3, 3> THREE(1, 2, 6, -5, 8, -4, 2, 6, 4);
+    const FixedMatrix<5, 5> FIVE(2, 0, 0, 0, 1,
+                                 0, 3, 0, 1, 0,
+                                 0, 0, 4, 0, 0,
+                                 0, 1, 0, 5, 0,
+                                 1, 0, 0, 0, 6);
+
+    THEN("their determinants are correct") {
+      REQUIRE(std::fabs(Determinant(TWO) - 17) < 0.0001);
+      REQUIRE(std::fabs(Determinant(THREE) - -196) < 0.0001);
+      // Block diagonal: (2*6 - 1) * (3*5 - 1) * 4
+      REQUIRE(std::fabs(Determinant(FIVE) - 616) < 0.001);
+    }
+
+    THEN("their inverses are correct") {
+      REQUIRE(TWO * Inverse(TWO) == FixedIdentity<2>());
+      REQUIRE(THREE * Inverse(THREE) == FixedIdentity<3>());
+      REQUIRE(FIVE * Inverse(FIVE) == FixedIdentity<5>());
+    }
+  }
+
+  GIVEN("a non-square matrix") {
+    const FixedMatrix<2, 3> WIDE(1, 2, 3, 4, 5, 6);
+
+    THEN("multiplying by its transpose gives a 2x2 matrix") {
+      const FixedMatrix<2, 2> PRODUCT = WIDE * Transpose(WIDE);
+      REQUIRE(PRODUCT == FixedMatrix<2, 2>(14, 32, 32, 77));
+    }
+  }
+}
+
+SCENARIO("the constexpr transform builders are accurate") {
+  GIVEN("angles around and beyond the circle") {
+    THEN("the compile time sine and cosine match the library") {
+      for (int i = -400; i <= 400; ++i) {
+        const double THETA = i * 0.0314;
+        REQUIRE(std::fabs(ConstexprSin(THETA) - std::sin(THETA)) < 1e-9);
+        REQUIRE(std::fabs(ConstexprCos(THETA) - std::cos(THETA)) < 1e-9);
+      }
+    }
+
+    THEN("the rotations match the sinf/cosf formulas") {
+      for (int i = -20; i <= 20; ++i) {
+        const float THETA = i * 0.37f;
+        REQUIRE(std::fabs(RotX(THETA).GetValue(1, 1) - cosf(THETA)) < 1e-6);
+        REQUIRE(std::fabs(RotY(THETA).GetValue(0, 2) - sinf(THETA)) < 1e-6);
+        REQUIRE(std::fabs(RotZ(THETA).GetValue(1, 0) - sinf(THETA)) < 1e-6);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,134 @@
+#ifndef __INCREMENTAL_TESTS_H_
+#define __INCREMENTAL_TESTS_H_
+/*
+ * incremental_tests.h
+ *
+ * Unit tests for re-rendering the tiles affected by a scene edit.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "IncrementalRenderer.h"
+#include "Transformations.h"
+
+#include <cmath>
+
+// Checks that two canvases hold the same pixels
+bool CanvasesMatch(const Canvas &a, const Canvas &b) {
+  for (int y = 0; y < a.GetHeight(); ++y) {
+    for (int x = 0; x < a.GetWidth(); ++x) {
+      if (!(a.PixelAt(x, y) == b.PixelAt(x, y))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+SCENARIO("a world box is projected onto the screen", "[IncrementalRenderer]") {
+  Camera camera(21, 21, M_PI/2);
+  camera.SetTransform(ViewTransform(Point(0, 0, -5), Point(0, 0, 0), Vector(0, 1, 0)));
+
+  GIVEN("a unit sphere in front of the camera") {
+    Sphere s;
+    Tuple boxMin, boxMax;
+    SphereBounds(s, boxMin, boxMax);
+
+    THEN("its bounds are centered on the canvas") {
+      REQUIRE(boxMin == Point(-1, -1, -1));
+      REQUIRE(boxMax == Point(1, 1, 1));
+
+      const ScreenRect RECT = ProjectBounds(camera, boxMin, boxMax);
+      REQUIRE(RECT.x0 > 0);
+      REQUIRE(RECT.x1 < 21);
+      REQUIRE(RECT.x0 <= 10);
+      REQUIRE(RECT.x1 > 10);
+      REQUIRE(RECT.x0 + RECT.x1 == 21);
+      REQUIRE(RECT.y0 + RECT.y1 == 21);
+    }
+  }
+
+  GIVEN("a box behind the camera") {
+    const ScreenRect RECT = ProjectBounds(camera, Point(-1, -1, -7), Point(1, 1, -6));
+
+    THEN("it covers the whole canvas") {
+      REQUIRE(RECT.x0 == 0);
+      REQUIRE(RECT.y0 == 0);
+      REQUIRE(RECT.x1 == 21);
+      REQUIRE(RECT.y1 == 21);
+    }
+  }
+}
+
+SCENARIO("a frame is re-rendered after a scene edit", "[IncrementalRenderer]") {
+  // A floor with two small spheres resting on it
+  World world;
+  world.AddLight(PointLight(Point(-10, 10, -10), Color(1, 1, 1)));
+
+  Sphere floor;
+  floor.SetTransform(Scaling(10, 0.01, 10));
+  world.AddObject(floor);
+
+  Sphere left;
+  left.SetTransform(Translation(-2, 0.5, 0) * Scaling(0.5, 0.5, 0.5));
+  world.AddObject(left);
+
+  Sphere right;
+  right.SetTransform(Translation(2, 0.5, 0) * Scaling(0.5, 0.5, 0.5));
+  world.AddObject(right);
+
+  Camera camera(32, 32, M_PI/3);
+  camera.SetTransform(ViewTransform(Point(0, 4, -8), Point(0, 0, 0), Vector(0, 1, 0)));
+
+  TileScheduler scheduler(2);
+  IncrementalRenderer renderer(world, camera, scheduler, 8);
+  Canvas canvas(32, 32);
+
+  GIVEN("a fully rendered frame") {
+    REQUIRE(renderer.Update(canvas) == renderer.NumTiles());
+
+    THEN("nothing is re-traced without an edit") {
+      REQUIRE(renderer.DirtyTiles() == 0);
+      REQUIRE(renderer.Update(canvas) == 0);
+    }
+
+    WHEN("the material of one sphere is changed") {
+      Material red;
+      red.SetColor(Color(1, 0, 0));
+      renderer.SetMaterial(2, red);
+      const int RETRACED = renderer.Update(canvas);
+
+      THEN("only the tiles that saw it are re-traced") {
+        REQUIRE(RETRACED > 0);
+        REQUIRE(RETRACED < renderer.NumTiles());
+      }
+
+      THEN("the frame matches a full render") {
+        Canvas reference(32, 32);
+        Render(camera, world, reference);
+        REQUIRE(CanvasesMatch(canvas, reference) == true);
+      }
+    }
+
+    WHEN("one sphere is moved") {
+      renderer.SetTransform(1, Translation(-1, 0.5, -1) * Scaling(0.5, 0.5, 0.5));
+      const int RETRACED = renderer.Update(canvas);
+
+      THEN("the frame, including the moved shadow, matches a full render") {
+        REQUIRE(RETRACED > 0);
+        Canvas reference(32, 32);
+        Render(camera, world, reference);
+        REQUIRE(CanvasesMatch(canvas, reference) == true);
+      }
+    }
+
+    WHEN("every tile is invalidated") {
+      renderer.InvalidateAll();
+
+      THEN("the whole frame is re-traced") {
+        REQUIRE(renderer.Update(canvas) == renderer.NumTiles());
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,184 @@
+#ifndef __KERNELS_TESTS_H_
+#define __KERNELS_TESTS_H_
+/*
+ * kernels_tests.h
+ *
+ * Unit tests for the per instruction set render kernels.  Every level this
+ * CPU supports is checked against the scalar Matrix code and against
+ * Intersect(), Lighting(), and WriteToPPM(), which run the best level.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "kernels/Kernels.h"
+#include "Tuple.h"
+#include "Color.h"
+#include "Matrix.h"
+#include "Transformations.h"
+#include "RaySphere.h"
+#include "Lighting.h"
+#include "PointLight.h"
+#include "Material.h"
+#include "Random.h"
+
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief  Copies tuples into the 4 floats per element kernel layout.
+ */
+std::vector<float> KernelTuples(const std::vector<Tuple> &tuples) {
+  std::vector<float> values;
+  for (size_t i = 0; i < tuples.size(); ++i) {
+    values.push_back(tuples[i].X());
+    values.push_back(tuples[i].Y());
+    values.push_back(tuples[i].Z());
+    values.push_back(tuples[i].W());
+  }
+  return values;
+}
+
+SCENARIO("the CPU level is detected and can be overridden", "[Kernels]") {
+  GIVEN("the detected level") {
+    const CpuLevel DETECTED = DetectCpuLevel();
+
+    THEN("level names round trip") {
+      for (int i = 0; i < NUM_CPU_LEVELS; ++i) {
+        CpuLevel parsed = NUM_CPU_LEVELS;
+        REQUIRE(ParseCpuLevel(CpuLevelName(static_cast<CpuLevel>(i)), parsed) == true);
+        REQUIRE(parsed == i);
+        REQUIRE(KernelsForLevel(static_cast<CpuLevel>(i)).level == i);
+      }
+      CpuLevel unchanged = CPU_AVX2;
+      REQUIRE(ParseCpuLevel("avx9000", unchanged) == false);
+      REQUIRE(unchanged == CPU_AVX2);
+    }
+
+    THEN("every supported level can be forced") {
+      for (int i = CPU_SSE2; i <= DETECTED; ++i) {
+        REQUIRE(SelectCpuLevel(static_cast<CpuLevel>(i)) == true);
+        REQUIRE(GetRenderKernels().level == i);
+      }
+      if (DETECTED < CPU_AVX512) {
+        REQUIRE(SelectCpuLevel(CPU_AVX512) == false);
+        REQUIRE(GetRenderKernels().level == DETECTED);
+      }
+      REQUIRE(SelectCpuLevel(DETECTED) == true);
+    }
+  }
+}
+
+SCENARIO("each kernel level matches the scalar code", "[Kernels]") {
+  GIVEN("random points and directions") {
+    Pcg32 rng(42);
+    const int COUNT = 37;
+    std::vector<Tuple> points, vectors, normals;
+    for (int i = 0; i < COUNT; ++i) {
+      points.push_back(Point(4 * rng.NextFloat() - 2, 4 * rng.NextFloat() - 2, 4 * rng.NextFloat() - 2));
+      vectors.push_back(Normalize(Vector(2 * rng.NextFloat() - 1, 2 * rng.NextFloat() - 1,
+                                         2 * rng.NextFloat() - 1)));
+      normals.push_back(Normalize(Vector(2 * rng.NextFloat() - 1, 2 * rng.NextFloat() - 1,
+                                         2 * rng.NextFloat() - 1)));
+    }
+    const std::vector<float> POINTS  = KernelTuples(points);
+    const std::vector<float> VECTORS = KernelTuples(vectors);
+    const std::vector<float> NORMALS = KernelTuples(normals);
+    const CpuLevel DETECTED = DetectCpuLevel();
+
+    THEN("transformTuples matches Matrix * Tuple") {
+      const Matrix M = Translation(1, -2, 3) * RotY(0.7) * Scaling(2, 0.5, 1.5);
+      float matrix[16];
+      for (int i = 0; i < 16; ++i) {
+        matrix[i] = M.GetValue(i / 4, i % 4);
+      }
+
+      for (int l = CPU_SSE2; l <= DETECTED; ++l) {
+        std::vector<float> out(4 * COUNT);
+        KernelsForLevel(static_cast<CpuLevel>(l)).transformTuples(matrix, POINTS.data(),
+                                                                  out.data(), COUNT);
+        for (int i = 0; i < COUNT; ++i) {
+          const Tuple EXPECTED = M * points[i];
+          REQUIRE(std::fabs(out[4 * i]     - EXPECTED.X()) < 1e-5);
+          REQUIRE(std::fabs(out[4 * i + 1] - EXPECTED.Y()) < 1e-5);
+          REQUIRE(std::fabs(out[4 * i + 2] - EXPECTED.Z()) < 1e-5);
+          REQUIRE(std::fabs(out[4 * i + 3] - EXPECTED.W()) < 1e-5);
+        }
+      }
+    }
+
+    THEN("intersectUnitSphere matches Intersect()") {
+      const Sphere SPHERE;
+      for (int l = CPU_SSE2; l <= DETECTED; ++l) {
+        std::vector<float> t0(COUNT), t1(COUNT);
+        const size_t HITS = KernelsForLevel(static_cast<CpuLevel>(l)).intersectUnitSphere(
+                              POINTS.data(), VECTORS.data(), COUNT, t0.data(), t1.data());
+
+        size_t expectedHits = 0;
+        for (int i = 0; i < COUNT; ++i) {
+          const std::vector<Intersection> XS = Intersect(SPHERE, Ray(points[i], vectors[i]));
+          if (XS.empty()) {
+            REQUIRE(t0[i] == FLT_MAX);
+            REQUIRE(t1[i] == FLT_MAX);
+          } else {
+            ++expectedHits;
+            REQUIRE(std::fabs(t0[i] - XS[0].T()) < 1e-4);
+            REQUIRE(std::fabs(t1[i] - XS[1].T()) < 1e-4);
+          }
+        }
+        REQUIRE(HITS == expectedHits);
+        REQUIRE(HITS > 0);
+        REQUIRE(HITS < static_cast<size_t>(COUNT));
+      }
+    }
+
+    THEN("shadePhong matches Lighting()") {
+      Material mat;
+      mat.SetColor(Color(1, 0.2, 1));
+      mat.SetShininess(50);
+      const PointLight LIGHT(Point(-10, 10, -10), Color(1, 0.9, 0.8));
+      const KernelMaterial K_MAT = {{1, 0.2f, 1}, mat.Ambient(), mat.Diffuse(), mat.Specular(), 50};
+      const KernelLight K_LIGHT = {{-10, 10, -10}, {1, 0.9f, 0.8f}};
+
+      // Eye vectors are the reflections of the light so some points get highlights
+      std::vector<Tuple> eyes;
+      std::vector<uint8_t> shadow;
+      for (int i = 0; i < COUNT; ++i) {
+        const Tuple TO_LIGHT = Normalize(LIGHT.Position() - points[i]);
+        eyes.push_back(i % 2 ? vectors[i] : Reflect(-TO_LIGHT, normals[i]));
+        shadow.push_back(i % 5 == 0);
+      }
+      const std::vector<float> EYES = KernelTuples(eyes);
+
+      for (int l = CPU_SSE2; l <= DETECTED; ++l) {
+        std::vector<float> colors(4 * COUNT);
+        KernelsForLevel(static_cast<CpuLevel>(l)).shadePhong(K_MAT, K_LIGHT, POINTS.data(),
+          EYES.data(), NORMALS.data(), shadow.data(), COUNT, colors.data());
+
+        for (int i = 0; i < COUNT; ++i) {
+          const Color EXPECTED = Lighting(mat, LIGHT, points[i], eyes[i], normals[i], shadow[i]);
+          REQUIRE(std::fabs(colors[4 * i]     - EXPECTED.Red()) < 1e-4);
+          REQUIRE(std::fabs(colors[4 * i + 1] - EXPECTED.Green()) < 1e-4);
+          REQUIRE(std::fabs(colors[4 * i + 2] - EXPECTED.Blue()) < 1e-4);
+        }
+      }
+    }
+
+    THEN("quantizePixels matches WriteToPPM()") {
+      const float VALUES[] = {-1.0f, 0.0f, 0.001f, 0.5f, 0.99f, 1.0f, 1.5f, 0.25f,
+                              0.1f, 0.2f, 0.3f, 0.0f};
+      const int PIXELS = sizeof(VALUES) / sizeof(VALUES[0]) / 4;
+      for (int l = CPU_SSE2; l <= DETECTED; ++l) {
+        std::vector<uint8_t> rgb(3 * PIXELS);
+        KernelsForLevel(static_cast<CpuLevel>(l)).quantizePixels(VALUES, PIXELS, rgb.data());
+        for (int i = 0; i < PIXELS; ++i) {
+          for (int c = 0; c < 3; ++c) {
+            const float CLAMPED = std::min(1.0f, std::max(0.0f, VALUES[4 * i + c]));
+            REQUIRE(rgb[3 * i + c] == static_cast<int>(255 * CLAMPED));
+          }
+        }
+      }
+    }
+  }
+}
+#endif
@@ -88,5 +88,20 @@ SCENARIO("objects are shaded according to the Phong Lighting Model") {
       }
     }
   }
+
+  GIVEN("the surface is in shadow") {
+    const Tuple EYE    = Vector(0, 0, -1);
+    const Tuple NORMAL = Vector(0, 0, -1);
+    const PointLight LIGHT(Point(0, 0, -10), Color(1, 1, 1));
+    const bool IN_SHADOW = true;
+
+    WHEN("the shading is computed") {
+      const Color RESULT = Lighting(M, LIGHT, POSITION, EYE, NORMAL, IN_SHADOW);
+
+      THEN("only the ambient component remains") {
+        REQUIRE(RESULT == Color(0.1, 0.1, 0.1));
+      }
+    }
+  }
 }
 #endif
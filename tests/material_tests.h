@@ -19,6 +19,9 @@ SCENARIO("a material object is created", "[Material]") {
       REQUIRE(FloatCompare(m.Diffuse(), 0.9)     == true);
       REQUIRE(FloatCompare(m.Specular(), 0.9)    == true);
       REQUIRE(FloatCompare(m.Shininess(), 200.0) == true);
+      REQUIRE(FloatCompare(m.Reflective(), 0.0)      == true);
+      REQUIRE(FloatCompare(m.Transparency(), 0.0)    == true);
+      REQUIRE(FloatCompare(m.RefractiveIndex(), 1.0) == true);
     } 
   }
 }
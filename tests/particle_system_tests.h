@@ -0,0 +1,177 @@
+#ifndef __PARTICLE_SYSTEM_TESTS_H_
+#define __PARTICLE_SYSTEM_TESTS_H_
+/*
+ * particle_system_tests.h
+ *
+ * Unit tests for the structure of arrays particle system.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "ParticleSystem.h"
+#include "TileScheduler.h"
+#include "Canvas.h"
+#include "kernels/Kernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+SCENARIO("particles move like the Cannon projectile", "[Kernels]") {
+  GIVEN("a particle in a world with gravity and wind") {
+    const Tuple GRAVITY = Vector(0, -0.1f, 0);
+    const Tuple WIND    = Vector(-0.01f, 0, 0);
+    ParticleSystem system(GRAVITY, WIND);
+    system.Emit(Point(0, 1, 0), Vector(0.5f, 0.9f, 0.1f), 1000);
+
+    WHEN("it is updated one tick at a time") {
+      Tuple position = Point(0, 1, 0);
+      Tuple velocity = Vector(0.5f, 0.9f, 0.1f);
+      for (int tick = 0; tick < 20; ++tick) {
+        REQUIRE(system.Update(1) == 1);
+        position += velocity;
+        velocity += GRAVITY + WIND;
+      }
+
+      THEN("it follows Cannon's Tick()") {
+        REQUIRE(system.Position(0) == position);
+        REQUIRE(system.Velocity(0) == velocity);
+        REQUIRE(std::fabs(system.Lifetime(0) - 980) < 1e-3);
+      }
+    }
+
+    WHEN("it is updated with a fixed timestep") {
+      system.SetFixedTimestep(0.25f);
+
+      THEN("each update takes the whole steps that fit") {
+        REQUIRE(system.Update(1) == 4);
+        REQUIRE(system.Update(0.1f) == 0);
+        REQUIRE(system.Update(0.2f) == 1);
+        REQUIRE(std::fabs(system.Lifetime(0) - 998.75f) < 1e-3);
+      }
+
+      THEN("the steps match stepping one at a time") {
+        ParticleSystem stepped(GRAVITY, WIND);
+        stepped.Emit(Point(0, 1, 0), Vector(0.5f, 0.9f, 0.1f), 1000);
+        stepped.SetFixedTimestep(0.25f);
+        for (int frame = 0; frame < 10; ++frame) {
+          system.Update(1);
+          for (int step = 0; step < 4; ++step) {
+            stepped.Update(0.25f);
+          }
+        }
+        REQUIRE(system.Position(0) == stepped.Position(0));
+        REQUIRE(system.Velocity(0) == stepped.Velocity(0));
+      }
+    }
+  }
+
+  GIVEN("particles with different lifetimes") {
+    ParticleSystem system(Vector(0, 0, 0), Vector(0, 0, 0));
+    for (int i = 0; i < 10; ++i) {
+      system.Emit(Point(i, 0, 0), Vector(0, 1, 0), 1.5f + (i % 3));
+    }
+
+    WHEN("the shortest lives run out") {
+      system.Update(2);
+
+      THEN("only those particles are removed") {
+        REQUIRE(system.Size() == 6);
+        std::vector<float> xs;
+        for (size_t i = 0; i < system.Size(); ++i) {
+          REQUIRE(system.Position(i).Y() == 2);
+          xs.push_back(system.Position(i).X());
+        }
+        std::sort(xs.begin(), xs.end());
+        REQUIRE(xs == std::vector<float>({1, 2, 4, 5, 7, 8}));
+      }
+    }
+
+    WHEN("every life runs out") {
+      system.Update(10);
+
+      THEN("the system is empty") {
+        REQUIRE(system.Size() == 0);
+        REQUIRE(system.Update(1) == 1);
+      }
+    }
+  }
+
+  GIVEN("a particle on a canvas") {
+    ParticleSystem system(Vector(0, 0, 0), Vector(0, 0, 0));
+    system.Emit(Point(3, 2, 0), Vector(0, 0, 0), 10);
+    system.Emit(Point(-50, 1e20f, 0), Vector(0, 0, 0), 10);
+    Canvas canvas(10, 5);
+
+    WHEN("the particles are rasterized") {
+      system.Rasterize(canvas, Color(1, 0, 0));
+
+      THEN("y points up from the bottom of the canvas") {
+        REQUIRE(canvas.PixelAt(3, 3) == Color(1, 0, 0));
+        REQUIRE(canvas.PixelAt(3, 2) == Color(0, 0, 0));
+      }
+    }
+  }
+
+  GIVEN("enough particles to split across threads") {
+    ParticleSystem single(Vector(0, -0.1f, 0), Vector(0.01f, 0, 0));
+    ParticleSystem threaded(Vector(0, -0.1f, 0), Vector(0.01f, 0, 0));
+    for (int i = 0; i < 150000; ++i) {
+      const Tuple VELOCITY = Vector(i % 7, i % 11, -(i % 5));
+      single.Emit(Point(i % 13, 0, 0), VELOCITY, 1 + i % 97);
+      threaded.Emit(Point(i % 13, 0, 0), VELOCITY, 1 + i % 97);
+    }
+
+    WHEN("both are updated") {
+      TileScheduler scheduler(4);
+      for (int frame = 0; frame < 5; ++frame) {
+        single.Update(10);
+        threaded.Update(10, scheduler);
+      }
+
+      THEN("they hold the same particles") {
+        REQUIRE(threaded.Size() == single.Size());
+        for (size_t i = 0; i < single.Size(); ++i) {
+          REQUIRE(threaded.Position(i) == single.Position(i));
+        }
+      }
+    }
+  }
+
+  GIVEN("particles for every kernel level") {
+    const float ACCELERATION[3] = {0.5f, -9.8f, 0.25f};
+    const float POSITION[3] = {1, 2, 3}, VELOCITY[3] = {4, 5, -6};
+
+    THEN("taking several steps at once matches taking them one at a time") {
+      const CpuLevel DETECTED = DetectCpuLevel();
+      for (int l = CPU_SSE2; l <= DETECTED; ++l) {
+        const RenderKernels &K = KernelsForLevel(static_cast<CpuLevel>(l));
+        std::vector<float> once[7], stepped[7];
+        for (int c = 0; c < 7; ++c) {
+          const float VALUE = (c < 3) ? POSITION[c] : ((c < 6) ? VELOCITY[c - 3] : 0.2f);
+          once[c].assign(19, VALUE);
+          stepped[c].assign(19, VALUE);
+        }
+
+        REQUIRE(K.tickParticles(ACCELERATION, 0.01f, 8, once[0].data(), once[1].data(),
+                                once[2].data(), once[3].data(), once[4].data(),
+                                once[5].data(), once[6].data(), 19) == 0);
+        for (int step = 0; step < 8; ++step) {
+          K.tickParticles(ACCELERATION, 0.01f, 1, stepped[0].data(), stepped[1].data(),
+                          stepped[2].data(), stepped[3].data(), stepped[4].data(),
+                          stepped[5].data(), stepped[6].data(), 19);
+        }
+        for (int c = 0; c < 7; ++c) {
+          for (int i = 0; i < 19; ++i) {
+            REQUIRE(std::fabs(once[c][i] - stepped[c][i]) < 1e-4);
+          }
+        }
+
+        REQUIRE(K.tickParticles(ACCELERATION, 0.2f, 1, once[0].data(), once[1].data(),
+                                once[2].data(), once[3].data(), once[4].data(),
+                                once[5].data(), once[6].data(), 19) == 19);
+      }
+    }
+  }
+}
+#endif
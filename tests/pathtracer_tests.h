@@ -0,0 +1,146 @@
+#ifndef __PATHTRACER_TESTS_H_
+#define __PATHTRACER_TESTS_H_
+/*
+ * pathtracer_tests.h
+ *
+ * Unit tests for the Monte Carlo path tracer.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "PathTracer.h"
+#include "Transformations.h"
+
+#include <cmath>
+
+SCENARIO("samples are accumulated", "[PathTracer]") {
+  GIVEN("an accumulation buffer") {
+    AccumulationBuffer buffer(2, 2);
+
+    WHEN("two samples are added to every pixel") {
+      for (int y = 0; y < 2; ++y) {
+        for (int x = 0; x < 2; ++x) {
+          buffer.AddSample(x, y, Color(1, 0, 0.5));
+          buffer.AddSample(x, y, Color(0, 1, 0.5));
+        }
+      }
+      buffer.AddSamples(2);
+
+      THEN("the pixels resolve to the average") {
+        REQUIRE(buffer.Samples() == 2);
+        REQUIRE(buffer.Resolve(1, 1) == Color(0.5, 0.5, 0.5));
+      }
+
+      THEN("the RMSE against itself is zero and against black is not") {
+        const AccumulationBuffer BLACK(2, 2);
+        REQUIRE(FloatCompare(RMSE(buffer, buffer), 0.0) == true);
+        REQUIRE(FloatCompare(RMSE(buffer, BLACK), 0.5) == true);
+      }
+
+      THEN("clearing the buffer resets it to black") {
+        buffer.Clear();
+        REQUIRE(buffer.Samples() == 0);
+        REQUIRE(buffer.Resolve(0, 0) == Color(0, 0, 0));
+      }
+    }
+  }
+}
+
+SCENARIO("directions are sampled on a hemisphere", "[PathTracer]") {
+  GIVEN("a surface normal") {
+    const Tuple NORMAL = Normalize(Vector(1, 2, -3));
+
+    WHEN("many cosine-weighted directions are generated") {
+      Pcg32 rng(7);
+      float meanCos = 0;
+      bool allAbove = true, allUnit = true;
+      const int COUNT = 2000;
+      for (int i = 0; i < COUNT; ++i) {
+        const Tuple DIR = CosineSampleHemisphere(NORMAL, rng.NextFloat(), rng.NextFloat());
+        const float COS = Dot(DIR, NORMAL);
+        allAbove = allAbove && (COS >= -0.0001);
+        allUnit  = allUnit && (std::fabs(Magnitude(DIR) - 1) < 0.001);
+        meanCos += COS / COUNT;
+      }
+
+      THEN("they are unit vectors above the surface with E[cos] = 2/3") {
+        REQUIRE(allAbove == true);
+        REQUIRE(allUnit  == true);
+        REQUIRE(std::fabs(meanCos - 2.0/3.0) < 0.02);
+      }
+    }
+  }
+}
+
+SCENARIO("a world is path traced", "[PathTracer]") {
+  GIVEN("a diffuse sphere lit by a point light") {
+    World world;
+    world.AddLight(PointLight(Point(0, 0, -10), Color(100, 100, 100)));
+    world.AddObject(Sphere());
+
+    Camera camera(16, 16, M_PI/4);
+    camera.SetTransform(ViewTransform(Point(0, 0, -5), Point(0, 0, 0), Vector(0, 1, 0)));
+
+    PathTracerOptions options;
+    options.numThreads = 2;
+    options.samplesPerPass = 2;
+    options.tileSize = 4;
+    PathTracer tracer(world, camera, options);
+
+    WHEN("two passes are rendered") {
+      tracer.RenderPass();
+      tracer.RenderPass();
+
+      THEN("the samples and statistics are accumulated") {
+        REQUIRE(tracer.Passes() == 2);
+        REQUIRE(tracer.Buffer().Samples() == 4);
+        REQUIRE(tracer.TotalStats().samples == 4 * 16 * 16);
+        REQUIRE(tracer.TotalStats().samplesPerPixel == 4);
+      }
+
+      THEN("the sphere facing the light is lit and the background is black") {
+        /*
+         * The center of the sphere faces the light head-on:
+         * L = albedo/pi * I/d^2 = 0.9/pi * 100/81
+         */
+        const Color CENTER = tracer.Buffer().Resolve(8, 8);
+        REQUIRE(std::fabs(CENTER.Red() - 0.9 / M_PI * 100 / 81) < 0.05);
+        REQUIRE(tracer.Buffer().Resolve(0, 0) == Color(0, 0, 0));
+      }
+    }
+
+    WHEN("the same world is rendered with a different number of threads") {
+      PathTracerOptions singleOptions = options;
+      singleOptions.numThreads = 1;
+      PathTracer single(world, camera, singleOptions);
+
+      tracer.RenderPass();
+      single.RenderPass();
+
+      THEN("the images are identical") {
+        bool identical = true;
+        for (int y = 0; y < 16; ++y) {
+          for (int x = 0; x < 16; ++x) {
+            const Color A = tracer.Buffer().Resolve(x, y);
+            const Color B = single.Buffer().Resolve(x, y);
+            identical = identical && (A.Red() == B.Red()) &&
+                        (A.Green() == B.Green()) && (A.Blue() == B.Blue());
+          }
+        }
+        REQUIRE(identical == true);
+      }
+    }
+
+    WHEN("the tracer is reset") {
+      tracer.RenderPass();
+      tracer.Reset();
+
+      THEN("the buffer and statistics are cleared") {
+        REQUIRE(tracer.Passes() == 0);
+        REQUIRE(tracer.Buffer().Samples() == 0);
+        REQUIRE(tracer.TotalStats().samples == 0);
+      }
+    }
+  }
+}
+#endif
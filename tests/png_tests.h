@@ -0,0 +1,201 @@
+#ifndef __PNG_TESTS_H_
+#define __PNG_TESTS_H_
+/*
+ * png_tests.h
+ *
+ * Unit tests for the PNG encoder.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "PngImage.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// A test image: smooth gradients with a little noise
+DisplayImage PngTestImage(const int width, const int height) {
+  DisplayImage image;
+  image.width  = width;
+  image.height = height;
+  image.rgb.resize(width * height * 3);
+  srand(11);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      uint8_t *pixel = &image.rgb[(y * width + x) * 3];
+      pixel[0] = static_cast<uint8_t>(x * 255 / width);
+      pixel[1] = static_cast<uint8_t>(y * 255 / height);
+      pixel[2] = static_cast<uint8_t>(128 + rand() % 8);
+    }
+  }
+  return image;
+}
+
+SCENARIO("PNG scanlines are filtered", "[PngImage]") {
+  GIVEN("the Paeth predictor") {
+    THEN("it picks the neighbor closest to left + up - up-left") {
+      REQUIRE(PngPaethPredictor(10, 20, 10) == 20);
+      REQUIRE(PngPaethPredictor(20, 10, 10) == 20);
+      REQUIRE(PngPaethPredictor(10, 10, 20) == 10);
+      REQUIRE(PngPaethPredictor(0, 255, 128) == 128);
+    }
+  }
+
+  GIVEN("random rows that do not fill a whole number of vectors") {
+    const int LENGTH = 3 * 37;
+    std::vector<uint8_t> row(LENGTH), previous(LENGTH);
+    srand(3);
+    for (int i = 0; i < LENGTH; ++i) {
+      row[i]      = static_cast<uint8_t>(rand());
+      previous[i] = static_cast<uint8_t>(rand());
+    }
+
+    THEN("every filter matches the byte by byte definition") {
+      for (int filter = PNG_FILTER_NONE; filter <= PNG_FILTER_PAETH; ++filter) {
+        std::vector<uint8_t> out(LENGTH);
+        PngFilterRow(static_cast<PngFilter>(filter), &row[0], &previous[0], LENGTH, &out[0]);
+        for (int i = 0; i < LENGTH; ++i) {
+          const uint8_t A = (i >= 3) ? row[i - 3] : 0;
+          const uint8_t C = (i >= 3) ? previous[i - 3] : 0;
+          REQUIRE(out[i] == PngFilterByte(static_cast<PngFilter>(filter), row[i], A,
+                                          previous[i], C));
+        }
+      }
+    }
+
+    THEN("the filter cost is the sum of the signed magnitudes") {
+      uint32_t expected = 0;
+      for (int i = 0; i < LENGTH; ++i) {
+        expected += abs(static_cast<int8_t>(row[i]));
+      }
+      REQUIRE(PngFilterCost(&row[0], LENGTH) == expected);
+    }
+  }
+}
+
+SCENARIO("images are written as PNG files", "[PngImage]") {
+  const DisplayImage IMAGE = PngTestImage(61, 45);
+  TileScheduler scheduler(3);
+
+  GIVEN("every level and several band heights") {
+    THEN("the image decodes to the original pixels") {
+      const int LEVELS[] = {0, 1, 6, 9};
+      const int BANDS[]  = {1, 7, 64};
+      for (int l = 0; l < 4; ++l) {
+        for (int b = 0; b < 3; ++b) {
+          PngOptions options;
+          options.level      = LEVELS[l];
+          options.bandHeight = BANDS[b];
+
+          std::string data;
+          REQUIRE(EncodePng(IMAGE, options, scheduler, data) == true);
+
+          DisplayImage decoded;
+          REQUIRE(DecodePng(data, decoded) == true);
+          REQUIRE(decoded.width == 61);
+          REQUIRE(decoded.height == 45);
+          REQUIRE(decoded.rgb == IMAGE.rgb);
+        }
+      }
+    }
+  }
+
+  GIVEN("the same image at different levels") {
+    PngOptions fast, small;
+    fast.level  = 1;
+    small.level = 9;
+    std::string fastData, smallData;
+    REQUIRE(EncodePng(IMAGE, fast, scheduler, fastData) == true);
+    REQUIRE(EncodePng(IMAGE, small, scheduler, smallData) == true);
+
+    THEN("both are far smaller than the raw pixels, and level 9 is smallest") {
+      REQUIRE(fastData.size() < IMAGE.rgb.size() / 2);
+      REQUIRE(smallData.size() < fastData.size());
+    }
+  }
+
+  GIVEN("an encoded image with a damaged byte") {
+    std::string data;
+    REQUIRE(EncodePng(IMAGE, PngOptions(), scheduler, data) == true);
+    data[data.size() / 2] ^= 0x55;
+
+    THEN("decoding fails") {
+      DisplayImage decoded;
+      REQUIRE(DecodePng(data, decoded) == false);
+    }
+  }
+
+  GIVEN("an encoded image whose header claims a huge size") {
+    std::string data;
+    REQUIRE(EncodePng(IMAGE, PngOptions(), scheduler, data) == true);
+
+    // Rewrites the IHDR width and height (bytes 16-23) and its CRC
+    const auto RESIZED = [&data](const uint32_t width, const uint32_t height) {
+      std::string header;
+      PngPutUint32(header, width);
+      PngPutUint32(header, height);
+      std::string resized = data;
+      resized.replace(16, 8, header);
+      std::string crc;
+      PngPutUint32(crc, static_cast<uint32_t>(
+                          crc32(0L, reinterpret_cast<const Bytef *>(resized.data() + 12), 17)));
+      resized.replace(29, 4, crc);
+      return resized;
+    };
+
+    THEN("decoding fails without allocating the image or changing the output") {
+      DisplayImage decoded = PngTestImage(3, 2);
+      REQUIRE(DecodePng(RESIZED(0x7fffffff, 0x7fffffff), decoded) == false);
+      REQUIRE(DecodePng(RESIZED(0xffffffff, 1), decoded) == false);
+      REQUIRE(DecodePng(RESIZED(60000, 60000), decoded) == false);
+      REQUIRE(DecodePng(RESIZED(61, 100000), decoded) == false);
+      REQUIRE(decoded.width == 3);
+      REQUIRE(decoded.height == 2);
+      REQUIRE(decoded.rgb == PngTestImage(3, 2).rgb);
+    }
+
+    THEN("the unchanged header still decodes") {
+      DisplayImage decoded;
+      REQUIRE(DecodePng(RESIZED(61, 45), decoded) == true);
+      REQUIRE(decoded.rgb == IMAGE.rgb);
+    }
+  }
+
+  GIVEN("a canvas") {
+    Canvas canvas(5, 4);
+    canvas.WritePixel(1, 2, Color(1.5, 0.5, -1));
+    const std::string NAME = "/tmp/png_test_" + std::to_string(getpid()) + ".png";
+
+    WHEN("it is written to a PNG file") {
+      const bool WRITTEN = WritePng(canvas, NAME, PngOptions(), scheduler);
+
+      std::string data;
+      FILE *input = fopen(NAME.c_str(), "rb");
+      if (input) {
+        char buffer[4096];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+          data.append(buffer, count);
+        }
+        fclose(input);
+      }
+      remove(NAME.c_str());
+
+      THEN("its colors are clamped and scaled to 8 bits") {
+        REQUIRE(WRITTEN == true);
+        DisplayImage decoded;
+        REQUIRE(DecodePng(data, decoded) == true);
+        const uint8_t *PIXEL = &decoded.rgb[(2 * 5 + 1) * 3];
+        REQUIRE(PIXEL[0] == 255);
+        REQUIRE(PIXEL[1] == 128);
+        REQUIRE(PIXEL[2] == 0);
+        REQUIRE(decoded.rgb[0] == 0);
+      }
+    }
+  }
+}
+#endif
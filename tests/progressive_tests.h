@@ -0,0 +1,131 @@
+#ifndef __PROGRESSIVE_TESTS_H_
+#define __PROGRESSIVE_TESTS_H_
+/*
+ * progressive_tests.h
+ *
+ * Unit tests for time-budgeted progressive rendering.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "ProgressiveRenderer.h"
+#include "Transformations.h"
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+SCENARIO("tiles are run against a deadline", "[TileScheduler]") {
+  TileScheduler scheduler(2);
+  const std::vector<Tile> TILES = MakeTiles(8, 8, 2);
+  std::atomic<int> calls(0);
+  const TileFunction COUNT = [&calls](const Tile &, const int) { ++calls; };
+
+  GIVEN("a deadline that has already passed") {
+    WHEN("the tiles are run") {
+      const bool FINISHED = scheduler.RunUntil(TILES, COUNT, std::chrono::steady_clock::now());
+
+      THEN("no tile is started") {
+        REQUIRE(FINISHED == false);
+        REQUIRE(calls == 0);
+      }
+    }
+  }
+
+  GIVEN("a distant deadline") {
+    WHEN("the tiles are run") {
+      const bool FINISHED = scheduler.RunUntil(TILES, COUNT,
+        std::chrono::steady_clock::now() + std::chrono::seconds(60));
+
+      THEN("every tile is run") {
+        REQUIRE(FINISHED == true);
+        REQUIRE(calls == 16);
+      }
+    }
+  }
+}
+
+SCENARIO("the default world is rendered progressively", "[ProgressiveRenderer]") {
+  const World WORLD = DefaultWorld();
+  Camera camera(11, 11, M_PI/2);
+  camera.SetTransform(ViewTransform(Point(0, 0, -5), Point(0, 0, 0), Vector(0, 1, 0)));
+  TileScheduler scheduler(2);
+
+  ProgressiveOptions options;
+  options.maxSamples = 3;
+  options.tileSize   = 6;
+  ProgressiveRenderer renderer(WORLD, camera, scheduler, options);
+
+  GIVEN("a generous time budget") {
+    std::vector<ProgressiveUpdate> updates;
+    bool coarseBlocksFilled = true;
+
+    WHEN("the image is rendered") {
+      const ProgressiveResult RESULT = renderer.Render(60.0, [&](const ProgressiveUpdate &update) {
+        updates.push_back(update);
+        if (update.pass == 0) {
+          // The first pass fills each 4x4 block with one traced pixel
+          Canvas coarse(11, 11);
+          renderer.Snapshot(coarse);
+          coarseBlocksFilled = coarse.PixelAt(4, 4) == coarse.PixelAt(7, 7) &&
+                               coarse.PixelAt(8, 8) == coarse.PixelAt(10, 10);
+        }
+      });
+
+      THEN("every pass finishes") {
+        REQUIRE(RESULT.finished        == true);
+        REQUIRE(RESULT.passesCompleted == 5);
+        REQUIRE(RESULT.samplesPerPixel == 3);
+      }
+
+      THEN("the callback reports every pass in order") {
+        REQUIRE(updates.size() == 5);
+        REQUIRE(updates[0].blockSize == 4);
+        REQUIRE(updates[1].blockSize == 2);
+        REQUIRE(updates[2].blockSize == 1);
+        REQUIRE(updates[2].samplesPerPixel == 1);
+        REQUIRE(updates[4].samplesPerPixel == 3);
+        for (size_t i = 0; i < updates.size(); ++i) {
+          REQUIRE(updates[i].pass     == static_cast<int>(i));
+          REQUIRE(updates[i].complete == true);
+        }
+      }
+
+      THEN("the coarse pass fills whole blocks") {
+        REQUIRE(coarseBlocksFilled == true);
+      }
+
+      THEN("the final image matches a full render") {
+        Canvas reference(11, 11), progressive(11, 11);
+        Render(camera, WORLD, reference);
+        renderer.Snapshot(progressive);
+
+        // Jittered samples average over the pixel instead of hitting its center
+        const Color EXPECTED = reference.PixelAt(5, 5);
+        const Color ACTUAL   = progressive.PixelAt(5, 5);
+        REQUIRE(std::fabs(ACTUAL.Red()   - EXPECTED.Red())   < 0.05);
+        REQUIRE(std::fabs(ACTUAL.Green() - EXPECTED.Green()) < 0.05);
+        REQUIRE(std::fabs(ACTUAL.Blue()  - EXPECTED.Blue())  < 0.05);
+      }
+    }
+  }
+
+  GIVEN("a budget that has already run out") {
+    int callbacks = 0;
+
+    WHEN("the image is rendered") {
+      const ProgressiveResult RESULT = renderer.Render(0.0, [&](const ProgressiveUpdate &update) {
+        ++callbacks;
+        REQUIRE(update.complete == false);
+      });
+
+      THEN("the render stops after the interrupted first pass") {
+        REQUIRE(RESULT.finished        == false);
+        REQUIRE(RESULT.passesCompleted == 0);
+        REQUIRE(RESULT.samplesPerPixel == 0);
+        REQUIRE(callbacks == 1);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,182 @@
+#ifndef __QUATERNION_TESTS_H_
+#define __QUATERNION_TESTS_H_
+/*
+ * quaternion_tests.h
+ *
+ * Unit tests for quaternions, dual quaternions, and batched pose blending.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Quaternion.h"
+#include "PoseBatch.h"
+#include "Animation.h"
+#include "Transformations.h"
+#include "Random.h"
+#include "kernels/Kernels.h"
+
+#include <cmath>
+#include <vector>
+
+SCENARIO("quaternions rotate like the rotation matrices") {
+  GIVEN("rotations about each axis") {
+    const Quaternion QX = QuaternionAxisAngle(Vector(1, 0, 0), M_PI / 4);
+    const Quaternion QY = QuaternionAxisAngle(Vector(0, 2, 0), 1.2f);
+    const Quaternion QZ = QuaternionAxisAngle(Vector(0, 0, 1), -0.7f);
+
+    THEN("they convert to RotX, RotY, and RotZ") {
+      REQUIRE(ToMatrix4(ToAffine(QX)) == RotX(M_PI / 4));
+      REQUIRE(ToMatrix4(ToAffine(QY)) == RotY(1.2f));
+      REQUIRE(ToMatrix4(ToAffine(QZ)) == RotZ(-0.7f));
+    }
+
+    THEN("rotating a point matches the matrix") {
+      const Tuple P = Point(1, -2, 3);
+      REQUIRE(Rotate(QX, P) == RotX(M_PI / 4) * P);
+      REQUIRE(Rotate(QZ * QY, P) == RotZ(-0.7f) * RotY(1.2f) * P);
+      REQUIRE(Rotate(QY, Vector(0, 1, 0)) == Vector(0, 1, 0));
+    }
+
+    THEN("the conjugate is the inverse rotation") {
+      REQUIRE(QY * Conjugate(QY) == Quaternion());
+    }
+  }
+
+  GIVEN("Euler angles") {
+    const Tuple ANGLES = Vector(0.3f, -1.1f, 2.5f);
+
+    THEN("the rotation is about x, then y, then z") {
+      REQUIRE(ToMatrix4(ToAffine(QuaternionFromEuler(ANGLES))) ==
+              RotZ(2.5f) * RotY(-1.1f) * RotX(0.3f));
+    }
+  }
+}
+
+SCENARIO("quaternions interpolate along the shorter arc") {
+  GIVEN("the identity and a half turn about z") {
+    const Quaternion A;
+    const Quaternion B = QuaternionAxisAngle(Vector(0, 0, 1), M_PI / 2);
+
+    THEN("the slerp midpoint is a quarter turn") {
+      REQUIRE(Slerp(A, B, 0.5f) == QuaternionAxisAngle(Vector(0, 0, 1), M_PI / 4));
+      REQUIRE(Slerp(A, B, 0) == A);
+      REQUIRE(Slerp(A, B, 1) == B);
+    }
+
+    THEN("nlerp stays a unit quaternion with the same midpoint") {
+      const Quaternion Q = Nlerp(A, B, 0.3f);
+      REQUIRE(std::fabs(Dot(Q, Q) - 1) < 1e-5);
+      REQUIRE(Nlerp(A, B, 0.5f) == Slerp(A, B, 0.5f));
+    }
+
+    THEN("a negated endpoint gives the same rotations") {
+      const Quaternion Q = Slerp(A, -B, 0.5f);
+      REQUIRE(ToAffine(Q) == ToAffine(Slerp(A, B, 0.5f)));
+      REQUIRE(ToAffine(Nlerp(A, -B, 0.25f)) == ToAffine(Nlerp(A, B, 0.25f)));
+    }
+  }
+}
+
+SCENARIO("dual quaternions are rigid transforms") {
+  GIVEN("a rotation followed by a translation") {
+    const Quaternion R = QuaternionFromEuler(Vector(0.4f, 0.2f, -1.3f));
+    const DualQuaternion DQ = DualQuaternionFromPose(R, Vector(1, 2, 3));
+    const Matrix4 EXPECTED = Translation(1, 2, 3) * ToMatrix4(ToAffine(R));
+
+    THEN("the rotation and translation can be recovered") {
+      REQUIRE(DualQuaternionRotation(DQ) == R);
+      REQUIRE(DualQuaternionTranslation(DQ) == Vector(1, 2, 3));
+    }
+
+    THEN("it transforms points like the matrix") {
+      REQUIRE(ToMatrix4(ToAffine(DQ)) == EXPECTED);
+      REQUIRE(TransformPoint(DQ, Point(-2, 0.5f, 4)) == EXPECTED * Point(-2, 0.5f, 4));
+    }
+
+    THEN("composition applies the right hand side first") {
+      const DualQuaternion MOVE = DualQuaternionFromPose(Quaternion(), Vector(0, -5, 0));
+      REQUIRE(ToMatrix4(ToAffine(MOVE * DQ)) == Translation(0, -5, 0) * EXPECTED);
+    }
+
+    THEN("blending to itself changes nothing") {
+      REQUIRE(Nlerp(DQ, DQ, 0.6f) == DQ);
+      REQUIRE(Nlerp(DualQuaternion(), DQ, 1) == DQ);
+    }
+  }
+}
+
+SCENARIO("pose batches blend keyframes for many objects", "[Kernels]") {
+  GIVEN("random keyframe pairs") {
+    Pcg32 rng(7);
+    const int COUNT = 37;
+    std::vector<Keyframe> from, to;
+    for (int i = 0; i < COUNT; ++i) {
+      from.push_back(Keyframe(0, Vector(rng.NextFloat(), rng.NextFloat(), rng.NextFloat()),
+                              Vector(6 * rng.NextFloat(), 6 * rng.NextFloat(), 6 * rng.NextFloat()),
+                              Vector(1 + rng.NextFloat(), 1, 2)));
+      to.push_back(Keyframe(1 + i % 3, Vector(rng.NextFloat(), -2, rng.NextFloat()),
+                            Vector(6 * rng.NextFloat(), 6 * rng.NextFloat(), 6 * rng.NextFloat()),
+                            Vector(0.5f, rng.NextFloat() + 0.5f, 1)));
+    }
+
+    PoseBatch batch;
+    for (int i = 0; i < COUNT; ++i) {
+      REQUIRE(batch.Add(from[i], to[i]) == static_cast<size_t>(i));
+    }
+
+    THEN("the keyframes themselves match KeyframeTransform()") {
+      batch.Evaluate(-1);
+      for (int i = 0; i < COUNT; ++i) {
+        REQUIRE(ToMatrix4(batch.Transform(i)) == KeyframeTransform(from[i]));
+      }
+      batch.Evaluate(10);
+      for (int i = 0; i < COUNT; ++i) {
+        REQUIRE(ToMatrix4(batch.Transform(i)) == KeyframeTransform(to[i]));
+      }
+    }
+
+    THEN("every kernel level matches the scalar nlerp") {
+      batch.Evaluate(0.8f);
+      std::vector<float> t(COUNT), expected(12 * COUNT);
+      for (int i = 0; i < COUNT; ++i) {
+        t[i] = 0.8f / to[i].time;
+        const Pose A = KeyframePose(from[i]);
+        const Pose B = KeyframePose(to[i]);
+        const Pose BLEND(Nlerp(A.rotation, B.rotation, t[i]),
+                         A.translation + (B.translation - A.translation) * t[i],
+                         A.scale + (B.scale - A.scale) * t[i]);
+        REQUIRE(batch.Transform(i) == PoseTransform(BLEND));
+      }
+
+      // Feed the kernels the same poses the batch stores
+      std::vector<float> planes[2][10];
+      KernelPoses poses[2];
+      for (int k = 0; k < 2; ++k) {
+        for (int i = 0; i < COUNT; ++i) {
+          const Pose P = KeyframePose(k == 0 ? from[i] : to[i]);
+          const float C[10] = {P.rotation.W(), P.rotation.X(), P.rotation.Y(), P.rotation.Z(),
+                               P.translation.X(), P.translation.Y(), P.translation.Z(),
+                               P.scale.X(), P.scale.Y(), P.scale.Z()};
+          for (int c = 0; c < 10; ++c) {
+            planes[k][c].push_back(C[c]);
+          }
+        }
+        poses[k] = {planes[k][0].data(), planes[k][1].data(), planes[k][2].data(),
+                    planes[k][3].data(), planes[k][4].data(), planes[k][5].data(),
+                    planes[k][6].data(), planes[k][7].data(), planes[k][8].data(),
+                    planes[k][9].data()};
+      }
+
+      const CpuLevel DETECTED = DetectCpuLevel();
+      for (int l = CPU_SSE2; l <= DETECTED; ++l) {
+        std::vector<float> affine(12 * COUNT);
+        KernelsForLevel(static_cast<CpuLevel>(l)).blendPoses(poses[0], poses[1], t.data(),
+                                                             COUNT, affine.data());
+        for (int i = 0; i < 12 * COUNT; ++i) {
+          REQUIRE(std::fabs(affine[i] - batch.Transforms()[i]) < 1e-5);
+        }
+      }
+    }
+  }
+}
+#endif
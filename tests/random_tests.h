@@ -0,0 +1,138 @@
+#ifndef __RANDOM_TESTS_H_
+#define __RANDOM_TESTS_H_
+/*
+ * random_tests.h
+ *
+ * Unit tests for the random number generators and low-discrepancy samplers.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "Random.h"
+
+#include <vector>
+
+SCENARIO("random numbers are generated with PCG32", "[Random]") {
+  GIVEN("the reference seed and stream") {
+    Pcg32 rng(42, 54);
+
+    THEN("the output matches the reference implementation") {
+      REQUIRE(rng.NextUint() == 0xa15c02b7U);
+      REQUIRE(rng.NextUint() == 0x7b47f409U);
+      REQUIRE(rng.NextUint() == 0xba1d3330U);
+      REQUIRE(rng.NextUint() == 0x83d2f293U);
+      REQUIRE(rng.NextUint() == 0xbfa4784bU);
+      REQUIRE(rng.NextUint() == 0xcbed606eU);
+    }
+  }
+
+  GIVEN("generators for individual pixel samples") {
+    Pcg32 a = PixelRng(1, 10, 20, 3);
+    Pcg32 b = PixelRng(1, 10, 20, 3);
+    Pcg32 c = PixelRng(1, 10, 20, 4);
+    Pcg32 d = PixelRng(1, 11, 20, 3);
+
+    THEN("the same pixel and sample always produce the same sequence") {
+      const uint32_t A = a.NextUint();
+      REQUIRE(A == b.NextUint());
+      REQUIRE(A != c.NextUint());
+      REQUIRE(A != d.NextUint());
+    }
+  }
+
+  GIVEN("a generator") {
+    Pcg32 rng(7);
+    WHEN("many floats are drawn") {
+      float minimum = 1, maximum = 0, mean = 0;
+      const int COUNT = 10000;
+      for (int i = 0; i < COUNT; ++i) {
+        const float U = rng.NextFloat();
+        minimum = std::min(minimum, U);
+        maximum = std::max(maximum, U);
+        mean += U / COUNT;
+      }
+
+      THEN("they are uniformly distributed in [0, 1)") {
+        REQUIRE(minimum >= 0.0f);
+        REQUIRE(maximum < 1.0f);
+        REQUIRE(std::fabs(mean - 0.5) < 0.01);
+      }
+    }
+  }
+}
+
+SCENARIO("random numbers are generated in batches", "[Random]") {
+  GIVEN("a key and a starting counter") {
+    const uint64_t KEY = 0x0123456789abcdefULL;
+    const uint32_t FIRST = 1000;
+
+    WHEN("a batch that is not a multiple of the block size is filled") {
+      std::vector<float> batch(37);
+      FillUniform(KEY, FIRST, &batch[0], batch.size());
+
+      THEN("it matches the scalar generator") {
+        for (size_t i = 0; i < batch.size(); ++i) {
+          REQUIRE(batch[i] == BitsToFloat(CounterRandom(KEY, FIRST + i)));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("low-discrepancy samples are generated", "[Random]") {
+  GIVEN("the radical inverse") {
+    THEN("the digits are mirrored around the radix point") {
+      REQUIRE(FloatCompare(RadicalInverse(2, 1), 0.5)      == true);
+      REQUIRE(FloatCompare(RadicalInverse(2, 6), 0.375)    == true);
+      REQUIRE(FloatCompare(RadicalInverse(3, 1), 1.0/3.0)  == true);
+      REQUIRE(FloatCompare(RadicalInverse(3, 5), 7.0/9.0)  == true);
+      REQUIRE(ReverseBits(1) == 0x80000000U);
+    }
+  }
+
+  GIVEN("16 Owen-scrambled Sobol points") {
+    std::vector<int> xStrata(16, 0), yStrata(16, 0), cells(16, 0);
+    for (uint32_t i = 0; i < 16; ++i) {
+      float u, v;
+      Sobol2D(i, 1234, u, v);
+      ++xStrata[static_cast<int>(u * 16)];
+      ++yStrata[static_cast<int>(v * 16)];
+      ++cells[static_cast<int>(u * 4) * 4 + static_cast<int>(v * 4)];
+    }
+
+    THEN("every elementary interval holds exactly one point") {
+      for (int i = 0; i < 16; ++i) {
+        REQUIRE(xStrata[i] == 1);
+        REQUIRE(yStrata[i] == 1);
+        REQUIRE(cells[i]   == 1);
+      }
+    }
+  }
+
+  GIVEN("different scrambling seeds") {
+    float u1, v1, u2, v2;
+    Sobol2D(5, 1, u1, v1);
+    Sobol2D(5, 2, u2, v2);
+    THEN("the points are decorrelated") {
+      REQUIRE(u1 != u2);
+      REQUIRE(v1 != v2);
+    }
+  }
+
+  GIVEN("27 Owen-scrambled Halton points in base 3") {
+    std::vector<int> strata(27, 0);
+    for (uint32_t i = 0; i < 27; ++i) {
+      const float U = Halton(1, i, 99);
+      REQUIRE(U >= 0.0f);
+      REQUIRE(U < 1.0f);
+      ++strata[static_cast<int>(U * 27)];
+    }
+
+    THEN("every stratum holds exactly one point") {
+      for (int i = 0; i < 27; ++i) {
+        REQUIRE(strata[i] == 1);
+      }
+    }
+  }
+}
+#endif
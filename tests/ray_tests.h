@@ -384,6 +384,22 @@ SCENARIO("we want to determine which intersection hits a sphere") {
       }
     }
   }
+
+  GIVEN("rays that miss") {
+    const std::vector<Intersection> NONE;
+    Hit(NONE);
+
+    WHEN("misses are computed between creating spheres") {
+      const Sphere FIRST;
+      const Intersection MISS = Hit(NONE);
+      const Sphere SECOND;
+
+      THEN("a miss does not use up a sphere ID") {
+        REQUIRE(MISS.T() == FLT_MAX);
+        REQUIRE(SECOND.ID() == FIRST.ID() + 1);
+      }
+    }
+  }
 }
 
 // Reflect() tests
@@ -0,0 +1,227 @@
+#ifndef __RENDER_SERVER_TESTS_H_
+#define __RENDER_SERVER_TESTS_H_
+/*
+ * render_server_tests.h
+ *
+ * Unit tests for the render server, its protocol, and its client.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "RenderProtocol.h"
+#include "RenderServer.h"
+#include "RenderClient.h"
+#include "Scenes.h"
+
+#include <unistd.h>
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("render jobs are serialized", "[RenderProtocol]") {
+  GIVEN("a job with a camera override") {
+    RenderJob job;
+    job.scene          = "glassspheres";
+    job.width          = 64;
+    job.height         = 32;
+    job.tileSize       = 8;
+    job.overrideCamera = true;
+    job.from           = Point(1, 2, -3);
+    job.fov            = 0.5;
+
+    WHEN("it is serialized and parsed") {
+      RenderJob parsed;
+      const bool PARSED = ParseJob(SerializeJob(job), parsed);
+
+      THEN("every field survives") {
+        REQUIRE(PARSED == true);
+        REQUIRE(parsed.scene    == "glassspheres");
+        REQUIRE(parsed.width    == 64);
+        REQUIRE(parsed.height   == 32);
+        REQUIRE(parsed.tileSize == 8);
+        REQUIRE(parsed.overrideCamera == true);
+        REQUIRE(parsed.from == Point(1, 2, -3));
+        REQUIRE(FloatCompare(parsed.fov, 0.5) == true);
+      }
+    }
+  }
+
+  GIVEN("malformed jobs") {
+    RenderJob parsed;
+
+    THEN("they are rejected") {
+      REQUIRE(ParseJob("colour red\n", parsed) == false);
+      REQUIRE(ParseJob("width abc\n", parsed) == false);
+      REQUIRE(ParseJob("width 0\n", parsed) == false);
+    }
+  }
+
+  GIVEN("jobs that are too large") {
+    RenderJob parsed;
+    std::string error;
+
+    THEN("they are rejected with a reason") {
+      REQUIRE(ParseJob("width 100000\nheight 100000\n", parsed, error) == false);
+      REQUIRE(error.find("image size 100000x100000") == 0);
+      REQUIRE(ParseJob("width 16384\nheight 16384\n", parsed, error) == false);
+      REQUIRE(ParseJob("width 16384\nheight 1024\n", parsed, error) == true);
+      REQUIRE(ParseJob("tile 3000\n", parsed, error) == false);
+      REQUIRE(error.find("tile size 3000") == 0);
+      REQUIRE(ParseJob("tile 2048\n", parsed, error) == true);
+    }
+
+    THEN("jobs built in code are checked against the same limits") {
+      RenderJob job;
+      job.width  = 100000;
+      job.height = 10;
+      REQUIRE(ValidateJob(job, error) == false);
+      REQUIRE(error.find("image size 100000x10") == 0);
+      job.width = -5;
+      REQUIRE(ValidateJob(job, error) == false);
+      job.width = 640;
+      REQUIRE(ValidateJob(job, error) == true);
+    }
+
+    THEN("the largest tile still fits in one message") {
+      Tile tile;
+      tile.x0 = tile.y0 = 0;
+      tile.x1 = tile.y1 = MAX_TILE_SIZE;
+      const std::vector<Color> PIXELS(MAX_TILE_SIZE * MAX_TILE_SIZE);
+      REQUIRE(EncodeTile(tile, PIXELS).size() <= MAX_MESSAGE_SIZE);
+    }
+  }
+}
+
+SCENARIO("listening on a Unix socket only replaces sockets", "[RenderProtocol]") {
+  GIVEN("a regular file where the socket should go") {
+    const std::string PATH = "/tmp/listen_test_" + std::to_string(getpid());
+    FILE *file = fopen(PATH.c_str(), "wb");
+    REQUIRE(file != NULL);
+    fclose(file);
+
+    WHEN("a socket is created at that path") {
+      const int FD = ListenUnix(PATH);
+
+      THEN("it fails and the file is kept") {
+        REQUIRE(FD == -1);
+        REQUIRE(access(PATH.c_str(), F_OK) == 0);
+      }
+      remove(PATH.c_str());
+    }
+  }
+
+  GIVEN("a stale socket left at the path") {
+    const std::string PATH = "/tmp/listen_test_sock_" + std::to_string(getpid());
+    const int STALE = ListenUnix(PATH);
+    REQUIRE(STALE >= 0);
+    close(STALE);
+
+    WHEN("a socket is created at that path again") {
+      const int FD = ListenUnix(PATH);
+
+      THEN("the stale socket is replaced") {
+        REQUIRE(FD >= 0);
+        close(FD);
+      }
+      unlink(PATH.c_str());
+    }
+  }
+}
+
+SCENARIO("tiles are encoded for the wire", "[RenderProtocol]") {
+  GIVEN("a 2x1 tile") {
+    Tile tile;
+    tile.x0 = 4;
+    tile.y0 = 6;
+    tile.x1 = 6;
+    tile.y1 = 7;
+    std::vector<Color> pixels;
+    pixels.push_back(Color(0.25, 0.5, 1.5));
+    pixels.push_back(Color(-1, 0, 2));
+
+    WHEN("it is encoded and decoded") {
+      Tile decoded;
+      std::vector<Color> decodedPixels;
+      const std::string PAYLOAD = EncodeTile(tile, pixels);
+      const bool DECODED = DecodeTile(PAYLOAD, decoded, decodedPixels);
+
+      THEN("the bounds and pixels are unchanged") {
+        REQUIRE(DECODED == true);
+        REQUIRE(decoded.x0 == 4);
+        REQUIRE(decoded.y1 == 7);
+        REQUIRE(decodedPixels.size() == 2);
+        REQUIRE(decodedPixels[0] == pixels[0]);
+        REQUIRE(decodedPixels[1] == pixels[1]);
+      }
+
+      THEN("a truncated payload is rejected") {
+        REQUIRE(DecodeTile(PAYLOAD.substr(0, PAYLOAD.size() - 4), decoded, decodedPixels) == false);
+      }
+    }
+  }
+}
+
+SCENARIO("a render server answers jobs over a socket", "[RenderServer]") {
+  const std::string PATH = "/tmp/render_server_test_" + std::to_string(getpid()) + ".sock";
+
+  GIVEN("a running server") {
+    RenderServer server(PATH, 2);
+    REQUIRE(server.Listen() == true);
+    std::thread serving(&RenderServer::Serve, &server);
+
+    WHEN("the default scene is requested twice") {
+      RenderJob job;
+      job.width    = 12;
+      job.height   = 10;
+      job.tileSize = 4;
+
+      Canvas canvas(12, 10);
+      std::string error;
+      int tiles = 0;
+      const bool FIRST  = RequestRender(PATH, job, canvas, error, [&tiles](const Tile &) { ++tiles; });
+      const bool SECOND = RequestRender(PATH, job, canvas, error);
+
+      RequestShutdown(PATH);
+      serving.join();
+
+      THEN("every tile is streamed back") {
+        REQUIRE(FIRST  == true);
+        REQUIRE(SECOND == true);
+        REQUIRE(tiles  == 9);
+        REQUIRE(server.JobsServed() == 2);
+      }
+
+      THEN("the image matches a local render") {
+        Scene scene;
+        BuildScene("default", scene);
+        Canvas expected(12, 10);
+        Render(SceneCamera(scene, 12, 10), scene.world, expected);
+
+        for (int y = 0; y < 10; ++y) {
+          for (int x = 0; x < 12; ++x) {
+            REQUIRE(canvas.PixelAt(x, y) == expected.PixelAt(x, y));
+          }
+        }
+      }
+    }
+
+    WHEN("an unknown scene is requested") {
+      RenderJob job;
+      job.scene = "nonexistent";
+      Canvas canvas(job.width, job.height);
+      std::string error;
+      const bool SUCCESS = RequestRender(PATH, job, canvas, error);
+
+      RequestShutdown(PATH);
+      serving.join();
+
+      THEN("the server reports the error") {
+        REQUIRE(SUCCESS == false);
+        REQUIRE(error == "unknown scene: nonexistent");
+      }
+    }
+  }
+}
+#endif
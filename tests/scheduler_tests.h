@@ -0,0 +1,92 @@
+#ifndef __SCHEDULER_TESTS_H_
+#define __SCHEDULER_TESTS_H_
+/*
+ * scheduler_tests.h
+ *
+ * Unit tests for the TileScheduler thread pool.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "TileScheduler.h"
+
+#include <atomic>
+#include <vector>
+
+SCENARIO("a canvas is split into tiles", "[TileScheduler]") {
+  GIVEN("a canvas that is not a multiple of the tile size") {
+    const std::vector<Tile> TILES = MakeTiles(10, 7, 4);
+
+    THEN("the tiles cover every pixel exactly once") {
+      REQUIRE(TILES.size() == 6);
+
+      std::vector<int> coverage(10 * 7, 0);
+      for (size_t i = 0; i < TILES.size(); ++i) {
+        REQUIRE(TILES[i].index == static_cast<int>(i));
+        for (int y = TILES[i].y0; y < TILES[i].y1; ++y) {
+          for (int x = TILES[i].x0; x < TILES[i].x1; ++x) {
+            ++coverage[y * 10 + x];
+          }
+        }
+      }
+
+      for (size_t i = 0; i < coverage.size(); ++i) {
+        REQUIRE(coverage[i] == 1);
+      }
+    }
+  }
+
+  GIVEN("a canvas split into bands of rows") {
+    const std::vector<Tile> BANDS = MakeBands(10, 7, 3);
+
+    THEN("each band spans the full width and the last band is clipped") {
+      REQUIRE(BANDS.size() == 3);
+      for (size_t i = 0; i < BANDS.size(); ++i) {
+        REQUIRE(BANDS[i].index == static_cast<int>(i));
+        REQUIRE(BANDS[i].x0 == 0);
+        REQUIRE(BANDS[i].x1 == 10);
+        REQUIRE(BANDS[i].y0 == static_cast<int>(i) * 3);
+      }
+      REQUIRE(BANDS[2].y1 == 7);
+    }
+  }
+
+  GIVEN("a tile size or band height below one") {
+    THEN("no tiles or bands are made") {
+      REQUIRE(MakeTiles(10, 7, 0).empty());
+      REQUIRE(MakeTiles(10, 7, -4).empty());
+      REQUIRE(MakeBands(10, 7, 0).empty());
+      REQUIRE(MakeBands(10, 7, -3).empty());
+    }
+  }
+}
+
+SCENARIO("tiles are rendered on worker threads", "[TileScheduler]") {
+  GIVEN("a scheduler with several threads") {
+    TileScheduler scheduler(4);
+    const std::vector<Tile> TILES = MakeTiles(64, 64, 8);
+
+    WHEN("several jobs are run back to back") {
+      std::vector<int> runs(TILES.size(), 0);
+      std::atomic<int> badThread(0);
+
+      for (int job = 0; job < 3; ++job) {
+        scheduler.Run(TILES, [&](const Tile &tile, const int thread) {
+          ++runs[tile.index];
+          if (thread < 0 || thread >= scheduler.NumThreads()) {
+            ++badThread;
+          }
+        });
+      }
+
+      THEN("every tile is run exactly once per job on a valid thread") {
+        REQUIRE(scheduler.NumThreads() == 4);
+        REQUIRE(badThread == 0);
+        for (size_t i = 0; i < runs.size(); ++i) {
+          REQUIRE(runs[i] == 3);
+        }
+      }
+    }
+  }
+}
+#endif
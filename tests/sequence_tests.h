@@ -0,0 +1,153 @@
+#ifndef __SEQUENCE_TESTS_H_
+#define __SEQUENCE_TESTS_H_
+/*
+ * sequence_tests.h
+ *
+ * Unit tests for the bounded queue and the pipelined sequence renderer.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "BoundedQueue.h"
+#include "SequenceRenderer.h"
+#include "Animation.h"
+#include "Transformations.h"
+
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("items pass through a bounded queue", "[BoundedQueue]") {
+  GIVEN("a queue holding two items") {
+    BoundedQueue<int> queue(2);
+
+    WHEN("a producer pushes more items than fit") {
+      std::thread producer([&queue]() {
+        for (int i = 0; i < 10; ++i) {
+          queue.Push(i);
+          REQUIRE(queue.Size() <= 2);
+        }
+        queue.Close();
+      });
+
+      std::vector<int> popped;
+      int item;
+      while (queue.Pop(item)) {
+        popped.push_back(item);
+      }
+      producer.join();
+
+      THEN("every item arrives in order") {
+        REQUIRE(popped.size() == 10);
+        for (int i = 0; i < 10; ++i) {
+          REQUIRE(popped[i] == i);
+        }
+      }
+    }
+
+    WHEN("it is closed") {
+      queue.Push(7);
+      queue.Close();
+
+      THEN("pushes fail and the remaining items drain") {
+        int item = 0;
+        REQUIRE(queue.Push(8) == false);
+        REQUIRE(queue.Pop(item) == true);
+        REQUIRE(item == 7);
+        REQUIRE(queue.Pop(item) == false);
+      }
+    }
+  }
+}
+
+SCENARIO("an animated sequence is rendered", "[SequenceRenderer]") {
+  // The inner sphere of the default world moves across the frame
+  const World WORLD = DefaultWorld();
+  TransformTrack track;
+  track.AddKey(Keyframe(0, Vector(-1, 0, -2), Vector(0, 0, 0), Vector(0.5, 0.5, 0.5)));
+  track.AddKey(Keyframe(1, Vector(1, 0, -2), Vector(0, 0, 0), Vector(0.5, 0.5, 0.5)));
+  Animation animation;
+  animation.AddTrack(1, track);
+
+  Camera camera(16, 12, M_PI/2);
+  camera.SetTransform(ViewTransform(Point(0, 0, -5), Point(0, 0, 0), Vector(0, 1, 0)));
+  TileScheduler scheduler(2);
+
+  SequenceOptions options;
+  options.frames   = 5;
+  options.tileSize = 4;
+
+  GIVEN("the frame times of the sequence") {
+    THEN("they span the start and end times") {
+      REQUIRE(FloatCompare(FrameTime(options, 0), 0.0) == true);
+      REQUIRE(FloatCompare(FrameTime(options, 2), 0.5) == true);
+      REQUIRE(FloatCompare(FrameTime(options, 4), 1.0) == true);
+    }
+  }
+
+  GIVEN("a sink that keeps the center pixel of every frame") {
+    std::vector<int> order;
+    std::vector<Color> centers;
+    const FrameSink SINK = [&](const int frame, const Canvas &canvas) {
+      order.push_back(frame);
+      centers.push_back(canvas.PixelAt(8, 6));
+    };
+
+    WHEN("the sequence is rendered") {
+      SequenceRenderer renderer(WORLD, animation, camera, scheduler, options);
+      const SequenceStats STATS = renderer.Render(SINK);
+
+      THEN("every frame reaches the sink in order") {
+        REQUIRE(STATS.frames == 5);
+        REQUIRE(order.size() == 5);
+        for (int i = 0; i < 5; ++i) {
+          REQUIRE(order[i] == i);
+        }
+        REQUIRE(STATS.traceSeconds <= STATS.seconds);
+      }
+
+      THEN("each frame shows the world posed at its time") {
+        for (int i = 0; i < 5; ++i) {
+          World posed = WORLD;
+          animation.Apply(posed, FrameTime(options, i));
+          Canvas expected(16, 12);
+          Render(camera, posed, expected);
+          REQUIRE(centers[i] == expected.PixelAt(8, 6));
+        }
+      }
+
+      THEN("the source world is left untouched") {
+        REQUIRE(WORLD.Objects()[1].Transform() == Scaling(0.5, 0.5, 0.5));
+      }
+    }
+  }
+
+  GIVEN("an asynchronous image writer") {
+    const std::string PATTERN = "/tmp/sequence_test_" + std::to_string(getpid()) + "_%d.ppm";
+    AsyncImageWriter writer(16, 12);
+
+    WHEN("the sequence is rendered to files") {
+      SequenceRenderer renderer(WORLD, animation, camera, scheduler, options);
+      bool written = false;
+      const SequenceStats STATS = renderer.Render(writer, PATTERN, written);
+
+      THEN("every frame is on disk when Render() returns") {
+        REQUIRE(written == true);
+        REQUIRE(STATS.frames == 5);
+        REQUIRE(writer.FilesWritten() == 5);
+        for (int i = 0; i < 5; ++i) {
+          const std::string NAME = FrameFilename(PATTERN, i);
+          FILE *input = fopen(NAME.c_str(), "rb");
+          REQUIRE(input != NULL);
+          fclose(input);
+          remove(NAME.c_str());
+        }
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,170 @@
+#ifndef __STATS_TESTS_H_
+#define __STATS_TESTS_H_
+/*
+ * stats_tests.h
+ *
+ * Unit tests for the render statistics.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "RenderStats.h"
+#include "Camera.h"
+#include "Canvas.h"
+#include "TileScheduler.h"
+#include "Transformations.h"
+#include "World.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("rays and intersections are counted", "[RenderStats]") {
+  GIVEN("the default world rendered through an 11x11 camera") {
+    const World WORLD = DefaultWorld();
+    Camera camera(11, 11, M_PI/2);
+    camera.SetTransform(ViewTransform(Point(0, 0, -5), Point(0, 0, 0), Vector(0, 1, 0)));
+    Canvas canvas(11, 11);
+
+    ResetRenderStats();
+    Render(camera, WORLD, canvas);
+    const RenderStatTotals TOTALS = GatherRenderStats();
+    const uint64_t *V = TOTALS.values;
+
+    THEN("one primary ray is cast per pixel") {
+      REQUIRE(V[STAT_PRIMARY_RAYS] == 121);
+    }
+
+    THEN("every pixel that hits a sphere casts one shadow ray to the light") {
+      int lit = 0;
+      for (int y = 0; y < 11; ++y) {
+        for (int x = 0; x < 11; ++x) {
+          lit += (canvas.PixelAt(x, y) == Color(0, 0, 0)) ? 0 : 1;
+        }
+      }
+      REQUIRE(V[STAT_SHADOW_RAYS] == static_cast<uint64_t>(lit));
+      REQUIRE(V[STAT_SECONDARY_RAYS] == 0);
+    }
+
+    THEN("each ray is tested against both spheres") {
+      REQUIRE(V[STAT_INTERSECTION_TESTS] == 2 * TOTALS.Rays());
+      REQUIRE(V[STAT_HITS] > 0);
+      REQUIRE(V[STAT_HITS] < V[STAT_INTERSECTION_TESTS]);
+    }
+
+    THEN("Matrix and heap allocations are counted") {
+      REQUIRE(V[STAT_MATRIX_ALLOCATIONS] > 0);
+      REQUIRE(V[STAT_HEAP_ALLOCATIONS] > V[STAT_MATRIX_ALLOCATIONS]);
+      REQUIRE(V[STAT_HEAP_BYTES] > 0);
+    }
+  }
+}
+
+SCENARIO("heap allocations are counted", "[RenderStats]") {
+  GIVEN("a vector that grows") {
+    ResetRenderStats();
+    std::vector<int> values;
+    for (int i = 0; i < 100; ++i) {
+      values.push_back(i);
+    }
+    const RenderStatTotals TOTALS = GatherRenderStats();
+
+    THEN("each reallocation is counted") {
+      REQUIRE(GetRenderStatsRegistry().countsHeap == true);
+      REQUIRE(TOTALS.values[STAT_HEAP_ALLOCATIONS] >= 2);
+      REQUIRE(TOTALS.values[STAT_HEAP_BYTES] >= 100 * sizeof(int));
+      REQUIRE(TOTALS.values[STAT_MATRIX_ALLOCATIONS] == 0);
+    }
+  }
+}
+
+SCENARIO("phases can be timed on a new thread", "[RenderStats]") {
+  GIVEN("a thread whose first allocation happens when its phase ends") {
+    ResetRenderStats();
+    std::thread worker([] {
+      RenderStatsPhase phase("worker");
+    });
+    worker.join();
+
+    THEN("the phase is recorded without deadlocking") {
+      const std::vector<RenderPhaseTiming> PHASES = RenderPhases();
+      REQUIRE(PHASES.size() == 1);
+      REQUIRE(PHASES[0].name == "worker");
+    }
+  }
+}
+
+SCENARIO("counters from every thread are merged", "[RenderStats]") {
+  GIVEN("tiles that count on worker threads") {
+    TileScheduler scheduler(3);
+    const std::vector<Tile> TILES = MakeTiles(16, 16, 2);
+
+    ResetRenderStats();
+    scheduler.Run(TILES, [](const Tile &, const int) {
+      COUNT_RENDER_STAT(STAT_HITS, 2);
+    });
+
+    THEN("the totals include every thread") {
+      REQUIRE(GatherRenderStats().values[STAT_HITS] == 2 * TILES.size());
+    }
+  }
+}
+
+SCENARIO("phases are timed and reported", "[RenderStats]") {
+  GIVEN("a phase run twice") {
+    const World WORLD = DefaultWorld();
+    Camera camera(5, 5, M_PI/2);
+    Canvas canvas(5, 5);
+
+    ResetRenderStats();
+    for (int i = 0; i < 2; ++i) {
+      RenderStatsPhase phase("render");
+      Render(camera, WORLD, canvas);
+    }
+    const std::vector<RenderPhaseTiming> PHASES = RenderPhases();
+
+    THEN("the runs are summed into one phase") {
+      REQUIRE(PHASES.size() == 1);
+      REQUIRE(PHASES[0].name == "render");
+      REQUIRE(PHASES[0].rays == GatherRenderStats().Rays());
+      REQUIRE(PHASES[0].wallSeconds > 0);
+      REQUIRE(PHASES[0].cpuSeconds >= 0);
+    }
+
+    THEN("the JSON report holds every counter and phase") {
+      const std::string JSON = RenderStatsJson();
+      for (int i = 0; i < NUM_RENDER_STATS; ++i) {
+        const std::string KEY = std::string("\"") + RenderStatName(static_cast<RenderStat>(i)) + "\"";
+        REQUIRE(JSON.find(KEY) != std::string::npos);
+      }
+      REQUIRE(JSON.find("\"primaryRays\": 50") != std::string::npos);
+      REQUIRE(JSON.find("{\"name\": \"render\"") != std::string::npos);
+      REQUIRE(JSON.find("\"peakResidentBytes\"") != std::string::npos);
+      REQUIRE(PeakResidentBytes() > 0);
+    }
+
+    WHEN("RENDER_STATS_JSON names a file") {
+      const std::string FILENAME = "/tmp/stats_test_" + std::to_string(getpid()) + ".json";
+      setenv("RENDER_STATS_JSON", FILENAME.c_str(), 1);
+      const bool REPORTED = ReportRenderStats();
+      unsetenv("RENDER_STATS_JSON");
+
+      THEN("the report is written there as JSON") {
+        REQUIRE(REPORTED == true);
+        FILE *input = fopen(FILENAME.c_str(), "rb");
+        REQUIRE(input != NULL);
+        char buffer[64] = {0};
+        REQUIRE(fread(buffer, 1, sizeof(buffer) - 1, input) > 0);
+        fclose(input);
+        remove(FILENAME.c_str());
+        REQUIRE(std::string(buffer).find("{\n  \"counters\": {") == 0);
+      }
+    }
+  }
+}
+#endif
@@ -22,3 +22,30 @@
 #include "light_tests.h"
 #include "material_tests.h"
 #include "lighting_tests.h"
+#include "world_tests.h"
+#include "camera_tests.h"
+#include "scheduler_tests.h"
+#include "random_tests.h"
+#include "pathtracer_tests.h"
+#include "antialiasing_tests.h"
+#include "progressive_tests.h"
+#include "incremental_tests.h"
+#include "render_server_tests.h"
+#include "distributed_tests.h"
+#include "animation_tests.h"
+#include "async_writer_tests.h"
+#include "sequence_tests.h"
+#include "exr_tests.h"
+#include "tonemap_tests.h"
+#include "png_tests.h"
+#include "canvas_diff_tests.h"
+#include "counters_tests.h"
+#include "trace_tests.h"
+#include "stats_tests.h"
+#include "kernels_tests.h"
+#include "fixed_matrix_tests.h"
+#include "affine_tests.h"
+#include "transform_builder_tests.h"
+#include "quaternion_tests.h"
+#include "tuple_arrays_tests.h"
+#include "particle_system_tests.h"
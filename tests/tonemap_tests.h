@@ -0,0 +1,167 @@
+#ifndef __TONEMAP_TESTS_H_
+#define __TONEMAP_TESTS_H_
+/*
+ * tonemap_tests.h
+ *
+ * Unit tests for tone mapping a canvas to 8 bit sRGB.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "ToneMap.h"
+#include "tuple_tests.h"
+
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+SCENARIO("tone curves map HDR values into [0, 1]", "[ToneMap]") {
+  GIVEN("values in and above the displayable range") {
+    THEN("clamping clips them") {
+      REQUIRE(FloatCompare(ApplyToneCurve(0.25f, TONE_CLAMP), 0.25f));
+      REQUIRE(FloatCompare(ApplyToneCurve(4.0f, TONE_CLAMP), 1.0f));
+      REQUIRE(FloatCompare(ApplyToneCurve(-1.0f, TONE_CLAMP), 0.0f));
+    }
+
+    THEN("Reinhard compresses them") {
+      REQUIRE(FloatCompare(ApplyToneCurve(1.0f, TONE_REINHARD), 0.5f));
+      REQUIRE(FloatCompare(ApplyToneCurve(3.0f, TONE_REINHARD), 0.75f));
+    }
+
+    THEN("the ACES fit rolls highlights off smoothly") {
+      REQUIRE(FloatCompare(ApplyToneCurve(0.0f, TONE_ACES), 0.0f));
+      REQUIRE(ApplyToneCurve(1.0f, TONE_ACES) < ApplyToneCurve(2.0f, TONE_ACES));
+      REQUIRE(std::fabs(ApplyToneCurve(1000.0f, TONE_ACES) - 1.0f) < 0.00001);
+    }
+  }
+
+  GIVEN("linear values") {
+    THEN("the sRGB curve brightens the midtones") {
+      REQUIRE(FloatCompare(SrgbEncode(0.0f), 0.0f));
+      REQUIRE(std::fabs(SrgbEncode(0.001f) - 0.01292f) < 0.00001);
+      REQUIRE(std::fabs(SrgbEncode(0.5f) - 0.735357f) < 0.00001);
+      REQUIRE(std::fabs(SrgbEncode(1.0f) - 1.0f) < 0.00001);
+    }
+  }
+}
+
+SCENARIO("a canvas is tone mapped to 8 bits", "[ToneMap]") {
+  // HDR noise on a canvas whose width is not a multiple of 4
+  Canvas canvas(37, 19);
+  srand(7);
+  for (int y = 0; y < canvas.GetHeight(); ++y) {
+    for (int x = 0; x < canvas.GetWidth(); ++x) {
+      canvas.WritePixel(x, y, Color(4.0f * rand() / RAND_MAX, 1.0f * rand() / RAND_MAX,
+                                    0.01f * rand() / RAND_MAX));
+    }
+  }
+
+  TileScheduler scheduler(2);
+
+  GIVEN("every combination of curve, sRGB, and dithering") {
+    const ToneCurve CURVES[] = {TONE_CLAMP, TONE_REINHARD, TONE_ACES};
+
+    THEN("the vectorized pass is within one code value of the exact one") {
+      for (int curve = 0; curve < 3; ++curve) {
+        for (int flags = 0; flags < 4; ++flags) {
+          ToneMapOptions options;
+          options.curve      = CURVES[curve];
+          options.exposure   = 0.5f;
+          options.srgb       = (flags & 1) != 0;
+          options.dither     = (flags & 2) != 0;
+          options.bandHeight = 4;
+
+          DisplayImage image;
+          ToneMap(canvas, options, scheduler, image);
+          REQUIRE(image.width == 37);
+          REQUIRE(image.height == 19);
+          REQUIRE(image.rgb.size() == 37 * 19 * 3);
+
+          for (int y = 0; y < image.height; ++y) {
+            for (int x = 0; x < image.width; ++x) {
+              const Color PIXEL = canvas.PixelAt(x, y);
+              const uint8_t *MAPPED = &image.rgb[(y * image.width + x) * 3];
+              REQUIRE(abs(MAPPED[0] - ToneMapValue(PIXEL.Red(), x, y, options)) <= 1);
+              REQUIRE(abs(MAPPED[1] - ToneMapValue(PIXEL.Green(), x, y, options)) <= 1);
+              REQUIRE(abs(MAPPED[2] - ToneMapValue(PIXEL.Blue(), x, y, options)) <= 1);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  GIVEN("a flat color between two 8 bit codes") {
+    Canvas flat(8, 8);
+    for (int y = 0; y < 8; ++y) {
+      for (int x = 0; x < 8; ++x) {
+        flat.WritePixel(x, y, Color(100.25f / 255, 100.25f / 255, 100.25f / 255));
+      }
+    }
+
+    ToneMapOptions options;
+    options.curve = TONE_CLAMP;
+    options.srgb  = false;
+
+    WHEN("it is mapped without dithering") {
+      options.dither = false;
+      DisplayImage image;
+      ToneMap(flat, options, scheduler, image);
+
+      THEN("every pixel rounds to the same code") {
+        for (size_t i = 0; i < image.rgb.size(); ++i) {
+          REQUIRE(image.rgb[i] == 100);
+        }
+      }
+    }
+
+    WHEN("it is mapped with dithering") {
+      options.dither = true;
+      DisplayImage image;
+      ToneMap(flat, options, scheduler, image);
+
+      THEN("the codes average out to the original value") {
+        int sum = 0;
+        for (size_t i = 0; i < image.rgb.size(); ++i) {
+          REQUIRE((image.rgb[i] == 100 || image.rgb[i] == 101));
+          sum += image.rgb[i];
+        }
+        REQUIRE(std::fabs(static_cast<float>(sum) / image.rgb.size() - 100.25f) < 0.001);
+      }
+    }
+  }
+
+  GIVEN("a mapped image") {
+    DisplayImage image;
+    ToneMap(canvas, ToneMapOptions(), scheduler, image);
+    const std::string NAME = "/tmp/tonemap_test_" + std::to_string(getpid()) + ".ppm";
+
+    WHEN("it is written as a binary PPM") {
+      const bool WRITTEN = WriteDisplayPPM(image, NAME);
+
+      char header[32] = {0};
+      long size = 0;
+      FILE *input = fopen(NAME.c_str(), "rb");
+      if (input) {
+        if (!fgets(header, sizeof(header), input)) {
+          header[0] = '\0';
+        }
+        fseek(input, 0, SEEK_END);
+        size = ftell(input);
+        fclose(input);
+      }
+      remove(NAME.c_str());
+
+      THEN("the file holds the header and 3 bytes per pixel") {
+        REQUIRE(WRITTEN == true);
+        REQUIRE(std::string(header) == "P6\n");
+        REQUIRE(size == static_cast<long>(strlen("P6\n37 19\n255\n") + 37 * 19 * 3));
+      }
+    }
+  }
+}
+#endif
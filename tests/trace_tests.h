@@ -0,0 +1,174 @@
+#ifndef __TRACE_TESTS_H_
+#define __TRACE_TESTS_H_
+/*
+ * trace_tests.h
+ *
+ * Unit tests for the FrameTrace timeline profiler.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "FrameTrace.h"
+#include "TileScheduler.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief  Number of times needle appears in text.
+ */
+int CountOccurrences(const std::string &text, const std::string &needle) {
+  int count = 0;
+  for (size_t pos = text.find(needle); pos != std::string::npos;
+       pos = text.find(needle, pos + needle.size())) {
+    ++count;
+  }
+  return count;
+}
+
+SCENARIO("scopes are recorded as trace spans", "[FrameTrace]") {
+  GIVEN("a running trace") {
+    StartFrameTrace();
+
+    WHEN("nested scopes are run on the calling thread") {
+      {
+        TRACE_SCOPE("outer");
+        TRACE_SCOPE("inner");
+      }
+      StopFrameTrace();
+      const std::string JSON = ChromeTraceJson();
+
+      THEN("each scope is a complete event") {
+        REQUIRE(JSON.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[") == 0);
+        REQUIRE(CountOccurrences(JSON, "\"name\":\"outer\",\"ph\":\"X\"") == 1);
+        REQUIRE(CountOccurrences(JSON, "\"name\":\"inner\",\"ph\":\"X\"") == 1);
+      }
+    }
+
+    WHEN("tiles are run on a scheduler") {
+      {
+        TileScheduler scheduler(2);
+        scheduler.Run(MakeTiles(8, 8, 2), [](const Tile &, const int) {
+          TRACE_SCOPE("work");
+        });
+      }
+      StopFrameTrace();
+      const std::string JSON = ChromeTraceJson();
+
+      THEN("every tile is recorded on a named worker thread") {
+        REQUIRE(CountOccurrences(JSON, "\"name\":\"Tile\",\"ph\":\"X\"") == 16);
+        REQUIRE(CountOccurrences(JSON, "\"name\":\"work\",\"ph\":\"X\"") == 16);
+        REQUIRE(JSON.find("TileScheduler worker") != std::string::npos);
+      }
+    }
+
+    WHEN("scopes are run after the trace is stopped") {
+      StopFrameTrace();
+      {
+        TRACE_SCOPE("ignored");
+      }
+
+      THEN("nothing is recorded") {
+        REQUIRE(ChromeTraceJson().find("ignored") == std::string::npos);
+      }
+    }
+
+    WHEN("a new trace is started") {
+      {
+        TRACE_SCOPE("first");
+      }
+      StartFrameTrace();
+      {
+        TRACE_SCOPE("second");
+      }
+      StopFrameTrace();
+      const std::string JSON = ChromeTraceJson();
+
+      THEN("spans from the previous trace are discarded") {
+        REQUIRE(JSON.find("\"first\"") == std::string::npos);
+        REQUIRE(JSON.find("\"second\"") != std::string::npos);
+      }
+    }
+
+    WHEN("a thread records more spans than its ring holds") {
+      const size_t CAPACITY = TraceRing::CAPACITY;
+      std::thread worker([CAPACITY] {
+        SetTraceThreadName("ring \"test\"");
+        for (size_t i = 0; i < CAPACITY + 10; ++i) {
+          TRACE_SCOPE("span");
+        }
+      });
+      worker.join();
+      StopFrameTrace();
+      const std::string JSON = ChromeTraceJson();
+
+      THEN("only the newest spans are kept") {
+        REQUIRE(CountOccurrences(JSON, "\"name\":\"span\",\"ph\":\"X\"") ==
+                static_cast<int>(CAPACITY));
+      }
+
+      THEN("the thread name is escaped") {
+        REQUIRE(JSON.find("\"args\":{\"name\":\"ring \\\"test\\\"\"}") != std::string::npos);
+      }
+    }
+  }
+}
+
+SCENARIO("trace rings are only made for threads that record spans", "[FrameTrace]") {
+  FrameTraceState &state = GetFrameTraceState();
+
+  // Number of rings that exist right now
+  const auto RINGS = [&state] {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.rings.size();
+  };
+
+  GIVEN("no running trace") {
+    StopFrameTrace();
+
+    WHEN("named threads run traced scopes") {
+      const size_t BEFORE = RINGS();
+      {
+        TileScheduler scheduler(3);
+        scheduler.Run(MakeTiles(8, 8, 2), [](const Tile &, const int) {
+          TRACE_SCOPE("work");
+        });
+      }
+
+      THEN("no ring is created") {
+        REQUIRE(RINGS() == BEFORE);
+      }
+    }
+  }
+
+  GIVEN("a thread that recorded spans in an earlier trace and exited") {
+    StartFrameTrace();
+    std::thread first([] {
+      SetTraceThreadName("first");
+      TRACE_SCOPE("old");
+    });
+    first.join();
+    const size_t BEFORE = RINGS();
+
+    WHEN("a new thread records spans in a new trace") {
+      StartFrameTrace();
+      std::thread second([] {
+        SetTraceThreadName("second");
+        TRACE_SCOPE("new");
+      });
+      second.join();
+      StopFrameTrace();
+      const std::string JSON = ChromeTraceJson();
+
+      THEN("it reuses the exited thread's ring") {
+        REQUIRE(RINGS() == BEFORE);
+        REQUIRE(JSON.find("\"second\"") != std::string::npos);
+        REQUIRE(JSON.find("\"new\"") != std::string::npos);
+        REQUIRE(JSON.find("\"first\"") == std::string::npos);
+        REQUIRE(JSON.find("\"old\"") == std::string::npos);
+      }
+    }
+  }
+}
+#endif
@@ -0,0 +1,84 @@
+#ifndef __TRANSFORM_BUILDER_TESTS_H_
+#define __TRANSFORM_BUILDER_TESTS_H_
+/*
+ * transform_builder_tests.h
+ *
+ * Unit tests for the chainable TransformBuilder and the inverse it tracks.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "TransformBuilder.h"
+#include "Transformations.h"
+#include "AffineTransform.h"
+#include "RaySphere.h"
+#include "Camera.h"
+#include "Animation.h"
+
+#include <cmath>
+
+static_assert(TransformBuilder().Translate(1, 2, 3).InverseAffine() ==
+              ToAffine(Translation(-1, -2, -3)),
+              "The builder runs at compile time");
+
+SCENARIO("transform builders track the inverse") {
+  GIVEN("a chain of every kind of step") {
+    const TransformBuilder BUILDER = TransformBuilder().RotX(M_PI / 2)
+                                                       .Scale(5, 5, 5)
+                                                       .Translate(10, 5, 7)
+                                                       .RotY(-0.4f)
+                                                       .Shear(0.5f, 0, 0, 0.25f, 1, 0)
+                                                       .RotZ(2.1f);
+
+    THEN("the steps apply in the order they are written") {
+      const Matrix4 EXPECTED = RotZ(2.1f) * Shearing(0.5f, 0, 0, 0.25f, 1, 0) * RotY(-0.4f) *
+                               Translation(10, 5, 7) * Scaling(5, 5, 5) * RotX(M_PI / 2);
+      REQUIRE(BUILDER.ForwardMatrix() == EXPECTED);
+    }
+
+    THEN("the tracked inverse undoes the forward transform") {
+      REQUIRE(BUILDER.InverseMatrix() == Inverse(BUILDER.ForwardMatrix()));
+      REQUIRE(BUILDER.Forward() * BUILDER.InverseAffine() == AffineTransform());
+      REQUIRE(BUILDER.InverseAffine() * BUILDER.Forward() == AffineTransform());
+    }
+  }
+
+  GIVEN("the chain from The Ray Tracer Challenge") {
+    const TransformBuilder BUILDER = TransformBuilder().RotX(M_PI / 2)
+                                                       .Scale(5, 5, 5)
+                                                       .Translate(10, 5, 7);
+
+    THEN("a point goes through rotation, scaling, and translation") {
+      REQUIRE(TransformPoint(BUILDER.Forward(), Point(1, 0, 1)) == Point(15, 0, 7));
+      REQUIRE(TransformPoint(BUILDER.InverseAffine(), Point(15, 0, 7)) == Point(1, 0, 1));
+    }
+  }
+
+  GIVEN("objects given a builder") {
+    const TransformBuilder BUILDER = TransformBuilder().Scale(2, 2, 2).Translate(0, 1, 0);
+    Sphere sphere;
+    sphere.SetTransform(BUILDER);
+    Camera camera(11, 11, M_PI / 2);
+    camera.SetTransform(BUILDER);
+
+    THEN("they take both transforms from it") {
+      REQUIRE(sphere.Transform() == BUILDER.ForwardMatrix());
+      REQUIRE(sphere.HasAffineTransform());
+      REQUIRE(sphere.AffineInverse() == BUILDER.InverseAffine());
+      REQUIRE(camera.Transform() == BUILDER.ForwardMatrix());
+      REQUIRE(camera.InverseTransform() == BUILDER.InverseMatrix());
+    }
+  }
+
+  GIVEN("a keyframe") {
+    const Keyframe KEY(0, Vector(1, 2, 3), Vector(0.3f, -1.1f, 2), Vector(2, 0.5f, 3));
+
+    THEN("its builder matches the composed matrices") {
+      const Matrix4 EXPECTED = Translation(1, 2, 3) * RotZ(2) * RotY(-1.1f) * RotX(0.3f) *
+                               Scaling(2, 0.5f, 3);
+      REQUIRE(KeyframeBuilder(KEY).ForwardMatrix() == EXPECTED);
+      REQUIRE(KeyframeBuilder(KEY).InverseMatrix() == Inverse(EXPECTED));
+    }
+  }
+}
+#endif
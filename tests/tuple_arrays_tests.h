@@ -0,0 +1,96 @@
+#ifndef __TUPLE_ARRAYS_TESTS_H_
+#define __TUPLE_ARRAYS_TESTS_H_
+/*
+ * tuple_arrays_tests.h
+ *
+ * Unit tests for in place transforms of structure of arrays tuples.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "TupleArrays.h"
+#include "TransformBuilder.h"
+#include "TileScheduler.h"
+#include "Random.h"
+#include "kernels/Kernels.h"
+
+#include <cmath>
+#include <vector>
+
+SCENARIO("tuple arrays are transformed in place", "[Kernels]") {
+  GIVEN("random points and a transform") {
+    Pcg32 rng(11);
+    std::vector<Tuple> tuples;
+    TupleArrays arrays;
+    for (int i = 0; i < 37; ++i) {
+      tuples.push_back(Point(8 * rng.NextFloat() - 4, 8 * rng.NextFloat() - 4,
+                             8 * rng.NextFloat() - 4));
+      arrays.Add(tuples.back());
+    }
+    const AffineTransform AFFINE = TransformBuilder().Scale(2, 0.5f, 1.5f)
+                                                     .RotY(0.7f)
+                                                     .Translate(1, -2, 3)
+                                                     .Forward();
+
+    WHEN("they are transformed as points") {
+      TransformPoints(AFFINE, arrays);
+
+      THEN("each matches TransformPoint()") {
+        REQUIRE(arrays.Size() == tuples.size());
+        for (size_t i = 0; i < tuples.size(); ++i) {
+          REQUIRE(arrays.PointAt(i) == TransformPoint(AFFINE, tuples[i]));
+        }
+      }
+    }
+
+    WHEN("they are transformed as vectors") {
+      TransformVectors(AFFINE, arrays);
+
+      THEN("the translation is ignored") {
+        for (size_t i = 0; i < tuples.size(); ++i) {
+          const Tuple V = Vector(tuples[i].X(), tuples[i].Y(), tuples[i].Z());
+          REQUIRE(arrays.VectorAt(i) == TransformVector(AFFINE, V));
+        }
+      }
+    }
+
+    THEN("every kernel level gives the same result") {
+      float matrix[12];
+      for (int i = 0; i < 12; ++i) {
+        matrix[i] = AFFINE.GetValue(i / 4, i % 4);
+      }
+      const CpuLevel DETECTED = DetectCpuLevel();
+      for (int l = CPU_SSE2; l <= DETECTED; ++l) {
+        TupleArrays copy = arrays;
+        KernelsForLevel(static_cast<CpuLevel>(l)).transformSoA(matrix, 1, copy.x.data(),
+                                                               copy.y.data(), copy.z.data(),
+                                                               copy.Size());
+        for (size_t i = 0; i < tuples.size(); ++i) {
+          REQUIRE(copy.PointAt(i) == TransformPoint(AFFINE, tuples[i]));
+        }
+      }
+    }
+  }
+
+  GIVEN("an array large enough to split across threads") {
+    TupleArrays arrays;
+    for (int i = 0; i < 200000; ++i) {
+      arrays.Add(Point(i % 101, i % 37 - 18, -0.001f * i));
+    }
+    TupleArrays expected = arrays;
+    const AffineTransform AFFINE = TransformBuilder().RotZ(1.1f).Translate(5, 0, -1).Forward();
+    TransformPoints(AFFINE, expected);
+
+    WHEN("it is transformed on a TileScheduler") {
+      TileScheduler scheduler(4);
+      TransformPoints(AFFINE, arrays, scheduler);
+
+      THEN("every element matches the single threaded transform") {
+        REQUIRE(arrays.x == expected.x);
+        REQUIRE(arrays.y == expected.y);
+        REQUIRE(arrays.z == expected.z);
+      }
+    }
+  }
+}
+#endif
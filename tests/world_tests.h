@@ -0,0 +1,310 @@
+#ifndef __WORLD_TESTS_H_
+#define __WORLD_TESTS_H_
+/*
+ * world_tests.h
+ *
+ * Unit tests for the World class and the recursive shading functions.
+ *
+ * Bryant Pong
+ * 10/18/26
+ */
+#include "World.h"
+#include "Transformations.h"
+
+#include <cmath>
+#include <vector>
+
+/*
+ * Helper to construct a glass sphere (fully transparent, refractive index
+ * of 1.5).
+ */
+Sphere GlassSphere() {
+  Sphere sphere;
+  Material mat;
+  mat.SetTransparency(1.0);
+  mat.SetRefractiveIndex(1.5);
+  sphere.SetMaterial(mat);
+  return sphere;
+}
+
+SCENARIO("a world is created", "[World]") {
+  GIVEN("an empty world") {
+    const World WORLD;
+    THEN("it has no objects or lights and the default recursion limits") {
+      REQUIRE(WORLD.Objects().size() == 0);
+      REQUIRE(WORLD.Lights().size()  == 0);
+      REQUIRE(WORLD.MaxDepth()       == 5);
+      REQUIRE(FloatCompare(WORLD.MinContribution(), 0.01) == true);
+    }
+  }
+
+  GIVEN("the default world") {
+    const World WORLD = DefaultWorld();
+
+    WHEN("a ray is intersected with the world") {
+      const Ray RAY(Point(0, 0, -5), Vector(0, 0, 1));
+      const std::vector<Intersection> XS = IntersectWorld(WORLD, RAY);
+
+      THEN("all intersections are found in sorted order") {
+        REQUIRE(XS.size() == 4);
+        REQUIRE(FloatCompare(XS[0].T(), 4.0) == true);
+        REQUIRE(FloatCompare(XS[1].T(), 4.5) == true);
+        REQUIRE(FloatCompare(XS[2].T(), 5.5) == true);
+        REQUIRE(FloatCompare(XS[3].T(), 6.0) == true);
+      }
+    }
+  }
+}
+
+SCENARIO("intersections are prepared for shading", "[World]") {
+  GIVEN("a ray that hits a sphere from the outside") {
+    const Ray RAY(Point(0, 0, -5), Vector(0, 0, 1));
+    const Sphere SPHERE;
+    const Intersection I(4, SPHERE);
+
+    WHEN("the computations are prepared") {
+      const Computations COMPS = PrepareComputations(I, RAY, Intersections(1, I));
+
+      THEN("the state is correct") {
+        REQUIRE(COMPS.point   == Point(0, 0, -1));
+        REQUIRE(COMPS.eyev    == Vector(0, 0, -1));
+        REQUIRE(COMPS.normalv == Vector(0, 0, -1));
+        REQUIRE(COMPS.inside  == false);
+        REQUIRE(COMPS.overPoint.Z()  < -SURFACE_EPSILON / 2);
+        REQUIRE(COMPS.underPoint.Z() >  SURFACE_EPSILON / 2 - 1);
+      }
+    }
+  }
+
+  GIVEN("a ray that hits a sphere from the inside") {
+    const Ray RAY(Point(0, 0, 0), Vector(0, 0, 1));
+    const Sphere SPHERE;
+    const Intersection I(1, SPHERE);
+
+    WHEN("the computations are prepared") {
+      const Computations COMPS = PrepareComputations(I, RAY, Intersections(1, I));
+
+      THEN("the normal is inverted") {
+        REQUIRE(COMPS.point   == Point(0, 0, 1));
+        REQUIRE(COMPS.eyev    == Vector(0, 0, -1));
+        REQUIRE(COMPS.normalv == Vector(0, 0, -1));
+        REQUIRE(COMPS.inside  == true);
+      }
+    }
+  }
+
+  GIVEN("three overlapping glass spheres") {
+    Sphere a = GlassSphere();
+    a.SetTransform(Scaling(2, 2, 2));
+    Sphere b = GlassSphere();
+    b.SetTransform(Translation(0, 0, -0.25));
+    Sphere c = GlassSphere();
+    c.SetTransform(Translation(0, 0, 0.25));
+
+    Material matA = a.GetMaterial(); matA.SetRefractiveIndex(1.5); a.SetMaterial(matA);
+    Material matB = b.GetMaterial(); matB.SetRefractiveIndex(2.0); b.SetMaterial(matB);
+    Material matC = c.GetMaterial(); matC.SetRefractiveIndex(2.5); c.SetMaterial(matC);
+
+    const Ray RAY(Point(0, 0, -4), Vector(0, 0, 1));
+    const std::vector<Intersection> XS =
+      Intersections(6, Intersection(2, a), Intersection(2.75, b), Intersection(3.25, c),
+                       Intersection(4.75, b), Intersection(5.25, c), Intersection(6, a));
+
+    WHEN("the computations are prepared at each intersection") {
+      const float EXPECTED_N1[] = {1.0, 1.5, 2.0, 2.5, 2.5, 1.5};
+      const float EXPECTED_N2[] = {1.5, 2.0, 2.5, 2.5, 1.5, 1.0};
+
+      THEN("n1 and n2 are found correctly") {
+        for (size_t i = 0; i < XS.size(); ++i) {
+          const Computations COMPS = PrepareComputations(XS[i], RAY, XS);
+          REQUIRE(FloatCompare(COMPS.n1, EXPECTED_N1[i]) == true);
+          REQUIRE(FloatCompare(COMPS.n2, EXPECTED_N2[i]) == true);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("the world is shaded", "[World]") {
+  GIVEN("the default world") {
+    const World WORLD = DefaultWorld();
+
+    WHEN("a ray misses") {
+      const Color RESULT = ColorAt(WORLD, Ray(Point(0, 0, -5), Vector(0, 1, 0)));
+
+      THEN("the color is black") {
+        REQUIRE(RESULT == Color(0, 0, 0));
+      }
+    }
+
+    WHEN("a ray hits the outer sphere") {
+      const Color RESULT = ColorAt(WORLD, Ray(Point(0, 0, -5), Vector(0, 0, 1)));
+
+      THEN("the color is shaded by the Phong Lighting Model") {
+        REQUIRE(RESULT == Color(0.38066, 0.47583, 0.2855));
+      }
+    }
+
+    WHEN("nothing is between a point and the light") {
+      THEN("the point is not shadowed") {
+        REQUIRE(IsShadowed(WORLD, WORLD.Lights()[0], Point(0, 10, 0)) == false);
+        REQUIRE(IsShadowed(WORLD, WORLD.Lights()[0], Point(-20, 20, -20)) == false);
+      }
+    }
+
+    WHEN("an object is between a point and the light") {
+      THEN("the point is shadowed") {
+        REQUIRE(IsShadowed(WORLD, WORLD.Lights()[0], Point(10, -10, 10)) == true);
+      }
+    }
+  }
+}
+
+SCENARIO("reflected colors are computed", "[World]") {
+  GIVEN("a ray hitting a non-reflective surface") {
+    const World WORLD = DefaultWorld();
+    const Ray RAY(Point(0, 0, -5), Vector(0, 0, 1));
+    const Intersection I(4, WORLD.Objects()[0]);
+    const Computations COMPS = PrepareComputations(I, RAY, Intersections(1, I));
+
+    THEN("the reflected color is black") {
+      REQUIRE(ReflectedColor(WORLD, COMPS, 0, 1.0) == Color(0, 0, 0));
+    }
+  }
+
+  GIVEN("a half-reflective sphere facing the default world") {
+    World world = DefaultWorld();
+    Sphere mirror;
+    Material mat;
+    mat.SetReflective(0.5);
+    mirror.SetMaterial(mat);
+    mirror.SetTransform(Translation(0, 0, -4));
+    world.AddObject(mirror);
+
+    // The ray hits the mirror and bounces back towards the default spheres
+    const Ray RAY(Point(0, 0, -2.5), Vector(0, 0, -1));
+    const Intersection I(0.5, mirror);
+    const Computations COMPS = PrepareComputations(I, RAY, Intersections(1, I));
+
+    THEN("the reflected color is half of the color seen along the reflection vector") {
+      const Color EXPECTED = ColorAt(world, Ray(COMPS.overPoint, COMPS.reflectv), 1, 0.5) * 0.5;
+      REQUIRE(ReflectedColor(world, COMPS, 0, 1.0) == EXPECTED);
+      REQUIRE(!(EXPECTED == Color(0, 0, 0)));
+    }
+
+    THEN("the reflected color is black once the bounce budget is exhausted") {
+      REQUIRE(ReflectedColor(world, COMPS, world.MaxDepth(), 1.0) == Color(0, 0, 0));
+    }
+
+    THEN("the reflected color is black once the ray contributes too little") {
+      world.SetMinContribution(0.6);
+      REQUIRE(ReflectedColor(world, COMPS, 0, 1.0) == Color(0, 0, 0));
+    }
+  }
+
+  GIVEN("a light inside of a perfect mirror") {
+    World world;
+    world.AddLight(PointLight(Point(0, 0, 0), Color(1, 1, 1)));
+
+    Sphere mirror;
+    Material mat;
+    mat.SetReflective(1.0);
+    mirror.SetMaterial(mat);
+    mirror.SetTransform(Scaling(10, 10, 10));
+    world.AddObject(mirror);
+
+    WHEN("a ray bounces around the inside of the mirror") {
+      world.SetMinContribution(0);
+      const Color RESULT = ColorAt(world, Ray(Point(0, 0, 0), Vector(0, 1, 0)));
+
+      THEN("the recursion terminates at the maximum depth") {
+        REQUIRE(RESULT.Red() > 0);
+      }
+    }
+  }
+}
+
+SCENARIO("refracted colors are computed", "[World]") {
+  GIVEN("an opaque surface") {
+    const World WORLD = DefaultWorld();
+    const Ray RAY(Point(0, 0, -5), Vector(0, 0, 1));
+    const std::vector<Intersection> XS =
+      Intersections(2, Intersection(4, WORLD.Objects()[0]), Intersection(6, WORLD.Objects()[0]));
+    const Computations COMPS = PrepareComputations(XS[0], RAY, XS);
+
+    THEN("the refracted color is black") {
+      REQUIRE(RefractedColor(WORLD, COMPS, 0, 1.0) == Color(0, 0, 0));
+    }
+  }
+
+  GIVEN("a transparent surface") {
+    World world = DefaultWorld();
+    Material mat = world.Objects()[0].GetMaterial();
+    mat.SetTransparency(1.0);
+    mat.SetRefractiveIndex(1.5);
+    world.Objects()[0].SetMaterial(mat);
+
+    const Sphere SHAPE = world.Objects()[0];
+
+    WHEN("the bounce budget is exhausted") {
+      const Ray RAY(Point(0, 0, -5), Vector(0, 0, 1));
+      const std::vector<Intersection> XS =
+        Intersections(2, Intersection(4, SHAPE), Intersection(6, SHAPE));
+      const Computations COMPS = PrepareComputations(XS[0], RAY, XS);
+
+      THEN("the refracted color is black") {
+        REQUIRE(RefractedColor(world, COMPS, world.MaxDepth(), 1.0) == Color(0, 0, 0));
+      }
+    }
+
+    WHEN("the ray is totally internally reflected") {
+      const Ray RAY(Point(0, 0, sqrt(2)/2), Vector(0, 1, 0));
+      const std::vector<Intersection> XS =
+        Intersections(2, Intersection(-sqrt(2)/2, SHAPE), Intersection(sqrt(2)/2, SHAPE));
+      const Computations COMPS = PrepareComputations(XS[1], RAY, XS);
+
+      THEN("the refracted color is black") {
+        REQUIRE(RefractedColor(world, COMPS, 0, 1.0) == Color(0, 0, 0));
+      }
+    }
+  }
+}
+
+SCENARIO("the Schlick approximation is computed", "[World]") {
+  GIVEN("a glass sphere") {
+    const Sphere SHAPE = GlassSphere();
+
+    WHEN("a ray is totally internally reflected") {
+      const Ray RAY(Point(0, 0, sqrt(2)/2), Vector(0, 1, 0));
+      const std::vector<Intersection> XS =
+        Intersections(2, Intersection(-sqrt(2)/2, SHAPE), Intersection(sqrt(2)/2, SHAPE));
+      const Computations COMPS = PrepareComputations(XS[1], RAY, XS);
+
+      THEN("the reflectance is 1") {
+        REQUIRE(FloatCompare(Schlick(COMPS), 1.0) == true);
+      }
+    }
+
+    WHEN("a ray hits perpendicular to the surface") {
+      const Ray RAY(Point(0, 0, 0), Vector(0, 1, 0));
+      const std::vector<Intersection> XS =
+        Intersections(2, Intersection(-1, SHAPE), Intersection(1, SHAPE));
+      const Computations COMPS = PrepareComputations(XS[1], RAY, XS);
+
+      THEN("the reflectance is small") {
+        REQUIRE(FloatCompare(Schlick(COMPS), 0.04) == true);
+      }
+    }
+
+    WHEN("a ray hits at a small angle with n2 > n1") {
+      const Ray RAY(Point(0, 0.99, -2), Vector(0, 0, 1));
+      const std::vector<Intersection> XS = Intersections(1, Intersection(1.8589, SHAPE));
+      const Computations COMPS = PrepareComputations(XS[0], RAY, XS);
+
+      THEN("the reflectance is significant") {
+        REQUIRE(std::fabs(Schlick(COMPS) - 0.48873) < 0.001);
+      }
+    }
+  }
+}
+#endif